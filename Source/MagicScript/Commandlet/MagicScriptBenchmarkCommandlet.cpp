@@ -0,0 +1,60 @@
+#include "MagicScript/Commandlet/MagicScriptBenchmarkCommandlet.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "MagicScriptCore/Benchmark/MsBenchmark.h"
+#include "MagicScriptCore/Logging/MsLogging.h"
+
+using namespace MagicScript;
+
+UMagicScriptBenchmarkCommandlet::UMagicScriptBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UMagicScriptBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString Filter;
+	FParse::Value(*Params, TEXT("filter="), Filter);
+
+	int32 Scale = 1;
+	FParse::Value(*Params, TEXT("scale="), Scale);
+
+	int32 Warmup = 3;
+	FParse::Value(*Params, TEXT("warmup="), Warmup);
+
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("output="), OutputPath))
+	{
+		OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MagicScript"), TEXT("Benchmarks"),
+			FString::Printf(TEXT("%s.json"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"))));
+	}
+
+	const FBenchmarkSuite Suite = FBenchmarkSuite::CreateDefault(Scale);
+	const TArray<FBenchmarkResult> Results = Suite.Run(Filter, FMath::Max(0, Warmup));
+	if (Results.Num() == 0)
+	{
+		UE_LOG(LogMagicScript, Error, TEXT("MagicScript Benchmark: no case matches filter '%s'"), *Filter);
+		return 1;
+	}
+
+	TArray<FString> Lines;
+	FBenchmarkSuite::ToText(Results).ParseIntoArrayLines(Lines);
+	for (const FString& Line : Lines)
+	{
+		UE_LOG(LogMagicScript, Display, TEXT("%s"), *Line);
+	}
+
+	if (!FFileHelper::SaveStringToFile(FBenchmarkSuite::ToJson(Results), *OutputPath))
+	{
+		UE_LOG(LogMagicScript, Error, TEXT("MagicScript Benchmark: failed to write %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogMagicScript, Display, TEXT("MagicScript Benchmark: %d cases written to %s"), Results.Num(), *OutputPath);
+	return 0;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MagicScriptBenchmarkCommandlet.generated.h"
+
+/**
+ * 헤드리스 마이크로 벤치마크 실행 커맨드렛 (렌더링/월드 불필요)
+ * 사용법: UnrealEditor-Cmd <Project>.uproject -run=MagicScriptBenchmark -nullrhi -unattended
+ *   -filter=<문자열>   이름에 문자열을 포함하는 케이스만 실행 (예: lexer/, interpreter/recursion)
+ *   -scale=<N>         반복 횟수 배율 (기본 1)
+ *   -warmup=<N>        워밍업 반복 횟수 (기본 3)
+ *   -output=<경로>     JSON 결과 경로 (기본 Saved/MagicScript/Benchmarks/<시각>.json)
+ */
+UCLASS()
+class UMagicScriptBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UMagicScriptBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,189 @@
+#include "MagicScript/Commandlet/MagicScriptRunCommandlet.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "MagicScriptCore/Benchmark/MsBenchmark.h"
+#include "MagicScriptCore/Logging/MsLogging.h"
+#include "MagicScriptCore/Runtime/MsScriptHost.h"
+#include "MagicScriptCore/Runtime/MsScriptRunner.h"
+
+using namespace MagicScript;
+
+namespace
+{
+	// 스크립트 1개 실행 결과 (JSON 출력용)
+	struct FScriptFileReport
+	{
+		FString ScriptPath;
+		FScriptRunResult Run;
+		int32 ErrorCount = 0;
+		int32 WarningCount = 0;
+	};
+
+	FString ToJson(const TArray<FScriptFileReport>& Reports)
+	{
+		FString Json = TEXT("{\n\t\"results\":[\n");
+		for (int32 i = 0; i < Reports.Num(); ++i)
+		{
+			const FScriptFileReport& Report = Reports[i];
+
+			TStringBuilder<256> ReturnValue;
+			Report.Run.ReturnValue.AppendDebugString(ReturnValue, DebugStringLogMaxDepth, DebugStringLogMaxLength);
+
+			Json += FString::Printf(
+				TEXT("%s\t\t{\"script\":\"%s\",\"compiled\":%s,\"succeeded\":%s,\"errors\":%d,\"warnings\":%d,\"ms\":%.3f,\"peak_script_bytes\":%lld,\"executions\":%lld,\"return\":\"%s\"}"),
+				i > 0 ? TEXT(",\n") : TEXT(""),
+				*Report.ScriptPath.ReplaceCharWithEscapedChar(),
+				Report.Run.bCompiled ? TEXT("true") : TEXT("false"),
+				Report.Run.bSucceeded ? TEXT("true") : TEXT("false"),
+				Report.ErrorCount, Report.WarningCount,
+				Report.Run.ExecutionMilliseconds, Report.Run.PeakSpaceBytes, Report.Run.ExecutionCount,
+				*FString(ReturnValue.ToString()).ReplaceCharWithEscapedChar());
+		}
+		Json += TEXT("\n\t]\n}\n");
+		return Json;
+	}
+}
+
+UMagicScriptRunCommandlet::UMagicScriptRunCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UMagicScriptRunCommandlet::Main(const FString& Params)
+{
+	FString ScriptArg;
+	if (!FParse::Value(*Params, TEXT("script="), ScriptArg))
+	{
+		UE_LOG(LogMagicScript, Error, TEXT("MagicScriptRun: -script=<file or directory> is required"));
+		return 1;
+	}
+	ScriptArg = FPaths::ConvertRelativePathToFull(ScriptArg);
+
+	// 실행할 파일 목록과 import 기준 폴더
+	TArray<FString> ScriptFiles;
+	FString RootDir;
+	if (IFileManager::Get().DirectoryExists(*ScriptArg))
+	{
+		IFileManager::Get().FindFilesRecursive(ScriptFiles, *ScriptArg, TEXT("*.ms"), true, false);
+		ScriptFiles.Sort();
+		RootDir = ScriptArg;
+	}
+	else if (IFileManager::Get().FileExists(*ScriptArg))
+	{
+		ScriptFiles.Add(ScriptArg);
+		RootDir = FPaths::GetPath(ScriptArg);
+	}
+	FParse::Value(*Params, TEXT("root="), RootDir);
+
+	if (ScriptFiles.Num() == 0)
+	{
+		UE_LOG(LogMagicScript, Error, TEXT("MagicScriptRun: no .ms file found at %s"), *ScriptArg);
+		return 1;
+	}
+
+	FString EntryName = TEXT("main");
+	FParse::Value(*Params, TEXT("entry="), EntryName);
+	if (FParse::Param(*Params, TEXT("noentry")))
+	{
+		EntryName.Reset();
+	}
+
+	double TimeoutSeconds = 0.0;
+	FParse::Value(*Params, TEXT("timeout="), TimeoutSeconds);
+
+	FString OutputPath;
+	FParse::Value(*Params, TEXT("output="), OutputPath);
+
+	FBufferedScriptHost Host(RootDir, !FParse::Param(*Params, TEXT("quiet")));
+	SetDefaultScriptHost(&Host);
+	ON_SCOPE_EXIT
+	{
+		ClearDefaultScriptHost(&Host);
+	};
+
+	// 스크립트 이름은 import와 같은 규칙의 상대 경로
+	auto GetScriptName = [&RootDir](const FString& FilePath)
+	{
+		FString Relative = FilePath;
+		FPaths::MakePathRelativeTo(Relative, *(RootDir / TEXT("")));
+		return Relative;
+	};
+
+	if (FParse::Param(*Params, TEXT("bench")))
+	{
+		int32 Iterations = 20;
+		FParse::Value(*Params, TEXT("iterations="), Iterations);
+
+		FBenchmarkSuite Suite;
+		for (const FString& FilePath : ScriptFiles)
+		{
+			FString Source;
+			if (!FFileHelper::LoadFileToString(Source, *FilePath))
+			{
+				UE_LOG(LogMagicScript, Error, TEXT("MagicScriptRun: failed to read %s"), *FilePath);
+				return 1;
+			}
+			Suite.AddScriptCases(GetScriptName(FilePath), Source, FMath::Max(1, Iterations), EntryName);
+		}
+
+		const TArray<FBenchmarkResult> Results = Suite.Run();
+		TArray<FString> Lines;
+		FBenchmarkSuite::ToText(Results).ParseIntoArrayLines(Lines);
+		for (const FString& Line : Lines)
+		{
+			UE_LOG(LogMagicScript, Display, TEXT("%s"), *Line);
+		}
+
+		if (!OutputPath.IsEmpty() && !FFileHelper::SaveStringToFile(FBenchmarkSuite::ToJson(Results), *OutputPath))
+		{
+			UE_LOG(LogMagicScript, Error, TEXT("MagicScriptRun: failed to write %s"), *OutputPath);
+			return 1;
+		}
+		return 0;
+	}
+
+	FScriptRunner Runner(&Host);
+	TArray<FScriptFileReport> Reports;
+	int32 FailedCount = 0;
+
+	for (const FString& FilePath : ScriptFiles)
+	{
+		FScriptFileReport& Report = Reports.AddDefaulted_GetRef();
+		Report.ScriptPath = GetScriptName(FilePath);
+
+		Host.ClearScriptLogs();
+		FString Source;
+		if (FFileHelper::LoadFileToString(Source, *FilePath))
+		{
+			Report.Run = Runner.Run(Report.ScriptPath, Source, EntryName, TimeoutSeconds);
+		}
+		else
+		{
+			Host.AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript: File not found: %s"), *FilePath));
+		}
+		Report.ErrorCount = Host.GetLogCount(EScriptLogType::Error);
+		Report.WarningCount = Host.GetLogCount(EScriptLogType::Warning);
+
+		// 런타임 에러 로그가 있으면 중단되지 않았더라도 실패로 간주
+		const bool bFailed = !Report.Run.bSucceeded || Report.ErrorCount > 0;
+		FailedCount += bFailed ? 1 : 0;
+
+		UE_LOG(LogMagicScript, Display, TEXT("MagicScriptRun: %s %s (%.3f ms, errors %d, warnings %d)"),
+			bFailed ? TEXT("FAIL") : TEXT("OK"), *Report.ScriptPath, Report.Run.ExecutionMilliseconds, Report.ErrorCount, Report.WarningCount);
+	}
+
+	if (!OutputPath.IsEmpty() && !FFileHelper::SaveStringToFile(ToJson(Reports), *OutputPath))
+	{
+		UE_LOG(LogMagicScript, Error, TEXT("MagicScriptRun: failed to write %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogMagicScript, Display, TEXT("MagicScriptRun: %d scripts, %d failed"), Reports.Num(), FailedCount);
+	return FailedCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MagicScriptRunCommandlet.generated.h"
+
+/**
+ * .ms 파일을 헤드리스로 실행/벤치마크하는 커맨드라인 호스트 (GameInstance/월드 불필요)
+ * 사용법: UnrealEditor-Cmd <Project>.uproject -run=MagicScriptRun -script=<파일 또는 폴더> -nullrhi -unattended
+ *   -script=<경로>     실행할 .ms 파일 또는 폴더 (폴더면 하위의 모든 .ms)
+ *   -root=<폴더>       import 기준 폴더 (기본: 폴더면 그 폴더, 파일이면 파일이 있는 폴더)
+ *   -entry=<이름>      전역 코드 실행 후 호출할 spell (기본 main), -noentry면 전역 코드만 실행
+ *   -timeout=<초>      남은 setTimeout 작업을 처리할 최대 시간 (기본 0)
+ *   -bench             실행 대신 lex/parse/interpret 벤치마크 (-iterations=<N>, 기본 20)
+ *   -output=<경로>     JSON 결과 경로
+ *   -quiet             스크립트 로그를 출력하지 않음 (개수만 집계)
+ * 실패(컴파일/런타임 에러)한 스크립트가 있으면 1을 반환
+ */
+UCLASS()
+class UMagicScriptRunCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UMagicScriptRunCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -12,6 +12,7 @@ public class MagicScript : ModuleRules
 			new string[]
 			{
 				"Core",
+				"MagicScriptCore",
 			});
 			
 		
@@ -23,5 +24,16 @@ public class MagicScript : ModuleRules
 				"Slate",
 				"SlateCore",
 			});
+
+		// 에디터에서는 디렉터리 감시로 스크립트 파일 변경을 받음 (그 외 빌드는 주기적으로 타임스탬프 확인)
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.Add("DirectoryWatcher");
+			PrivateDefinitions.Add("MAGICSCRIPT_WITH_DIRECTORY_WATCHER=1");
+		}
+		else
+		{
+			PrivateDefinitions.Add("MAGICSCRIPT_WITH_DIRECTORY_WATCHER=0");
+		}
 	}
 }
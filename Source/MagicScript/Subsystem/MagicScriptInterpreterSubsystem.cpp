@@ -5,29 +5,192 @@
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFilemanager.h"
 #include "HAL/PlatformTime.h"
+#include "HAL/FileManager.h"
+#include "Hash/CityHash.h"
 
-#include "MagicScript/Analysis/MsTimeComplexity.h"
-#include "MagicScript/Core/MsLexer.h"
-#include "MagicScript/Core/MsParser.h"
-#include "MagicScript/Core/MsEnvironment.h"
-#include "MagicScript/Logging/MsLoggingEnum.h"
-#include "MagicScript/Runtime/MsInterpreter.h"
-#include "MagicScript/Util/MsMathBuiltins.h"
-#include "MagicScript/Util/MsConsoleBuiltins.h"
-#include "MagicScript/Util/MsArrayBuiltins.h"
+#include "MagicScriptCore/Analysis/MsTimeComplexity.h"
+#include "MagicScriptCore/Core/MsLexer.h"
+#include "MagicScriptCore/Core/MsParser.h"
+#include "MagicScriptCore/Core/MsEnvironment.h"
+#include "MagicScriptCore/Logging/MsLogging.h"
+#include "MagicScriptCore/Logging/MsLoggingEnum.h"
+#include "MagicScriptCore/Logging/MsTrace.h"
+#include "MagicScriptCore/Runtime/MsInterpreter.h"
+#include "MagicScriptCore/Runtime/MsModuleGraph.h"
+#include "MagicScriptCore/Util/MsMathBuiltins.h"
+#include "MagicScriptCore/Util/MsConsoleBuiltins.h"
+#include "MagicScriptCore/Util/MsArrayBuiltins.h"
+#include "MagicScriptCore/Util/MsCollectionBuiltins.h"
+#include "MagicScriptCore/Util/MsStringBuiltins.h"
+
+#ifndef MAGICSCRIPT_WITH_DIRECTORY_WATCHER
+#define MAGICSCRIPT_WITH_DIRECTORY_WATCHER 0
+#endif
+
+#if MAGICSCRIPT_WITH_DIRECTORY_WATCHER
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#endif
 
 using namespace MagicScript;
 
+namespace
+{
+	uint64 HashScriptSource(const FString& Source)
+	{
+		return CityHash64(reinterpret_cast<const char*>(*Source), Source.Len() * sizeof(TCHAR));
+	}
+
+	FValue ToScriptValue(const FMagicScriptValue& Value)
+	{
+		switch (Value.Type)
+		{
+		case EMagicScriptValueType::Number: return FValue::FromNumber(Value.Number);
+		case EMagicScriptValueType::String: return FValue::FromString(Value.String);
+		case EMagicScriptValueType::Bool:   return FValue::FromBool(Value.bBool);
+		default:                            return FValue::Null();
+		}
+	}
+
+	FMagicScriptValue ToBlueprintValue(const FValue& Value)
+	{
+		FMagicScriptValue Result;
+		switch (Value.Type)
+		{
+		case EValueType::Null:
+			break;
+		case EValueType::Number:
+			Result.Type = EMagicScriptValueType::Number;
+			Result.Number = Value.Number;
+			break;
+		case EValueType::Bool:
+			Result.Type = EMagicScriptValueType::Bool;
+			Result.bBool = Value.Bool;
+			break;
+		default:
+			// 문자열이 아닌 값(배열/객체 등)은 표시용 문자열로
+			Result.Type = EMagicScriptValueType::String;
+			Result.String = Value.Type == EValueType::String ? Value.GetString() : Value.ToScriptString();
+			break;
+		}
+		return Result;
+	}
+
+	// 스크립트 실행 완료 로그 (카테고리가 꺼져 있으면 반환값/복잡도 문자열을 만들지 않음)
+	void LogScriptFinished(const TCHAR* Prefix, const FString& FuncName, const FValue& ReturnValue,
+		const int64 PeakBytes, const FTimeComplexityResult& TimeComplexity)
+	{
+		if (!UE_LOG_ACTIVE(LogMagicScript, Display))
+		{
+			return;
+		}
+
+		TStringBuilder<512> ReturnText;
+		ReturnValue.AppendDebugString(ReturnText, DebugStringLogMaxDepth, DebugStringLogMaxLength);
+		UE_LOG(LogMagicScript, Display, TEXT("%s: %s() finished. Return: %s, PeakSpace: %lld bytes, Complexity: %s"),
+			Prefix, *FuncName, ReturnText.ToString(), PeakBytes, *TimeComplexity.ToString());
+	}
+}
+
 void UMagicScriptInterpreterSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	// 전역 로그 헬퍼가 매번 WorldContext를 순회하지 않도록 한 번만 등록
+	MagicScript::SetDefaultScriptHost(this);
+	SpellComplexityCache = MakeShared<FTimeComplexityCache>();
+	ModuleGraph = MakeShared<FModuleGraph>(this,
+		[this](const FString& ModulePath) -> TSharedPtr<FProgram>
+		{
+			// 스크립트로 직접 실행한 적이 있으면 파싱 결과를 같이 씀
+			FScriptRecord& Record = FindOrAddRecord_Internal(ModulePath);
+			if (Record.Program.IsValid())
+			{
+				return Record.Program;
+			}
+
+			if (!LoadScriptSource_Internal(Record))
+			{
+				return nullptr;
+			}
+
+			FLexer ModLexer(Record.Source);
+			FParser ModParser(ModLexer, this, ModulePath);
+			return Parsing_Internal(ModParser, Record) ? Record.Program : nullptr;
+		},
+		[this](const FString& ModulePath)
+		{
+			const TSharedPtr<FInterpreter> Interpreter = CreateInterpreter_Internal(ModulePath);
+			AttachProfiler_Internal(FindOrAddRecord_Internal(ModulePath), Interpreter);
+			return Interpreter;
+		});
+
+#if MAGICSCRIPT_WITH_DIRECTORY_WATCHER
+	// Saved 폴더 아래 파일이 바뀌면 캐시된 스크립트만 내용 해시로 비교
+	FDirectoryWatcherModule& WatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	if (IDirectoryWatcher* Watcher = WatcherModule.Get())
+	{
+		Watcher->RegisterDirectoryChangedCallback_Handle(FPaths::ProjectSavedDir(),
+			IDirectoryWatcher::FDirectoryChanged::CreateUObject(this, &UMagicScriptInterpreterSubsystem::OnScriptFilesChanged_Internal),
+			ScriptDirectoryWatcherHandle);
+	}
+#endif
+
+	bInitialized = true;
 }
 
 void UMagicScriptInterpreterSubsystem::Deinitialize()
 {
+	FlushScriptLogs();
+	bInitialized = false;
+	MagicScript::ClearDefaultScriptHost(this);
+
+#if MAGICSCRIPT_WITH_DIRECTORY_WATCHER
+	if (ScriptDirectoryWatcherHandle.IsValid())
+	{
+		if (FDirectoryWatcherModule* WatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+		{
+			if (IDirectoryWatcher* Watcher = WatcherModule->Get())
+			{
+				Watcher->UnregisterDirectoryChangedCallback_Handle(FPaths::ProjectSavedDir(), ScriptDirectoryWatcherHandle);
+			}
+		}
+		ScriptDirectoryWatcherHandle.Reset();
+	}
+#endif
+
 	Super::Deinitialize();
 }
 
+void UMagicScriptInterpreterSubsystem::Tick(float DeltaTime)
+{
+#if !MAGICSCRIPT_WITH_DIRECTORY_WATCHER
+	PollScriptFiles_Internal(DeltaTime);
+#endif
+	UpdateScriptLogListener_Internal();
+	TickScriptSlices_Internal();
+	FlushScriptLogs();
+
+	if (GarbageCollectionBudget > 0)
+	{
+		ForEachInterpreter_Internal([this](const TSharedPtr<FInterpreter>& Interpreter)
+		{
+			Interpreter->StepGarbageCollection(GarbageCollectionBudget);
+		});
+	}
+}
+
+TStatId UMagicScriptInterpreterSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMagicScriptInterpreterSubsystem, STATGROUP_Tickables);
+}
+
+ETickableTickType UMagicScriptInterpreterSubsystem::GetTickableTickType() const
+{
+	// CDO는 틱하지 않음
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
 UMagicScriptInterpreterSubsystem* UMagicScriptInterpreterSubsystem::Get(const UObject* WorldContextObject)
 {
 	if (!WorldContextObject)
@@ -45,198 +208,729 @@ UMagicScriptInterpreterSubsystem* UMagicScriptInterpreterSubsystem::Get(const UO
 	return nullptr;
 }
 
-void UMagicScriptInterpreterSubsystem::AddScriptLog(const EScriptLogType ScriptLogType, const FString& ScriptLogMessage)
+bool UMagicScriptInterpreterSubsystem::ShouldCaptureScriptLog(const EScriptLogType ScriptLogType) const
+{
+	if (static_cast<uint8>(ScriptLogType) < static_cast<uint8>(MinScriptLogType.load(std::memory_order_relaxed)))
+	{
+		return false;
+	}
+	if (bStoreScriptLogs.load(std::memory_order_relaxed))
+	{
+		return true;
+	}
+
+	// 델리게이트는 게임 스레드에서만 직접 확인, 다른 스레드는 마지막 틱에 반영된 값을 사용
+	return IsInGameThread() ? HasScriptLogListener_Internal() : bHasScriptLogListener.load(std::memory_order_relaxed);
+}
+
+bool UMagicScriptInterpreterSubsystem::HasScriptLogListener_Internal() const
+{
+	// 건별 델리게이트와 틱 단위 묶음 델리게이트 모두 리스너로 봄
+	return OnScriptLogAdded.IsBound() || OnScriptLogsFlushed.IsBound();
+}
+
+void UMagicScriptInterpreterSubsystem::UpdateScriptLogListener_Internal()
 {
+	check(IsInGameThread());
+	bHasScriptLogListener.store(HasScriptLogListener_Internal(), std::memory_order_relaxed);
+}
+
+void UMagicScriptInterpreterSubsystem::AddScriptLog(const EScriptLogType ScriptLogType, const FString& ScriptLogMessage,
+	const FName ScriptId, const int32 Line, const int32 Column)
+{
+	if (!ShouldCaptureScriptLog(ScriptLogType))
+	{
+		return;
+	}
+
 	FScriptLog Log;
 	Log.LogType = ScriptLogType;
 	Log.LogMessage = ScriptLogMessage;
-	ScriptLogs.Add(Log);
-	
-	// Delegate를 통해 바인딩된 모든 함수 호출
-	OnScriptLogAdded.Broadcast(Log);
+	Log.ScriptId = ScriptId;
+	Log.Line = Line;
+	Log.Column = Column;
+
+	// 큐가 가득 차면 버리고 다음 플러시에서 버린 개수를 알림
+	if (!PendingScriptLogs.TryPush(MoveTemp(Log)))
+	{
+		DroppedScriptLogCount.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void UMagicScriptInterpreterSubsystem::FlushScriptLogs()
+{
+	check(IsInGameThread());
+
+	TArray<FScriptLog> Batch;
+	FScriptLog Log;
+	while (PendingScriptLogs.TryPop(Log))
+	{
+		Batch.Add(MoveTemp(Log));
+	}
+
+	const int32 Dropped = DroppedScriptLogCount.exchange(0, std::memory_order_relaxed);
+	if (Dropped > 0)
+	{
+		FScriptLog DroppedLog;
+		DroppedLog.LogType = EScriptLogType::Warning;
+		DroppedLog.LogMessage = FString::Printf(TEXT("MagicScript: %d log(s) dropped (log queue full)"), Dropped);
+		Batch.Add(MoveTemp(DroppedLog));
+	}
+
+	if (Batch.Num() == 0)
+	{
+		return;
+	}
+
+	if (bStoreScriptLogs.load(std::memory_order_relaxed))
+	{
+		ScriptLogs.Append(Batch);
+
+		// 오래된 로그부터 제거해 최대 개수 유지
+		const int32 Overflow = ScriptLogs.Num() - MaxStoredScriptLogs;
+		if (Overflow > 0)
+		{
+			ScriptLogs.RemoveAt(0, Overflow);
+		}
+	}
+
+	// Delegate를 통해 바인딩된 모든 함수 호출 (틱당 한 번 묶어서)
+	if (OnScriptLogAdded.IsBound())
+	{
+		for (const FScriptLog& Each : Batch)
+		{
+			OnScriptLogAdded.Broadcast(Each);
+		}
+	}
+	OnScriptLogsFlushed.Broadcast(Batch);
+
+	// 브로드캐스트 중에 바인딩이 바뀌었을 수 있으므로 다시 반영
+	UpdateScriptLogListener_Internal();
+}
+
+void UMagicScriptInterpreterSubsystem::ClearScriptLogs()
+{
+	// 대기 중인 로그도 함께 비움
+	FScriptLog Discard;
+	while (PendingScriptLogs.TryPop(Discard))
+	{
+	}
+	DroppedScriptLogCount.store(0, std::memory_order_relaxed);
+	ScriptLogs.Empty();
+}
+
+FMagicScriptHandle UMagicScriptInterpreterSubsystem::ResolveScript(const FString& RelativePath)
+{
+	return FindOrAddRecord_Internal(RelativePath).Handle;
+}
+
+const FString& UMagicScriptInterpreterSubsystem::GetScriptPath(const FMagicScriptHandle Script) const
+{
+	static const FString InvalidPath;
+	const FScriptRecord* Record = GetRecord_Internal(Script);
+	return Record ? Record->Path : InvalidPath;
 }
 
 bool UMagicScriptInterpreterSubsystem::RunScriptFile(const FString& RelativePath, const FString& FuncName, const FScriptExecutionContext& ExecutionContext)
 {
+	return RunScript(ResolveScript(RelativePath), FuncName, ExecutionContext);
+}
+
+bool UMagicScriptInterpreterSubsystem::RunScript(const FMagicScriptHandle Script, const FString& FuncName, const FScriptExecutionContext& ExecutionContext)
+{
+	FScriptRecord* Record = GetRecord_Internal(Script);
+	if (!Record)
+	{
+		AddScriptLog(EScriptLogType::Warning, TEXT("MagicScript: Invalid script handle"));
+		return false;
+	}
+
+	MS_TRACE_SCOPE(TEXT("RunScriptFile"), Record->Path, FuncName);
+
+	if (Record->SlicedRun.IsSet())
+	{
+		AddScriptLog(EScriptLogType::Warning,
+			FString::Printf(TEXT("MagicScript: Sliced execution is still pending: %s"), *Record->Path), Record->ScriptId);
+		return false;
+	}
+
 	const double StartTime = FPlatformTime::Seconds();
-	FString Source;
 	
-	if (!CheckScriptByPath(RelativePath, Source))
+	if (!LoadScriptSource_Internal(*Record))
 	{
 		return false;
 	}
 	
-	// 0) 캐시 확인 (상대 경로를 키로 사용)
-	if (CheckCache_Internal(RelativePath, FuncName,
+	// 0) 캐시 확인 (레코드에 프로그램/인터프리터가 남아 있으면 재사용)
+	if (CheckCache_Internal(*Record, FuncName,
 		const_cast<FScriptExecutionContext&>(ExecutionContext)))
 	{
 		return true;  // 캐시에서 실행 성공
 	}
 
-	// 1) 렉싱
-	FLexer Lexer(Source);
-	TArray<FToken> Tokens;
-	if (!Lexer_Internal(Lexer, Tokens, RelativePath))
+	// 1~4) 컴파일 + 정적 분석 + import + 전역 코드 실행
+	FTimeComplexityResult TimeComplexity;
+	if (!InitializeScript_Internal(*Record, TimeComplexity,
+		const_cast<FScriptExecutionContext&>(ExecutionContext)))
 	{
 		return false;
 	}
+	
+	// 5) 함수 실행 및 동적 분석
+	RunScript_Internal(TimeComplexity, *Record, FuncName,
+		const_cast<FScriptExecutionContext&>(ExecutionContext));
+
+	const double EndTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogMagicScript, Display, TEXT("%s Script %s Function GeneratedTime : %f"), *Record->Path, *FuncName, EndTime - StartTime);
+	
+	return true;
+}
 
-	// 2) 파싱 (상대 경로를 키로 사용)
-	FParser Parser(Tokens);
-	if (!Parsing_Internal(Parser, RelativePath))
+bool UMagicScriptInterpreterSubsystem::RunScriptFileSliced(const FString& RelativePath, const FString& FuncName, const FScriptExecutionContext& ExecutionContext)
+{
+	return RunScriptSliced(ResolveScript(RelativePath), FuncName, ExecutionContext);
+}
+
+bool UMagicScriptInterpreterSubsystem::RunScriptSliced(const FMagicScriptHandle Script, const FString& FuncName, const FScriptExecutionContext& ExecutionContext)
+{
+	FScriptRecord* Record = GetRecord_Internal(Script);
+	if (!Record)
 	{
+		AddScriptLog(EScriptLogType::Warning, TEXT("MagicScript: Invalid script handle"));
 		return false;
 	}
 
-	// 3) 정적 분석 (AST 기반 시간 복잡도 계산)
-	TSharedPtr<FProgram> Program = ProgramCache[RelativePath];
-	FTimeComplexityResult TimeComplexity = FTimeComplexityAnalyzer::AnalyzeProgram(Program);
+	MS_TRACE_SCOPE(TEXT("RunScriptFile"), Record->Path, FuncName);
 
-	// 4) 인터프리터 생성 + 네이티브 함수 등록 (상대 경로를 키로 사용)
-	RegisterBuiltins_Internal(RelativePath);
+	if (Record->SlicedRun.IsSet())
+	{
+		AddScriptLog(EScriptLogType::Warning,
+			FString::Printf(TEXT("MagicScript: Sliced execution is still pending: %s"), *Record->Path), Record->ScriptId);
+		return false;
+	}
 
-	// --- import 처리 ---
-	if (!Import_Internal(Program, ExecutionContext))
+	if (!LoadScriptSource_Internal(*Record))
 	{
 		return false;
 	}
 
-	// 전역 코드 실행
-	InterpreterCache[RelativePath]->ExecuteProgram(Program, ExecutionContext);
-	
-	// 5) 함수 실행 및 동적 분석 (상대 경로를 키로 사용)
-	RunScript_Internal(TimeComplexity, RelativePath, FuncName,
-		const_cast<FScriptExecutionContext&>(ExecutionContext));
+	// 캐시된 프로그램이 있으면 렉싱/파싱/분석/import를 건너뜀 (RunScript의 캐시 경로와 동일)
+	const bool bFreshlyCompiled = !Record->Program.IsValid() || !Record->Interpreter.IsValid();
 
-	const double EndTime = FPlatformTime::Seconds();
+	TSharedPtr<FTimeComplexityResult> TimeComplexity = Record->TimeComplexity;
+	if (bFreshlyCompiled)
+	{
+		FLexer Lexer(Record->Source);
+		FParser Parser(Lexer, this, Record->Path);
+		if (!Parsing_Internal(Parser, *Record))
+		{
+			return false;
+		}
+	}
 
-	UE_LOG(LogTemp, Display, TEXT("%s Script %s Function GeneratedTime : %f"), *RelativePath, *FuncName, EndTime - StartTime);
-	
+	const TSharedPtr<FProgram> Program = Record->Program;
+	RegisterBuiltins_Internal(*Record);
+	const TSharedPtr<FInterpreter> Interpreter = Record->Interpreter;
+
+	if (bFreshlyCompiled)
+	{
+		MS_TRACE_SCOPE(TEXT("Analysis"), Record->Path);
+		TimeComplexity = MakeShared<FTimeComplexityResult>(FTimeComplexityAnalyzer::AnalyzeProgram(Program,
+			Interpreter->GetGlobalEnv(), SpellComplexityCache.Get()));
+	}
+	else if (!TimeComplexity.IsValid())
+	{
+		TimeComplexity = MakeShared<FTimeComplexityResult>();
+	}
+
+	FScriptExecutionContext Context = ExecutionContext;
+	Context.Interpreter = Interpreter;
+	AttachProfiler_Internal(*Record);
+
+	// 처음 import되는 모듈의 전역 코드는 준비 단계에서 한 번에 실행하고 export를 바인딩
+	if (bFreshlyCompiled && !Import_Internal(Program, Context))
+	{
+		// export가 묶이지 않은 프로그램이 캐시로 재사용되지 않도록 버림
+		EvictScript_Internal(*Record);
+		return false;
+	}
+
+	if (!Interpreter->BeginProgramSlices(Program, Context))
+	{
+		return false;
+	}
+
+	FSlicedScriptRun& Run = Record->SlicedRun.Emplace();
+	Run.FuncName = FuncName;
+	Run.ExecutionContext = MoveTemp(Context);
+	Run.TimeComplexity = TimeComplexity;
 	return true;
 }
 
+FMagicScriptPreparedCall UMagicScriptInterpreterSubsystem::PrepareCall(const FMagicScriptHandle Script, const FString& SpellName,
+	const FScriptExecutionContext& ExecutionContext)
+{
+	FMagicScriptPreparedCall Call;
+	Call.Script = Script;
+	Call.SpellName = SpellName;
+
+	if (FScriptRecord* Record = GetRecord_Internal(Script))
+	{
+		BindPreparedCall_Internal(*Record, Call, ExecutionContext);
+	}
+	else
+	{
+		AddScriptLog(EScriptLogType::Warning, TEXT("MagicScript: Invalid script handle"));
+	}
+	return Call;
+}
+
+FValue UMagicScriptInterpreterSubsystem::Invoke(FMagicScriptPreparedCall& Call, const TArrayView<const FValue> Args,
+	const FScriptExecutionContext& ExecutionContext)
+{
+	FScriptRecord* Record = GetRecord_Internal(Call.Script);
+	if (!Record)
+	{
+		AddScriptLog(EScriptLogType::Warning, TEXT("MagicScript: Invalid script handle"));
+		return FValue::Null();
+	}
+
+	// 묶은 뒤 캐시가 비워졌으면(스크립트 수정 등) 새 인터프리터에서 다시 준비
+	if (!Call.IsValid() || Call.Generation != Record->Generation)
+	{
+		if (!BindPreparedCall_Internal(*Record, Call, ExecutionContext))
+		{
+			return FValue::Null();
+		}
+	}
+
+	// 실행 중 캐시가 비워져도 끝까지 쓰도록 복사해 둠
+	const TSharedPtr<FInterpreter> Interpreter = Call.Interpreter;
+	if (ExecutionContext.Interpreter == Interpreter)
+	{
+		return Interpreter->InvokeFunction(Call.Function, Args, ExecutionContext);
+	}
+
+	FScriptExecutionContext Context = ExecutionContext;
+	Context.Interpreter = Interpreter;
+	return Interpreter->InvokeFunction(Call.Function, Args, Context);
+}
+
+FMagicScriptPreparedCall UMagicScriptInterpreterSubsystem::PrepareScriptCall(const FString& RelativePath, const FString& SpellName)
+{
+	return PrepareCall(ResolveScript(RelativePath), SpellName);
+}
+
+FMagicScriptValue UMagicScriptInterpreterSubsystem::InvokeScriptCall(FMagicScriptPreparedCall& Call, const TArray<FMagicScriptValue>& Arguments)
+{
+	TArray<FValue, TInlineAllocator<8>> Args;
+	Args.Reserve(Arguments.Num());
+	for (const FMagicScriptValue& Argument : Arguments)
+	{
+		Args.Add(ToScriptValue(Argument));
+	}
+	return ToBlueprintValue(Invoke(Call, Args));
+}
+
+bool UMagicScriptInterpreterSubsystem::IsScriptSlicePending(const FString& RelativePath) const
+{
+	const FScriptRecord* Record = FindRecord_Internal(RelativePath);
+	return Record && Record->SlicedRun.IsSet();
+}
+
+void UMagicScriptInterpreterSubsystem::CancelScriptSlice(const FString& RelativePath)
+{
+	FScriptRecord* Record = FindRecord_Internal(RelativePath);
+	if (!Record || !Record->SlicedRun.IsSet())
+	{
+		return;
+	}
+
+	Record->SlicedRun.Reset();
+	if (Record->Interpreter.IsValid())
+	{
+		Record->Interpreter->CancelSlice();
+	}
+}
+
+void UMagicScriptInterpreterSubsystem::SetMaxCallDepth(const int32 InMaxCallDepth)
+{
+	MaxCallDepth = FMath::Max(1, InMaxCallDepth);
+	ForEachInterpreter_Internal([this](const TSharedPtr<FInterpreter>& Interpreter)
+	{
+		Interpreter->SetMaxCallDepth(MaxCallDepth);
+	});
+}
+
+void UMagicScriptInterpreterSubsystem::SetDefaultExecutionBudget(const FScriptExecutionBudget& InBudget)
+{
+	DefaultExecutionBudget = InBudget;
+	ForEachInterpreter_Internal([this](const TSharedPtr<FInterpreter>& Interpreter)
+	{
+		Interpreter->SetDefaultExecutionBudget(DefaultExecutionBudget);
+	});
+}
+
 void UMagicScriptInterpreterSubsystem::ClearScriptCache(const FString& RelativePath)
 {
-	ProgramCache.Remove(RelativePath);
-	InterpreterCache.Remove(RelativePath);
-	PrevTimeComplexityCache.Remove(RelativePath);
-	PrevSpaceComplexityCache.Remove(RelativePath);
+	if (FScriptRecord* Record = FindRecord_Internal(RelativePath))
+	{
+		ClearScriptCache_Internal(*Record);
+	}
+}
+
+void UMagicScriptInterpreterSubsystem::ClearScriptCache_Internal(FScriptRecord& Record)
+{
+	// import한 쪽은 바뀐 모듈의 export를 바인딩해 두었으므로 같이 비움 (관계없는 스크립트는 유지)
+	TArray<int32> Dependents;
+	CollectDependents_Internal(Record, Dependents);
+
+	EvictScript_Internal(Record);
+	for (const int32 Dependent : Dependents)
+	{
+		EvictScript_Internal(*ScriptRecords[Dependent]);
+	}
+}
+
+void UMagicScriptInterpreterSubsystem::GetDependentScripts(const FString& RelativePath, TArray<FString>& OutPaths) const
+{
+	const FScriptRecord* Record = FindRecord_Internal(RelativePath);
+	if (!Record)
+	{
+		return;
+	}
+
+	TArray<int32> Dependents;
+	CollectDependents_Internal(*Record, Dependents);
+	for (const int32 Dependent : Dependents)
+	{
+		OutPaths.Add(ScriptRecords[Dependent]->Path);
+	}
+}
+
+void UMagicScriptInterpreterSubsystem::CollectDependents_Internal(const FScriptRecord& Record, TArray<int32>& OutIndices) const
+{
+	// 역방향 import 그래프를 너비 우선으로 따라감 (OutIndices를 큐로 사용)
+	TSet<int32> Seen;
+	Seen.Add(Record.Handle.Index);
+
+	const int32 FirstIndex = OutIndices.Num();
+	const TSet<int32>* Importers = &Record.Dependents;
+	for (int32 Index = FirstIndex; ; ++Index)
+	{
+		for (const int32 Importer : *Importers)
+		{
+			bool bAlreadySeen = false;
+			Seen.Add(Importer, &bAlreadySeen);
+			if (!bAlreadySeen)
+			{
+				OutIndices.Add(Importer);
+			}
+		}
+
+		if (Index >= OutIndices.Num())
+		{
+			break;
+		}
+		Importers = &ScriptRecords[OutIndices[Index]]->Dependents;
+	}
+}
+
+void UMagicScriptInterpreterSubsystem::EvictScript_Internal(FScriptRecord& Record)
+{
+	// 멈춰 있는 프레임이 실행 컨텍스트로 인터프리터 자신을 붙잡고 있으므로 먼저 정리 (이벤트 루프 콜백 포함)
+	Record.SlicedRun.Reset();
+	if (Record.Interpreter.IsValid())
+	{
+		Record.Interpreter->CancelSlice();
+	}
+
+	Record.Program.Reset();
+	Record.Interpreter.Reset();
+	Record.bTopLevelExecuted = false;
+	++Record.Generation;
+	Record.TimeComplexity.Reset();
+	Record.PeakSpaceBytes = 0;
+	if (ModuleGraph.IsValid())
+	{
+		ModuleGraph->Invalidate(Record.Path);
+	}
 }
 
 double UMagicScriptInterpreterSubsystem::GetTimeComplexityCache(
 	const FString& RelativePath) const
 {
-	if (!PrevTimeComplexityCache.FindRef(RelativePath))
+	const FScriptRecord* Record = FindRecord_Internal(RelativePath);
+	if (!Record || !Record->TimeComplexity.IsValid())
 	{
 		return 0;
 	}
 
-	return PrevTimeComplexityCache[RelativePath].Get()->StaticComplexityScore;
+	return Record->TimeComplexity->StaticComplexityScore;
 }
 
 int64 UMagicScriptInterpreterSubsystem::GetSpaceComplexityCache(
 	const FString& RelativePath) const
 {
-	if (!PrevSpaceComplexityCache.FindRef(RelativePath))
+	const FScriptRecord* Record = FindRecord_Internal(RelativePath);
+	return Record ? Record->PeakSpaceBytes : 0;
+}
+
+void UMagicScriptInterpreterSubsystem::SetProfilingEnabled(const bool bEnabled)
+{
+	bProfilingEnabled = bEnabled;
+
+	// 끄는 경우 이미 연결된 프로파일러를 바로 분리 (결과는 유지)
+	if (!bProfilingEnabled)
 	{
-		return 0;
+		ForEachInterpreter_Internal([](const TSharedPtr<FInterpreter>& Interpreter)
+		{
+			Interpreter->SetProfiler(nullptr);
+		});
 	}
+}
 
-	return PrevSpaceComplexityCache[RelativePath];
+TSharedPtr<FScriptProfiler> UMagicScriptInterpreterSubsystem::GetScriptProfiler(const FString& RelativePath) const
+{
+	const FScriptRecord* Record = FindRecord_Internal(RelativePath);
+	return Record ? Record->Profiler : nullptr;
+}
+
+void UMagicScriptInterpreterSubsystem::ResetScriptProfiles()
+{
+	for (const TUniquePtr<FScriptRecord>& Record : ScriptRecords)
+	{
+		Record->Profiler.Reset();
+	}
+}
+
+bool UMagicScriptInterpreterSubsystem::SaveScriptProfile(const FString& RelativePath, const FString& OutFilePath,
+	const EScriptProfileFormat Format) const
+{
+	const TSharedPtr<FScriptProfiler> Profiler = GetScriptProfiler(RelativePath);
+	if (!Profiler.IsValid())
+	{
+		UE_LOG(LogMagicScript, Warning, TEXT("MagicScript: No profile recorded for %s"), *RelativePath);
+		return false;
+	}
+	return Profiler->SaveToFile(OutFilePath, Format);
 }
 
 void UMagicScriptInterpreterSubsystem::TickEventLoops()
 {
-	// 모든 인터프리터의 이벤트 루프 업데이트
-	for (auto& Pair : InterpreterCache)
+	// 스크립트와 import된 모듈 인터프리터의 이벤트 루프 업데이트 (모듈 전역 코드가 건 setTimeout 포함)
+	ForEachInterpreter_Internal([this](const TSharedPtr<FInterpreter>& Interpreter)
 	{
-		if (Pair.Value.IsValid())
+		if (bSliceEventLoopCallbacks)
 		{
-			Pair.Value->GetEventLoop().Tick(Pair.Value.Get());
+			Interpreter->GetEventLoop().TickSliced(Interpreter.Get(), ScriptSliceBudget);
 		}
-	}
+		else
+		{
+			Interpreter->GetEventLoop().Tick(Interpreter.Get());
+		}
+	});
+}
+
+int32 UMagicScriptInterpreterSubsystem::CollectScriptGarbage()
+{
+	int32 Collected = 0;
+	ForEachInterpreter_Internal([&Collected](const TSharedPtr<FInterpreter>& Interpreter)
+	{
+		Collected += Interpreter->CollectGarbage();
+	});
+	return Collected;
 }
 
 // ============================================================================
 // Internal Helper Functions
 // ============================================================================
 
+UMagicScriptInterpreterSubsystem::FScriptRecord& UMagicScriptInterpreterSubsystem::FindOrAddRecord_Internal(const FString& RelativePath)
+{
+	if (const int32* Index = ScriptHandles.Find(RelativePath))
+	{
+		return *ScriptRecords[*Index];
+	}
+
+	const int32 Index = ScriptRecords.Add(MakeUnique<FScriptRecord>());
+	FScriptRecord& Record = *ScriptRecords[Index];
+	Record.Handle.Index = Index;
+	Record.Path = RelativePath;
+	Record.ScriptId = FName(*RelativePath);
+	ScriptHandles.Add(RelativePath, Index);
+	return Record;
+}
+
+UMagicScriptInterpreterSubsystem::FScriptRecord* UMagicScriptInterpreterSubsystem::FindRecord_Internal(const FString& RelativePath) const
+{
+	const int32* Index = ScriptHandles.Find(RelativePath);
+	return Index ? ScriptRecords[*Index].Get() : nullptr;
+}
+
+UMagicScriptInterpreterSubsystem::FScriptRecord* UMagicScriptInterpreterSubsystem::GetRecord_Internal(const FMagicScriptHandle Script) const
+{
+	return ScriptRecords.IsValidIndex(Script.Index) ? ScriptRecords[Script.Index].Get() : nullptr;
+}
+
 bool UMagicScriptInterpreterSubsystem::CheckScriptByPath(const FString& ScriptPath, FString& Source)
 {
-	FString ScriptFilePath = FPaths::ProjectSavedDir() / ScriptPath;
-	
-	if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*ScriptFilePath))
+	FScriptRecord& Record = FindOrAddRecord_Internal(ScriptPath);
+	if (!LoadScriptSource_Internal(Record))
 	{
-		AddScriptLog(EScriptLogType::Warning, FString::Printf(TEXT("MagicScript: File not found: %s"), *ScriptFilePath));
 		return false;
 	}
 
-	if (ScriptCache.Find(ScriptPath))
+	Source = Record.Source;
+	return true;
+}
+
+bool UMagicScriptInterpreterSubsystem::LoadScriptSource_Internal(FScriptRecord& Record)
+{
+	// 캐시된 소스는 파일 감시/폴링이 최신으로 유지하므로 파일 시스템을 거치지 않음
+	if (Record.bSourceLoaded)
 	{
-		Source = ScriptCache[ScriptPath];
 		return true;
 	}
-	
+
+	// 파일이 없으면 읽기가 실패하므로 존재 확인을 따로 하지 않음
+	FString Source;
+	const FString ScriptFilePath = FPaths::ProjectSavedDir() / Record.Path;
 	if (!FFileHelper::LoadFileToString(Source, *ScriptFilePath))
 	{
-		AddScriptLog(EScriptLogType::Warning, FString::Printf(TEXT("MagicScript: Failed to load file: %s"), *ScriptPath));
+		AddScriptLog(EScriptLogType::Warning, FString::Printf(TEXT("MagicScript: File not found: %s"), *ScriptFilePath));
 		return false;
 	}
 
-	SaveScriptCache(ScriptPath, Source);
+	CacheScriptSource_Internal(Record, MoveTemp(Source));
 	return true;
 }
 
 bool UMagicScriptInterpreterSubsystem::SaveScriptCache(const FString& ScriptPath
 	, const FString& Source)
 {
-	if (!ScriptCache.Find(ScriptPath))
-	{
-		ScriptCache.Add(ScriptPath, Source);
-	} else
+	FScriptRecord& Record = FindOrAddRecord_Internal(ScriptPath);
+
+	// 내용이 같으면 컴파일 결과를 유지
+	const bool bChanged = !Record.bSourceLoaded || Record.SourceHash != HashScriptSource(Source);
+
+	const FString ScriptFilePath = FPaths::ProjectSavedDir() / ScriptPath;
+	const bool bSaved = FFileHelper::SaveStringToFile(Source, *ScriptFilePath);
+
+	CacheScriptSource_Internal(Record, Source);
+	if (bChanged)
 	{
-		ScriptCache[ScriptPath] = Source;
+		ClearScriptCache_Internal(Record);
 	}
+	return bSaved;
+}
 
-	ClearScriptCache(ScriptPath);
-	
-	FString ScriptFilePath = FPaths::ProjectSavedDir() / ScriptPath;
-	return FFileHelper::SaveStringToFile(Source, *ScriptFilePath);
+bool UMagicScriptInterpreterSubsystem::RefreshScriptFile(const FString& ScriptPath)
+{
+	FScriptRecord* Record = FindRecord_Internal(ScriptPath);
+	return Record && RefreshScriptFile_Internal(*Record);
 }
 
-bool UMagicScriptInterpreterSubsystem::CheckCache_Internal(const FString& RelativePath, const FString& FuncName, FScriptExecutionContext& ExecutionContext)
+bool UMagicScriptInterpreterSubsystem::RefreshScriptFile_Internal(FScriptRecord& Record)
 {
-	const TSharedPtr<FProgram>* CachedProgramPtr = ProgramCache.Find(RelativePath);
-	if (!CachedProgramPtr)
+	if (!Record.bSourceLoaded)
 	{
+		// 아직 읽지 않은 스크립트는 다음 실행에서 읽음
 		return false;
 	}
 
-	const TSharedPtr<FProgram> Program = *CachedProgramPtr;
-	if (!Program.IsValid())
+	FString Source;
+	const FString ScriptFilePath = FPaths::ProjectSavedDir() / Record.Path;
+	if (!FFileHelper::LoadFileToString(Source, *ScriptFilePath))
 	{
-		return false;
+		// 지워진 파일: 다음 실행에서 다시 찾도록 소스까지 버림
+		Record.bSourceLoaded = false;
+		Record.Source.Empty();
+		Record.SourceHash = 0;
+		Record.FileTimestamp = FDateTime();
+		ClearScriptCache_Internal(Record);
+		return true;
 	}
 
-	const TSharedPtr<FInterpreter>* CachedInterpreterPtr = InterpreterCache.Find(RelativePath);
-	if (!CachedInterpreterPtr)
+	if (Record.SourceHash == HashScriptSource(Source))
 	{
+		// 저장만 다시 했거나 SaveScriptCache로 이미 반영한 내용
+		Record.FileTimestamp = IFileManager::Get().GetTimeStamp(*ScriptFilePath);
 		return false;
 	}
 
-	const TSharedPtr<FInterpreter> Interpreter = *CachedInterpreterPtr;
-	if (!Interpreter.IsValid())
+	UE_LOG(LogMagicScript, Display, TEXT("MagicScript: Script changed on disk, recompiling on next run: %s"), *Record.Path);
+	CacheScriptSource_Internal(Record, MoveTemp(Source));
+	ClearScriptCache_Internal(Record);
+	return true;
+}
+
+void UMagicScriptInterpreterSubsystem::CacheScriptSource_Internal(FScriptRecord& Record, FString Source)
+{
+	Record.SourceHash = HashScriptSource(Source);
+	Record.Source = MoveTemp(Source);
+	Record.bSourceLoaded = true;
+#if !MAGICSCRIPT_WITH_DIRECTORY_WATCHER
+	Record.FileTimestamp = IFileManager::Get().GetTimeStamp(*(FPaths::ProjectSavedDir() / Record.Path));
+#endif
+}
+
+#if MAGICSCRIPT_WITH_DIRECTORY_WATCHER
+void UMagicScriptInterpreterSubsystem::OnScriptFilesChanged_Internal(const TArray<FFileChangeData>& FileChanges)
+{
+	const FString SavedDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir());
+	for (const FFileChangeData& Change : FileChanges)
+	{
+		FString ScriptPath = FPaths::ConvertRelativePathToFull(Change.Filename);
+		if (FPaths::MakePathRelativeTo(ScriptPath, *SavedDir))
+		{
+			RefreshScriptFile(ScriptPath);
+		}
+	}
+}
+#endif
+
+void UMagicScriptInterpreterSubsystem::PollScriptFiles_Internal(const float DeltaTime)
+{
+	if (ScriptFilePollInterval <= 0.0f || ScriptRecords.Num() == 0)
+	{
+		return;
+	}
+
+	ScriptFilePollElapsed += DeltaTime;
+	if (ScriptFilePollElapsed < ScriptFilePollInterval)
+	{
+		return;
+	}
+	ScriptFilePollElapsed = 0.0f;
+
+	for (const TUniquePtr<FScriptRecord>& Record : ScriptRecords)
+	{
+		if (Record->bSourceLoaded
+			&& IFileManager::Get().GetTimeStamp(*(FPaths::ProjectSavedDir() / Record->Path)) != Record->FileTimestamp)
+		{
+			RefreshScriptFile_Internal(*Record);
+		}
+	}
+}
+
+bool UMagicScriptInterpreterSubsystem::CheckCache_Internal(FScriptRecord& Record, const FString& FuncName, FScriptExecutionContext& ExecutionContext)
+{
+	// 실행 중 캐시가 비워져도 끝까지 쓰도록 복사해 둠
+	const TSharedPtr<FProgram> Program = Record.Program;
+	const TSharedPtr<FInterpreter> Interpreter = Record.Interpreter;
+	if (!Program.IsValid() || !Interpreter.IsValid())
 	{
 		return false;
 	}
 
 	// 시간 복잡도 캐시 확인
-	TSharedPtr<FTimeComplexityResult>* CachedTimeComplexity = PrevTimeComplexityCache.Find(RelativePath);
-	if (!CachedTimeComplexity)
+	if (!Record.TimeComplexity.IsValid())
 	{
-		PrevTimeComplexityCache.Add(RelativePath, MakeShared<FTimeComplexityResult>());
-		CachedTimeComplexity = PrevTimeComplexityCache.Find(RelativePath);
+		Record.TimeComplexity = MakeShared<FTimeComplexityResult>();
 	}
+	const TSharedPtr<FTimeComplexityResult> TimeComplexity = Record.TimeComplexity;
 
 	// 기존 시간, 공간 복잡도 캐싱을 기반으로 사전 점검.
 	// 어차피 인 게임 안에서 스크립트를 수정하는 경우는 거의 없고, 있더라도 캐시가 날라가기에 큰 문제는 없다.
@@ -244,180 +938,267 @@ bool UMagicScriptInterpreterSubsystem::CheckCache_Internal(const FString& Relati
 
 	// 기존에 캐싱해둔 프로그램 재실행
 	ExecutionContext.Interpreter = Interpreter;
+	AttachProfiler_Internal(Record, Interpreter);
 	Interpreter->ExecuteProgram(Program, ExecutionContext);
+	Record.bTopLevelExecuted = !Interpreter->IsExecutionAborted();
 	
 	const double ExecStartTime = FPlatformTime::Seconds();
 	const FValue CallFunction = Interpreter->CallFunctionByName(FuncName, {}, ExecutionContext);
 	const double ExecEndTime = FPlatformTime::Seconds();
 
-	const TSharedPtr<FTimeComplexityResult> TimeComplexity = *CachedTimeComplexity;
-	TimeComplexity.Get()->ExecutionTimeSeconds = ExecEndTime - ExecStartTime;
-	TimeComplexity.Get()->DynamicExecutionCount = Interpreter->GetExecutionCount();
-	TimeComplexity.Get()->ExpressionEvaluationCount = Interpreter->GetExpressionEvaluationCount();
-	TimeComplexity.Get()->FunctionCallCount = Interpreter->GetFunctionCallCount();
+	TimeComplexity->ExecutionTimeSeconds = ExecEndTime - ExecStartTime;
+	TimeComplexity->DynamicExecutionCount = Interpreter->GetExecutionCount();
+	TimeComplexity->ExpressionEvaluationCount = Interpreter->GetExpressionEvaluationCount();
+	TimeComplexity->FunctionCallCount = Interpreter->GetFunctionCallCount();
 
 	const int64 PeakBytes = Interpreter->GetPeakSpaceBytes();
-	PrevSpaceComplexityCache.Add(RelativePath, PeakBytes);
+	Record.PeakSpaceBytes = PeakBytes;
 	Interpreter->ResetSpaceTracking();
 
-	if (ExecutionContext.Mode == EExecutionMode::PreAnalysis)
+	LogScriptFinished(ExecutionContext.Mode == EExecutionMode::PreAnalysis
+		? TEXT("MagicScript PreAnalysis (cached)") : TEXT("MagicScript (cached)"),
+		FuncName, CallFunction, PeakBytes, *TimeComplexity);
+	
+	return true;
+}
+
+bool UMagicScriptInterpreterSubsystem::InitializeScript_Internal(FScriptRecord& Record,
+	FTimeComplexityResult& OutTimeComplexity, FScriptExecutionContext& ExecutionContext)
+{
+	// 1~2) 렉싱 + 파싱 (파서가 렉서에서 토큰을 당겨 옴)
+	FLexer Lexer(Record.Source);
+	FParser Parser(Lexer, this, Record.Path);
+	if (!Parsing_Internal(Parser, Record))
 	{
-		UE_LOG(LogTemp, Display, TEXT("%s"), *FString::Printf(TEXT(
-			"MagicScript PreAnalysis (cached): %s() finished. Return: %s, PeakSpace: %lld bytes, Complexity: %s"),
-			*FuncName, *CallFunction.ToDebugString(), PeakBytes, *TimeComplexity.Get()->ToString()));
-		return true;
+		return false;
 	}
-	
-	UE_LOG(LogTemp, Display, TEXT("%s"), *FString::Printf(TEXT(
-		"MagicScript (cached): %s() finished. Return: %s, PeakSpace: %lld bytes, Complexity: %s"),
-		*FuncName, *CallFunction.ToDebugString(), PeakBytes, *TimeComplexity.Get()->ToString()));
-	
+
+	// 3) 인터프리터 생성 + 네이티브 함수 등록
+	const TSharedPtr<FProgram> Program = Record.Program;
+	RegisterBuiltins_Internal(Record);
+	const TSharedPtr<FInterpreter> Interpreter = Record.Interpreter;
+
+	// 4) 정적 분석 (AST 기반 시간 복잡도 계산, 네이티브 spell 비용은 등록된 점수로 판단)
+	{
+		MS_TRACE_SCOPE(TEXT("Analysis"), Record.Path);
+		OutTimeComplexity = FTimeComplexityAnalyzer::AnalyzeProgram(Program,
+			Interpreter->GetGlobalEnv(), SpellComplexityCache.Get());
+	}
+
+	// 전역 코드에서도 네이티브 함수가 스크립트 콜백을 호출할 수 있도록 인터프리터 지정
+	ExecutionContext.Interpreter = Interpreter;
+	AttachProfiler_Internal(Record);
+
+	// --- import 처리 ---
+	if (!Import_Internal(Program, ExecutionContext))
+	{
+		// import가 실패한 프로그램을 캐시에 남기면 다음 실행이 export 없이 캐시 경로를 탐
+		EvictScript_Internal(Record);
+		return false;
+	}
+
+	// 전역 코드 실행 (런타임 에러로 멈추면 준비된 호출은 묶지 않음)
+	Interpreter->ExecuteProgram(Program, ExecutionContext);
+	Record.bTopLevelExecuted = !Interpreter->IsExecutionAborted();
 	return true;
 }
 
-bool UMagicScriptInterpreterSubsystem::Lexer_Internal(FLexer& Lexer, TArray<FToken>& Tokens, const FString& ScriptPath)
+bool UMagicScriptInterpreterSubsystem::BindPreparedCall_Internal(FScriptRecord& Record, FMagicScriptPreparedCall& Call,
+	const FScriptExecutionContext& ExecutionContext)
 {
-	Tokens = Lexer.Tokenize();
+	Call.Interpreter.Reset();
+	Call.Function.Reset();
 
-	for (const FToken& Tok : Tokens)
+	// 전역 코드를 이미 실행한 인터프리터가 있으면 그대로 씀 (RunScript로 실행한 스크립트 포함)
+	if (!Record.bTopLevelExecuted || !Record.Program.IsValid() || !Record.Interpreter.IsValid())
 	{
-		if (Tok.Type == ETokenType::Error)
+		if (Record.SlicedRun.IsSet())
+		{
+			AddScriptLog(EScriptLogType::Warning,
+				FString::Printf(TEXT("MagicScript: Sliced execution is still pending: %s"), *Record.Path), Record.ScriptId);
+			return false;
+		}
+
+		if (!LoadScriptSource_Internal(Record))
 		{
-			AddScriptLog(EScriptLogType::Error,
-				FString::Printf(TEXT("MagicScript Lex Error %s(%d:%d): %s"),
-				*ScriptPath, Tok.Location.Line, Tok.Location.Column, *Tok.Lexeme));
 			return false;
 		}
+
+		FScriptExecutionContext Context = ExecutionContext;
+		const TSharedPtr<FTimeComplexityResult> TimeComplexity = MakeShared<FTimeComplexityResult>();
+		if (!InitializeScript_Internal(Record, *TimeComplexity, Context) || !Record.bTopLevelExecuted)
+		{
+			return false;
+		}
+		Record.TimeComplexity = TimeComplexity;
+		Record.PeakSpaceBytes = Record.Interpreter->GetPeakSpaceBytes();
 	}
-	
+
+	const FEnvironment::FEntry* Entry = Record.Interpreter->GetGlobalEnv()->Lookup(Call.SpellName);
+	if (!Entry || Entry->Value.Type != EValueType::Function || !Entry->Value.Function.IsValid())
+	{
+		AddScriptLog(EScriptLogType::Error,
+			FString::Printf(TEXT("MagicScript Runtime Error: Function '%s' is not defined in %s"), *Call.SpellName, *Record.Path),
+			Record.ScriptId);
+		return false;
+	}
+
+	Call.Interpreter = Record.Interpreter;
+	Call.Function = Entry->Value.Function;
+	Call.Generation = Record.Generation;
 	return true;
 }
 
-bool UMagicScriptInterpreterSubsystem::Parsing_Internal(FParser& Parser, const FString& RelativePath)
+bool UMagicScriptInterpreterSubsystem::Parsing_Internal(FParser& Parser, FScriptRecord& Record)
 {
+	MS_TRACE_SCOPE(TEXT("Parse"), Record.Path);
+
 	TSharedPtr<FProgram> Program = Parser.ParseProgram();
-	
+
+	// 렉스 에러는 파서가 위치와 함께 이미 남김
+	if (Parser.HasLexError())
+	{
+		return false;
+	}
+
 	if (!Program.IsValid() || Parser.HasError())
 	{
 		AddScriptLog(EScriptLogType::Error,
-			FString::Printf(TEXT("MagicScript: Failed to parse script: %s"), *RelativePath));
+			FString::Printf(TEXT("MagicScript: Failed to parse script: %s"), *Record.Path), Record.ScriptId);
 		return false;
 	}
 
-	if (ProgramCache.Find(RelativePath))
+	Record.Program = Program;
+	UpdateScriptImports_Internal(Record, *Program);
+	return true;
+}
+
+void UMagicScriptInterpreterSubsystem::UpdateScriptImports_Internal(FScriptRecord& Record, const FProgram& Program)
+{
+	TArray<FString> ImportPaths;
+	FModuleGraph::CollectImports(Program, ImportPaths);
+
+	// 이전 import 간선을 지우고 새로 연결 (import 대상 레코드는 아직 읽지 않았어도 만들어 둠)
+	for (const int32 OldImport : Record.Imports)
 	{
-		ProgramCache[RelativePath] = Program;
+		ScriptRecords[OldImport]->Dependents.Remove(Record.Handle.Index);
 	}
-	else
+	Record.Imports.Reset();
+
+	for (const FString& ImportPath : ImportPaths)
 	{
-		ProgramCache.Add(RelativePath, Program);
+		FScriptRecord& Imported = FindOrAddRecord_Internal(ImportPath);
+		Imported.Dependents.Add(Record.Handle.Index);
+		Record.Imports.Add(Imported.Handle.Index);
 	}
-	return true;
 }
 
 bool UMagicScriptInterpreterSubsystem::Import_Internal(const TSharedPtr<FProgram>& Program, const FScriptExecutionContext& ExecutionContext)
 {
-	TFunction<bool(const TSharedPtr<FProgram>&, TSet<FString>&)> ProcessImports;
-	ProcessImports = [this, &ProcessImports, &ExecutionContext](const TSharedPtr<FProgram>& InProgram, TSet<FString>& Visiting) -> bool
+	// 처음 import되는 모듈만 의존 순서대로 평가하고, 이미 평가한 모듈은 export만 바인딩
+	if (!ModuleGraph.IsValid() || !ModuleGraph->Resolve(Program, ExecutionContext))
 	{
-		for (const FStatementPtr& Stmt : InProgram->Statements)
-		{
-			if (!Stmt.IsValid() || Stmt->Kind != EStatementKind::Import)
-			{
-				continue;
-			}
+		return false;
+	}
 
-			TSharedPtr<FImportStatement> ImportStmt = StaticCastSharedPtr<FImportStatement>(Stmt);
-			const FString ImportRelPath = ImportStmt->Path;
+	if (ExecutionContext.Interpreter.IsValid())
+	{
+		ModuleGraph->Link(Program, ExecutionContext.Interpreter->GetGlobalEnv());
+	}
+	return true;
+}
 
-			if (Visiting.Contains(ImportRelPath))
-			{
-				AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript: Cyclic import detected: %s"), *ImportRelPath));
-				return false;
-			}
+void UMagicScriptInterpreterSubsystem::RunScript_Internal(FTimeComplexityResult& TimeComplexityResult,
+	FScriptRecord& Record, const FString& FuncName, FScriptExecutionContext& ExecutionContext)
+{
+	const TSharedPtr<FInterpreter> Interpreter = Record.Interpreter;
+	ExecutionContext.Interpreter = Interpreter;
+	
+	const double ExecStartTime = FPlatformTime::Seconds();
+	FValue Ret = Interpreter->CallFunctionByName(FuncName, {}, ExecutionContext);
+	const double ExecEndTime = FPlatformTime::Seconds();
 
-			Visiting.Add(ImportRelPath);
+	TimeComplexityResult.DynamicExecutionCount = Interpreter->GetExecutionCount();
+	TimeComplexityResult.ExpressionEvaluationCount = Interpreter->GetExpressionEvaluationCount();
+	TimeComplexityResult.FunctionCallCount = Interpreter->GetFunctionCallCount();
+	TimeComplexityResult.ExecutionTimeSeconds = ExecEndTime - ExecStartTime;
 
-			TSharedPtr<FProgram>* CachedProgramPtr = ProgramCache.Find(ImportRelPath);
-			if (!CachedProgramPtr)
-			{
-				FString ModSource;
-				if (!CheckScriptByPath(ImportRelPath, ModSource))
-				{
-					return false;
-				}
-
-				FLexer ModLexer(ModSource);
-				TArray<FToken> ModTokens;
-				if (!Lexer_Internal(ModLexer, ModTokens, ImportRelPath))
-				{
-					return false;
-				}
-
-				FParser ModParser(ModTokens);
-				if (!Parsing_Internal(ModParser, ImportRelPath))
-				{
-					return false;
-				}
-				
-				CachedProgramPtr = ProgramCache.Find(ImportRelPath);
-			}
+	const int64 PeakBytes = Interpreter->GetPeakSpaceBytes();
+	
+	Record.TimeComplexity = MakeShared<FTimeComplexityResult>(TimeComplexityResult);
+	Record.PeakSpaceBytes = PeakBytes;
 
-			RegisterBuiltins_Internal(ImportRelPath);
+	LogScriptFinished(ExecutionContext.Mode == EExecutionMode::PreAnalysis
+		? TEXT("MagicScript PreAnalysis") : TEXT("MagicScript"),
+		FuncName, Ret, PeakBytes, TimeComplexityResult);
+}
 
-			if (!CachedProgramPtr || !CachedProgramPtr->IsValid())
-			{
-				return false;
-			}
+void UMagicScriptInterpreterSubsystem::TickScriptSlices_Internal()
+{
+	// 이어서 실행한 스크립트가 새 스크립트를 실행하면 레코드가 늘어날 수 있으므로 인덱스로 순회
+	for (int32 Index = 0; Index < ScriptRecords.Num(); ++Index)
+	{
+		FScriptRecord& Record = *ScriptRecords[Index];
+		const TSharedPtr<FInterpreter> Interpreter = Record.Interpreter;
+		if (!Interpreter.IsValid() || !Interpreter->HasPendingSlice())
+		{
+			continue;
+		}
+
+		const double SliceStartTime = FPlatformTime::Seconds();
+		const EScriptSliceState State = Interpreter->ResumeSlice(ScriptSliceBudget);
+
+		// RunScriptSliced로 시작하지 않은 분할 실행(이벤트 루프 콜백)은 이어서 실행만 함
+		if (!Record.SlicedRun.IsSet())
+		{
+			continue;
+		}
+		FSlicedScriptRun& Run = Record.SlicedRun.GetValue();
+
+		if (Run.bCallingFunction)
+		{
+			Run.ExecutionSeconds += FPlatformTime::Seconds() - SliceStartTime;
+		}
+
+		if (State == EScriptSliceState::Suspended)
+		{
+			continue;
+		}
 
-			if (!ProcessImports(*CachedProgramPtr, Visiting))
+		// 전역 코드가 끝났으면 진입 spell을 시작 (실제 실행은 다음 틱부터)
+		if (State == EScriptSliceState::Completed && !Run.bCallingFunction)
+		{
+			Record.bTopLevelExecuted = true;
+			Run.bCallingFunction = true;
+			if (Interpreter->BeginCallSlices(Run.FuncName, {}, Run.ExecutionContext, true))
 			{
-				return false;
+				continue;
 			}
-
-			InterpreterCache[ImportRelPath]->ExecuteProgram(*CachedProgramPtr, ExecutionContext);
 		}
 
-		return true;
-	};
-	
-	TSet<FString> Visited;
-	return ProcessImports(Program, Visited);
+		FinishSlicedRun_Internal(Record, Run, Interpreter->GetSliceResult());
+		Record.SlicedRun.Reset();
+	}
 }
 
-void UMagicScriptInterpreterSubsystem::RunScript_Internal(FTimeComplexityResult& TimeComplexityResult,
-	const FString& RelativePath, const FString& FuncName, FScriptExecutionContext& ExecutionContext)
+void UMagicScriptInterpreterSubsystem::FinishSlicedRun_Internal(FScriptRecord& Record,
+	const FSlicedScriptRun& Run, const FValue& ReturnValue)
 {
-	ExecutionContext.Interpreter = InterpreterCache[RelativePath];
-	
-	const double ExecStartTime = FPlatformTime::Seconds();
-	FValue Ret = InterpreterCache[RelativePath]->CallFunctionByName(FuncName, {}, ExecutionContext);
-	const double ExecEndTime = FPlatformTime::Seconds();
+	const TSharedPtr<FInterpreter> Interpreter = Record.Interpreter;
+	FTimeComplexityResult& TimeComplexity = *Run.TimeComplexity;
 
-	// 스코어 점수에, Native 함수 호출 점수 반영
-	TimeComplexityResult.StaticComplexityScore += InterpreterCache[RelativePath]->GetAccumulatedTimeComplexityScore();
-	TimeComplexityResult.DynamicExecutionCount = InterpreterCache[RelativePath]->GetExecutionCount();
-	TimeComplexityResult.ExpressionEvaluationCount = InterpreterCache[RelativePath]->GetExpressionEvaluationCount();
-	TimeComplexityResult.FunctionCallCount = InterpreterCache[RelativePath]->GetFunctionCallCount();
-	TimeComplexityResult.ExecutionTimeSeconds = ExecEndTime - ExecStartTime;
+	TimeComplexity.DynamicExecutionCount = Interpreter->GetExecutionCount();
+	TimeComplexity.ExpressionEvaluationCount = Interpreter->GetExpressionEvaluationCount();
+	TimeComplexity.FunctionCallCount = Interpreter->GetFunctionCallCount();
+	TimeComplexity.ExecutionTimeSeconds = Run.ExecutionSeconds;
 
-	const TSharedPtr<FTimeComplexityResult> CacheTimeComplexity = MakeShared<FTimeComplexityResult>(TimeComplexityResult);
-	const int64 PeakBytes = InterpreterCache[RelativePath]->GetPeakSpaceBytes();
-	
-	PrevTimeComplexityCache.Add(RelativePath, CacheTimeComplexity);
-	PrevSpaceComplexityCache.Add(RelativePath, PeakBytes);
+	const int64 PeakBytes = Interpreter->GetPeakSpaceBytes();
+	Record.TimeComplexity = Run.TimeComplexity;
+	Record.PeakSpaceBytes = PeakBytes;
 
-	if (ExecutionContext.Mode == EExecutionMode::PreAnalysis)
-	{
-		UE_LOG(LogTemp, Display, TEXT("%s"),
-			*FString::Printf(TEXT("MagicScript PreAnalysis: %s() finished. Return: %s, PeakSpace: %lld bytes, Complexity: %s"),
-		*FuncName, *Ret.ToDebugString(), PeakBytes, *TimeComplexityResult.ToString()));
-		return;
-	}
-	
-	UE_LOG(LogTemp, Display, TEXT("%s"),
-		*FString::Printf(TEXT("MagicScript: %s() finished. Return: %s, PeakSpace: %lld bytes, Complexity: %s"),
-		*FuncName, *Ret.ToDebugString(), PeakBytes, *TimeComplexityResult.ToString()));
+	LogScriptFinished(Run.ExecutionContext.Mode == EExecutionMode::PreAnalysis
+		? TEXT("MagicScript PreAnalysis (sliced)") : TEXT("MagicScript (sliced)"),
+		Run.FuncName, ReturnValue, PeakBytes, TimeComplexity);
 }
 
 void UMagicScriptInterpreterSubsystem::OnRegisterBuiltins(const TSharedPtr<FEnvironment> Env)
@@ -425,23 +1206,75 @@ void UMagicScriptInterpreterSubsystem::OnRegisterBuiltins(const TSharedPtr<FEnvi
 	MsMathBuiltins::Register(Env, this);
 	MsConsoleBuiltins::Register(Env, this);
 	MsArrayBuiltins::Register(Env, this);
+	MsCollectionBuiltins::Register(Env, this);
+	MsStringBuiltins::Register(Env, this);
 }
 
-void UMagicScriptInterpreterSubsystem::RegisterBuiltins_Internal(const FString& RelativePath)
+void UMagicScriptInterpreterSubsystem::AttachProfiler_Internal(FScriptRecord& Record)
 {
-	TSharedPtr<FInterpreter> Interpreter = InterpreterCache.FindRef(RelativePath);
-	if (Interpreter.IsValid())
+	AttachProfiler_Internal(Record, Record.Interpreter);
+}
+
+void UMagicScriptInterpreterSubsystem::AttachProfiler_Internal(FScriptRecord& Record, const TSharedPtr<FInterpreter>& Interpreter)
+{
+	if (!Interpreter.IsValid())
 	{
 		return;
 	}
-	
-	InterpreterCache.Add(RelativePath, MakeShared<FInterpreter>());
-	const TSharedPtr<FInterpreter> InterpreterPtr = InterpreterCache[RelativePath];
-	const TSharedPtr<FEnvironment> Env = InterpreterPtr->GetGlobalEnv();
-	if (!Env.IsValid())
+
+	if (!bProfilingEnabled)
+	{
+		Interpreter->SetProfiler(nullptr);
+		return;
+	}
+
+	if (!Record.Profiler.IsValid())
+	{
+		Record.Profiler = MakeShared<FScriptProfiler>(Record.Path);
+	}
+	Interpreter->SetProfiler(Record.Profiler);
+}
+
+void UMagicScriptInterpreterSubsystem::RegisterBuiltins_Internal(FScriptRecord& Record)
+{
+	if (Record.Interpreter.IsValid())
 	{
 		return;
 	}
 	
-	OnRegisterBuiltins(Env);
+	Record.Interpreter = CreateInterpreter_Internal(Record.Path);
+}
+
+void UMagicScriptInterpreterSubsystem::ForEachInterpreter_Internal(TFunctionRef<void(const TSharedPtr<FInterpreter>&)> Visitor) const
+{
+	// 방문 중 스크립트가 실행되면 레코드가 늘어날 수 있으므로 인덱스로 순회하고 인터프리터는 복사해 붙잡아 둠
+	for (int32 Index = 0; Index < ScriptRecords.Num(); ++Index)
+	{
+		const TSharedPtr<FInterpreter> Interpreter = ScriptRecords[Index]->Interpreter;
+		if (Interpreter.IsValid())
+		{
+			Visitor(Interpreter);
+		}
+	}
+
+	// import된 모듈 인스턴스는 레코드와 별도의 인터프리터를 가짐
+	if (ModuleGraph.IsValid())
+	{
+		ModuleGraph->ForEachModuleInterpreter(Visitor);
+	}
+}
+
+TSharedPtr<FInterpreter> UMagicScriptInterpreterSubsystem::CreateInterpreter_Internal(const FString& RelativePath)
+{
+	const TSharedPtr<FInterpreter> InterpreterPtr = MakeShared<FInterpreter>();
+	InterpreterPtr->SetScriptName(RelativePath);
+	InterpreterPtr->SetHost(this);
+	InterpreterPtr->SetMaxCallDepth(MaxCallDepth);
+	InterpreterPtr->SetDefaultExecutionBudget(DefaultExecutionBudget);
+	const TSharedPtr<FEnvironment> Env = InterpreterPtr->GetGlobalEnv();
+	if (Env.IsValid())
+	{
+		OnRegisterBuiltins(Env);
+	}
+	return InterpreterPtr;
 }
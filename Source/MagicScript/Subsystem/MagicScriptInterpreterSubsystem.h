@@ -2,8 +2,11 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
-#include "MagicScript/Runtime/MsInterpreter.h"
-#include "MagicScript/Logging/MsLoggingEnum.h"
+#include "Tickable.h"
+#include "MagicScriptCore/Runtime/MsInterpreter.h"
+#include "MagicScriptCore/Logging/MsLoggingEnum.h"
+#include "MagicScriptCore/Logging/MsLogRingBuffer.h"
+#include "MagicScriptCore/Runtime/MsScriptHost.h"
 #include "MagicScriptInterpreterSubsystem.generated.h"
 
 namespace MagicScript
@@ -13,44 +16,233 @@ namespace MagicScript
 	class FEnvironment;
 	struct FProgram;
 	struct FTimeComplexityResult;
+	class FTimeComplexityCache;
+	class FModuleGraph;
 }
 
+struct FFileChangeData;
+
+// 스크립트 핸들 (ResolveScript로 경로를 한 번 해석해 두고 이후 호출은 핸들로, 서브시스템이 살아 있는 동안 유효)
+USTRUCT(BlueprintType)
+struct MAGICSCRIPT_API FMagicScriptHandle
+{
+	GENERATED_BODY()
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	bool operator==(const FMagicScriptHandle& Other) const { return Index == Other.Index; }
+	bool operator!=(const FMagicScriptHandle& Other) const { return Index != Other.Index; }
+
+private:
+	friend class UMagicScriptInterpreterSubsystem;
+
+	// 서브시스템의 스크립트 레코드 배열 인덱스 (레코드는 지우지 않으므로 바뀌지 않음)
+	int32 Index = INDEX_NONE;
+};
+
+UENUM(BlueprintType)
+enum class EMagicScriptValueType : uint8
+{
+	Null,
+	Number,
+	String,
+	Bool,
+};
+
+// 블루프린트와 주고받는 스크립트 값 (원시 값만, 배열/객체 등 반환값은 표시용 문자열로 바꿈)
+USTRUCT(BlueprintType)
+struct MAGICSCRIPT_API FMagicScriptValue
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EMagicScriptValueType Type = EMagicScriptValueType::Null;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	double Number = 0.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FString String;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bBool = false;
+};
+
+/**
+ * 준비된 spell 호출 (PrepareCall로 스크립트 + spell을 한 번 묶고 Invoke로 반복 호출)
+ * - 전역 코드는 준비할 때 한 번만 실행하고, 호출마다 이름으로 spell을 찾지 않음
+ * - 스크립트 캐시가 비워지면(파일 변경 등) 다음 Invoke에서 다시 준비
+ */
+USTRUCT(BlueprintType)
+struct MAGICSCRIPT_API FMagicScriptPreparedCall
+{
+	GENERATED_BODY()
+
+	bool IsValid() const { return Function.IsValid() && Interpreter.IsValid(); }
+	FMagicScriptHandle GetScript() const { return Script; }
+	const FString& GetSpellName() const { return SpellName; }
+
+private:
+	friend class UMagicScriptInterpreterSubsystem;
+
+	FMagicScriptHandle Script;
+	FString SpellName;
+
+	// 묶을 때의 스크립트 레코드 세대 (다르면 캐시가 비워진 것)
+	uint32 Generation = 0;
+	TSharedPtr<MagicScript::FInterpreter> Interpreter;
+	TSharedPtr<MagicScript::FFunctionValue> Function;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnScriptLogAdded, const FScriptLog&, ScriptLog);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnScriptLogsFlushed, const TArray<FScriptLog>&, ScriptLogs);
 
 UCLASS()
 class MAGICSCRIPT_API UMagicScriptInterpreterSubsystem
 	: public UGameInstanceSubsystem
+	, public FTickableGameObject
+	, public MagicScript::IScriptHost
 {
 	GENERATED_BODY()
 	
 public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
+
+	// FTickableGameObject - 매 틱 분할 실행을 이어서 진행하고, 대기 중인 로그를 한 번에 전달하고, 순환 참조 수집을 조금씩 진행
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return bInitialized; }
+	virtual bool IsTickableWhenPaused() const override { return true; }
+	virtual ETickableTickType GetTickableTickType() const override;
 	
 	static UMagicScriptInterpreterSubsystem* Get(const UObject* WorldContextObject);
 
+	// 로그 1건마다 호출 (틱에서 모아서 전달)
 	FOnScriptLogAdded OnScriptLogAdded;
 
+	// 틱마다 이번 틱에 추가된 로그 묶음을 한 번 전달
+	FOnScriptLogsFlushed OnScriptLogsFlushed;
+
+	// 최근 로그 (최대 MaxStoredScriptLogs개, 틱에서 FlushScriptLogs 이후 반영)
 	const TArray<FScriptLog>& GetScriptLogs() const { return ScriptLogs; }
 
-	void AddScriptLog(const EScriptLogType ScriptLogType, const FString& ScriptLogMessage);
+	// IScriptHost - 어느 스레드에서든 호출 가능 (lock-free 큐에 넣고 다음 틱에 전달)
+	virtual void AddScriptLog(const EScriptLogType ScriptLogType, const FString& ScriptLogMessage,
+		const FName ScriptId = NAME_None, const int32 Line = 0, const int32 Column = 0) override;
 
-	void ClearScriptLogs() { ScriptLogs.Empty(); }
+	// 대기 중인 로그를 즉시 로그 배열에 반영하고 델리게이트 전달 (게임 스레드 전용)
+	void FlushScriptLogs();
+
+	void ClearScriptLogs();
+
+	// 해당 레벨의 로그를 남길지 (메시지 포맷 전에 확인해서 버려질 로그의 문자열 생성을 생략)
+	virtual bool ShouldCaptureScriptLog(const EScriptLogType ScriptLogType) const override;
+
+	// 이 레벨 미만의 스크립트 로그는 버림
+	void SetMinScriptLogType(const EScriptLogType InMinScriptLogType) { MinScriptLogType.store(InMinScriptLogType, std::memory_order_relaxed); }
+
+	// false면 로그 배열에 저장하지 않음 (OnScriptLogAdded/OnScriptLogsFlushed에 바인딩된 리스너가 있을 때만 전달)
+	void SetStoreScriptLogs(const bool bInStoreScriptLogs) { bStoreScriptLogs.store(bInStoreScriptLogs, std::memory_order_relaxed); }
+
+	// 경로를 스크립트 핸들로 해석 (같은 경로는 항상 같은 핸들, 파일은 처음 실행할 때 읽음)
+	FMagicScriptHandle ResolveScript(const FString& RelativePath);
+
+	// 핸들의 상대 경로 (잘못된 핸들이면 빈 문자열)
+	const FString& GetScriptPath(const FMagicScriptHandle Script) const;
+
+	// 경로 대신 핸들로 실행 (자주 호출하는 스크립트는 핸들을 들고 있으면 경로 문자열 해시를 매번 하지 않음)
+	bool RunScript(const FMagicScriptHandle Script,
+		const FString& FuncName = TEXT("main"),
+		const MagicScript::FScriptExecutionContext& ExecutionContext = MagicScript::FScriptExecutionContext());
 
 	bool RunScriptFile(const FString& RelativePath,
 		const FString& FuncName = TEXT("main"),
 		const MagicScript::FScriptExecutionContext& ExecutionContext = MagicScript::FScriptExecutionContext());
 
+	// RunScriptFile과 같은 순서(전역 코드 → FuncName)로 실행하되 틱마다 ScriptSliceBudget 만큼씩 나눠서 진행
+	// (준비에 실패하면 false, 끝나면 RunScriptFile과 같은 복잡도 캐시/완료 로그를 남김)
+	bool RunScriptSliced(const FMagicScriptHandle Script,
+		const FString& FuncName = TEXT("main"),
+		const MagicScript::FScriptExecutionContext& ExecutionContext = MagicScript::FScriptExecutionContext());
+
+	bool RunScriptFileSliced(const FString& RelativePath,
+		const FString& FuncName = TEXT("main"),
+		const MagicScript::FScriptExecutionContext& ExecutionContext = MagicScript::FScriptExecutionContext());
+
+	// 스크립트를 (아직이면) 컴파일하고 전역 코드를 한 번 실행한 뒤 SpellName을 찾아 묶음 (실패하면 IsValid() == false)
+	FMagicScriptPreparedCall PrepareCall(const FMagicScriptHandle Script, const FString& SpellName,
+		const MagicScript::FScriptExecutionContext& ExecutionContext = MagicScript::FScriptExecutionContext());
+
+	// 묶어 둔 spell을 인자와 함께 호출 (전역 코드를 다시 실행하지 않고 복잡도/완료 로그도 남기지 않음)
+	MagicScript::FValue Invoke(FMagicScriptPreparedCall& Call, TArrayView<const MagicScript::FValue> Args,
+		const MagicScript::FScriptExecutionContext& ExecutionContext = MagicScript::FScriptExecutionContext());
+
+	// 블루프린트용 PrepareCall / Invoke
+	UFUNCTION(BlueprintCallable, Category = "MagicScript")
+	FMagicScriptPreparedCall PrepareScriptCall(const FString& RelativePath, const FString& SpellName);
+
+	UFUNCTION(BlueprintCallable, Category = "MagicScript")
+	FMagicScriptValue InvokeScriptCall(UPARAM(ref) FMagicScriptPreparedCall& Call, const TArray<FMagicScriptValue>& Arguments);
+
+	bool IsScriptSlicePending(const FString& RelativePath) const;
+
+	// 진행 중인 분할 실행을 중단 (완료 로그/캐시는 남기지 않음)
+	void CancelScriptSlice(const FString& RelativePath);
+
+	// 틱마다 인터프리터별로 이어서 실행할 예산 (명령 수/밀리초, 0이면 해당 제한 없음)
+	void SetScriptSliceBudget(const MagicScript::FScriptSliceBudget& InBudget) { ScriptSliceBudget = InBudget; }
+	const MagicScript::FScriptSliceBudget& GetScriptSliceBudget() const { return ScriptSliceBudget; }
+
+	// true면 TickEventLoops가 setTimeout 콜백도 분할 실행으로 시작 (끝나지 않은 콜백은 다음 틱부터 이어서 실행)
+	void SetSliceEventLoopCallbacks(const bool bInSlice) { bSliceEventLoopCallbacks = bInSlice; }
+
+	// 스크립트 spell 호출 깊이 제한 (이미 만든 인터프리터에도 바로 적용)
+	void SetMaxCallDepth(const int32 InMaxCallDepth);
+	int32 GetMaxCallDepth() const { return MaxCallDepth; }
+
+	// 실행 컨텍스트에 예산이 없을 때(이벤트 루프 콜백 포함) 적용할 실행 예산 (이미 만든 인터프리터에도 바로 적용)
+	void SetDefaultExecutionBudget(const MagicScript::FScriptExecutionBudget& InBudget);
+	const MagicScript::FScriptExecutionBudget& GetDefaultExecutionBudget() const { return DefaultExecutionBudget; }
+
+	// 스크립트와 그 스크립트를 (간접적으로) import하는 스크립트의 캐시만 비움
 	void ClearScriptCache(const FString& RelativePath);
 
+	// RelativePath를 직접 또는 간접적으로 import하는 스크립트 경로 (RelativePath 제외, 가까운 순)
+	void GetDependentScripts(const FString& RelativePath, TArray<FString>& OutPaths) const;
+
 	void TickEventLoops();
 
+	// 틱마다 인터프리터별 순환 참조 수집에 쓸 작업 예산 (노드/참조 방문 수, 0이면 끔)
+	void SetGarbageCollectionBudget(const int32 InWorkBudget) { GarbageCollectionBudget = FMath::Max(0, InWorkBudget); }
+	int32 GetGarbageCollectionBudget() const { return GarbageCollectionBudget; }
+
+	// 모든 인터프리터의 순환 참조를 즉시 수거, 수거한 노드 수 반환
+	int32 CollectScriptGarbage();
+
+	// 캐시된 소스가 있으면 파일 시스템을 거치지 않음 (외부 수정은 파일 감시/폴링이 RefreshScriptFile로 반영)
 	bool CheckScriptByPath(const FString& ScriptPath, FString& Source);
 	bool SaveScriptCache(const FString& ScriptPath, const FString& Source);
+
+	// 캐시된 스크립트 파일을 다시 읽어 내용 해시가 달라졌으면 소스를 바꾸고 ClearScriptCache (바뀌었으면 true)
+	bool RefreshScriptFile(const FString& ScriptPath);
+
+	// 디렉터리 감시가 없는 빌드에서 캐시된 스크립트 파일의 타임스탬프를 확인하는 주기 (초, 0이면 끔)
+	void SetScriptFilePollInterval(const float InSeconds) { ScriptFilePollInterval = FMath::Max(0.0f, InSeconds); }
+	float GetScriptFilePollInterval() const { return ScriptFilePollInterval; }
 	
 	double GetTimeComplexityCache(const FString& RelativePath) const;
 	int64 GetSpaceComplexityCache(const FString& RelativePath) const;
 
+	// 프로파일링 모드 (켜져 있으면 이후 실행부터 spell/라인 단위 시간을 스크립트별로 누적)
+	void SetProfilingEnabled(const bool bEnabled);
+	bool IsProfilingEnabled() const { return bProfilingEnabled; }
+	TSharedPtr<MagicScript::FScriptProfiler> GetScriptProfiler(const FString& RelativePath) const;
+	void ResetScriptProfiles();
+
+	// 누적된 프로파일을 파일로 저장 (collapsed stacks 또는 Chrome trace JSON)
+	bool SaveScriptProfile(const FString& RelativePath, const FString& OutFilePath,
+		const MagicScript::EScriptProfileFormat Format = MagicScript::EScriptProfileFormat::ChromeTrace) const;
+
 protected:
 	virtual void OnRegisterBuiltins(const TSharedPtr<MagicScript::FEnvironment> Env);
 	
@@ -59,27 +251,122 @@ private:
 	UPROPERTY()
 	TArray<FScriptLog> ScriptLogs;
 
-	TMap<FString, FString> ScriptCache;
-	
-	// 인터프리터 캐시 (파일 경로별)
-	TMap<FString, TSharedPtr<MagicScript::FInterpreter>> InterpreterCache;
+	// 로그 필터 설정은 다른 스레드의 ShouldCaptureScriptLog에서도 읽으므로 atomic
+	std::atomic<EScriptLogType> MinScriptLogType{EScriptLogType::Default};
+	std::atomic<bool> bStoreScriptLogs{true};
+
+	// OnScriptLogAdded/OnScriptLogsFlushed 바인딩 여부 (델리게이트는 게임 스레드에서만 읽을 수 있어 틱/플러시 때 갱신한 값을 다른 스레드가 읽음)
+	std::atomic<bool> bHasScriptLogListener{false};
+	bool HasScriptLogListener_Internal() const;
+	void UpdateScriptLogListener_Internal();
+
+	bool bInitialized = false;
+	int32 GarbageCollectionBudget = 4096;
+	MagicScript::FScriptSliceBudget ScriptSliceBudget{ 0, 2.0 };
+	bool bSliceEventLoopCallbacks = false;
+	int32 MaxCallDepth = MagicScript::FInterpreter::DEFAULT_MAX_CALL_DEPTH;
+	MagicScript::FScriptExecutionBudget DefaultExecutionBudget;
+
+	// 다음 틱에 전달될 로그 큐 (가득 차면 버리고 개수만 기록)
+	static constexpr uint32 PendingScriptLogCapacity = 4096;
+	static constexpr int32 MaxStoredScriptLogs = 2048;
+	MagicScript::TMpscRingBuffer<FScriptLog> PendingScriptLogs{ PendingScriptLogCapacity };
+	std::atomic<int32> DroppedScriptLogCount{0};
+
+	// 분할 실행 중인 스크립트 (틱에서 이어서 실행)
+	struct FSlicedScriptRun
+	{
+		FString FuncName;
+		MagicScript::FScriptExecutionContext ExecutionContext;
+		TSharedPtr<MagicScript::FTimeComplexityResult> TimeComplexity;
+		bool bCallingFunction = false;   // 전역 코드가 끝나고 FuncName 실행 중
+		double ExecutionSeconds = 0.0;   // FuncName 실행에 쓴 시간 (틱 사이 대기 시간 제외)
+	};
+
+	/**
+	 * 스크립트 하나의 캐시 (경로마다 하나, 핸들 인덱스로 찾음)
+	 * - 소스/프로그램/인터프리터/복잡도/분할 실행/import 관계/프로파일을 한곳에 모아 실행 한 번에 경로 해시는 최대 한 번
+	 * - ClearScriptCache는 컴파일/실행 결과만 비우고 레코드는 남김 (핸들이 계속 유효)
+	 */
+	struct FScriptRecord
+	{
+		FMagicScriptHandle Handle;
+		FString Path;
+		FName ScriptId;  // 로그용 (FName(*Path))
+
+		// 소스 (파일 감시/폴링이 최신으로 유지, 내용 해시가 같으면 다시 컴파일하지 않음)
+		bool bSourceLoaded = false;
+		FString Source;
+		uint64 SourceHash = 0;
+		FDateTime FileTimestamp;
 
-	// 파일 경로 기반 프로그램 정보 캐싱
-	TMap<FString, TSharedPtr<MagicScript::FProgram>> ProgramCache;
+		// 컴파일/실행 결과 (ClearScriptCache로 비움)
+		TSharedPtr<MagicScript::FProgram> Program;
+		TSharedPtr<MagicScript::FInterpreter> Interpreter;
+		bool bTopLevelExecuted = false;  // Interpreter에서 전역 코드가 에러 없이 끝남
+		uint32 Generation = 0;           // 비울 때마다 증가 (준비된 호출이 다시 준비할지 판단)
+		TSharedPtr<MagicScript::FTimeComplexityResult> TimeComplexity;
+		int64 PeakSpaceBytes = 0;
+		TOptional<FSlicedScriptRun> SlicedRun;
 
-	// 시간 복잡도 캐시
-	TMap<FString, TSharedPtr<MagicScript::FTimeComplexityResult>> PrevTimeComplexityCache;
+		// import 그래프 (파싱할 때 import 문으로 갱신, 캐시를 비워도 유지)
+		TArray<int32> Imports;     // 이 스크립트가 import한 레코드
+		TSet<int32> Dependents;    // 이 스크립트를 import하는 레코드
 
-	// 공간 복잡도 캐시
-	TMap<FString, int64> PrevSpaceComplexityCache;
+		// 프로파일 결과 (캐시를 비워도 유지)
+		TSharedPtr<MagicScript::FScriptProfiler> Profiler;
+	};
 
-	bool CheckCache_Internal(const FString& RelativePath, const FString& FuncName, MagicScript::FScriptExecutionContext& ExecutionContext);
-	bool Lexer_Internal(MagicScript::FLexer& Lexer, TArray<MagicScript::FToken>& Tokens, const FString& ScriptPath);
-	bool Parsing_Internal(MagicScript::FParser& Parser, const FString& RelativePath);
+	// 레코드는 추가만 하고 지우지 않음 (레코드 참조는 다른 레코드를 추가해도 유효)
+	TArray<TUniquePtr<FScriptRecord>> ScriptRecords;
+	TMap<FString, int32> ScriptHandles;
+
+	// 파일 변경 감지 (에디터: 디렉터리 감시, 그 외: 타임스탬프 폴링)
+	FDelegateHandle ScriptDirectoryWatcherHandle;
+	float ScriptFilePollInterval = 1.0f;
+	float ScriptFilePollElapsed = 0.0f;
+
+	// spell별 복잡도 분석 메모 (본문 구조 해시 키, 모든 스크립트가 공유하고 ClearScriptCache로 지우지 않음)
+	TSharedPtr<MagicScript::FTimeComplexityCache> SpellComplexityCache;
+
+	// import한 모듈 인스턴스 (모듈마다 전역 코드를 한 번만 실행하고 export를 import하는 쪽에 바인딩)
+	TSharedPtr<MagicScript::FModuleGraph> ModuleGraph;
+
+	bool bProfilingEnabled = false;
+
+	FScriptRecord& FindOrAddRecord_Internal(const FString& RelativePath);
+	FScriptRecord* FindRecord_Internal(const FString& RelativePath) const;
+	FScriptRecord* GetRecord_Internal(const FMagicScriptHandle Script) const;
+
+	bool LoadScriptSource_Internal(FScriptRecord& Record);
+	void CacheScriptSource_Internal(FScriptRecord& Record, FString Source);
+	bool RefreshScriptFile_Internal(FScriptRecord& Record);
+	void OnScriptFilesChanged_Internal(const TArray<FFileChangeData>& FileChanges);
+	void PollScriptFiles_Internal(float DeltaTime);
+
+	bool CheckCache_Internal(FScriptRecord& Record, const FString& FuncName, MagicScript::FScriptExecutionContext& ExecutionContext);
+	bool InitializeScript_Internal(FScriptRecord& Record, MagicScript::FTimeComplexityResult& OutTimeComplexity,
+		MagicScript::FScriptExecutionContext& ExecutionContext);
+	bool BindPreparedCall_Internal(FScriptRecord& Record, FMagicScriptPreparedCall& Call,
+		const MagicScript::FScriptExecutionContext& ExecutionContext);
+	bool Parsing_Internal(MagicScript::FParser& Parser, FScriptRecord& Record);
+	void UpdateScriptImports_Internal(FScriptRecord& Record, const MagicScript::FProgram& Program);
+	void ClearScriptCache_Internal(FScriptRecord& Record);
+	void CollectDependents_Internal(const FScriptRecord& Record, TArray<int32>& OutIndices) const;
+	void EvictScript_Internal(FScriptRecord& Record);
 	bool Import_Internal(const TSharedPtr<MagicScript::FProgram>& Program, const MagicScript::FScriptExecutionContext& ExecutionContext);
 	void RunScript_Internal(MagicScript::FTimeComplexityResult& TimeComplexityResult,
-		const FString& RelativePath, const FString& FuncName,
+		FScriptRecord& Record, const FString& FuncName,
 		MagicScript::FScriptExecutionContext& ExecutionContext);
 	
-	void RegisterBuiltins_Internal(const FString& RelativePath);
+	void TickScriptSlices_Internal();
+	void FinishSlicedRun_Internal(FScriptRecord& Record, const FSlicedScriptRun& Run, const MagicScript::FValue& ReturnValue);
+
+	void RegisterBuiltins_Internal(FScriptRecord& Record);
+	TSharedPtr<MagicScript::FInterpreter> CreateInterpreter_Internal(const FString& RelativePath);
+
+	// 스크립트 레코드와 import된 모듈의 인터프리터를 모두 방문 (틱/설정 변경/수집에서 같은 목록을 사용)
+	void ForEachInterpreter_Internal(TFunctionRef<void(const TSharedPtr<MagicScript::FInterpreter>&)> Visitor) const;
+	void AttachProfiler_Internal(FScriptRecord& Record);
+	void AttachProfiler_Internal(FScriptRecord& Record, const TSharedPtr<MagicScript::FInterpreter>& Interpreter);
 };
@@ -0,0 +1,1400 @@
+#include "MagicScriptCore/Analysis/MsTimeComplexity.h"
+#include "MagicScriptCore/Core/MsEnvironment.h"
+#include "HAL/PlatformTime.h"
+#include "Hash/CityHash.h"
+
+namespace MagicScript
+{
+	FComplexityBound FComplexityBound::Max(const FComplexityBound& A, const FComplexityBound& B)
+	{
+		return (A < B) ? B : A;
+	}
+
+	FComplexityBound FComplexityBound::Multiply(const FComplexityBound& A, const FComplexityBound& B)
+	{
+		FComplexityBound Result;
+		Result.bExponential = A.bExponential || B.bExponential;
+		Result.PolyDegree = static_cast<uint8>(FMath::Min(A.PolyDegree + B.PolyDegree, 255));
+		Result.LogDegree = static_cast<uint8>(FMath::Min(A.LogDegree + B.LogDegree, 255));
+		return Result;
+	}
+
+	bool FComplexityBound::operator<(const FComplexityBound& Other) const
+	{
+		if (bExponential != Other.bExponential)
+		{
+			return Other.bExponential;
+		}
+		if (PolyDegree != Other.PolyDegree)
+		{
+			return PolyDegree < Other.PolyDegree;
+		}
+		return LogDegree < Other.LogDegree;
+	}
+
+	double FComplexityBound::Evaluate(const double N) const
+	{
+		if (bExponential)
+		{
+			return FMath::Pow(2.0, N);
+		}
+		return FMath::Pow(N, static_cast<double>(PolyDegree)) * FMath::Pow(FMath::Log2(N), static_cast<double>(LogDegree));
+	}
+
+	FString FComplexityBound::ToString() const
+	{
+		if (bExponential)
+		{
+			return TEXT("O(2^n)");
+		}
+		if (IsConstant())
+		{
+			return TEXT("O(1)");
+		}
+
+		FString Inner;
+		if (PolyDegree == 1)
+		{
+			Inner = TEXT("n");
+		}
+		else if (PolyDegree > 1)
+		{
+			Inner = FString::Printf(TEXT("n^%d"), PolyDegree);
+		}
+
+		if (LogDegree > 0)
+		{
+			const FString LogTerm = (LogDegree == 1) ? FString(TEXT("log n")) : FString::Printf(TEXT("log^%d n"), LogDegree);
+			Inner = Inner.IsEmpty() ? LogTerm : Inner + TEXT(" ") + LogTerm;
+		}
+		return FString::Printf(TEXT("O(%s)"), *Inner);
+	}
+
+	void FTimeComplexityCache::Add(const uint64 Key, FSpellAnalysisRecord&& Record)
+	{
+		if (Records.Num() >= MaxRecords && !Records.Contains(Key))
+		{
+			// 오래된 기록을 골라 지울 만큼 크지 않으므로 한 번에 비움 (다음 분석부터 다시 채워짐)
+			Records.Empty();
+		}
+		Records.Add(Key, MoveTemp(Record));
+	}
+
+	namespace
+	{
+		// 점근 부류 + 기준 입력 크기에서의 예상 연산 수
+		struct FCost
+		{
+			FComplexityBound Bound;
+			double Work = 0.0;
+
+			void Add(const FCost& Other)
+			{
+				Bound = FComplexityBound::Max(Bound, Other.Bound);
+				Work += Other.Work;
+			}
+
+			// Count번 반복 (Count는 기준 입력 크기에서의 반복 횟수)
+			FCost Repeat(const FComplexityBound& TripBound, const double Count) const
+			{
+				FCost Result;
+				Result.Bound = FComplexityBound::Multiply(Bound, TripBound);
+				Result.Work = Work * Count;
+				return Result;
+			}
+		};
+
+		// 반복 변수의 갱신 방식
+		enum class EStepKind : uint8
+		{
+			None,
+			Additive,        // i++, i += c, i = i - c
+			Multiplicative   // i *= c, i /= c, i = i * c (c > 1)
+		};
+
+		struct FLoopStep
+		{
+			EStepKind Kind = EStepKind::None;
+			double Amount = 1.0;
+		};
+
+		bool TryGetNumberLiteral(const FExpression* Expr, double& OutNumber)
+		{
+			while (Expr && Expr->Kind == EExpressionKind::Grouping)
+			{
+				Expr = static_cast<const FGroupingExpression*>(Expr)->Inner.Get();
+			}
+			if (Expr && Expr->Kind == EExpressionKind::Literal)
+			{
+				const FLiteralExpression* Lit = static_cast<const FLiteralExpression*>(Expr);
+				if (Lit->LiteralToken.Type == ETokenType::Number)
+				{
+					OutNumber = FCString::Atod(*Lit->LiteralToken.Lexeme);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		bool IsIdentifier(const FExpression* Expr, const FString& Name)
+		{
+			return Expr && Expr->Kind == EExpressionKind::Identifier
+				&& static_cast<const FIdentifierExpression*>(Expr)->Name == Name;
+		}
+
+		// 배율 c(> 1)로 곱하거나 나누는 갱신인지
+		FLoopStep MakeScaleStep(const double Factor)
+		{
+			FLoopStep Step;
+			if (Factor > 1.0)
+			{
+				Step.Kind = EStepKind::Multiplicative;
+				Step.Amount = Factor;
+			}
+			return Step;
+		}
+
+		// Var를 갱신하는 식이면 갱신 방식 반환
+		FLoopStep ClassifyUpdate(const FExpression* Expr, const FString& Var)
+		{
+			FLoopStep Step;
+			if (!Expr)
+			{
+				return Step;
+			}
+
+			switch (Expr->Kind)
+			{
+			case EExpressionKind::PostfixIncrement:
+			case EExpressionKind::PostfixDecrement:
+				if (IsIdentifier(static_cast<const FPostfixExpression*>(Expr)->Operand.Get(), Var))
+				{
+					Step.Kind = EStepKind::Additive;
+				}
+				return Step;
+
+			case EExpressionKind::Unary:
+			{
+				const FUnaryExpression* Un = static_cast<const FUnaryExpression*>(Expr);
+				if ((Un->Op == EUnaryOp::PreIncrement || Un->Op == EUnaryOp::PreDecrement) && IsIdentifier(Un->Operand.Get(), Var))
+				{
+					Step.Kind = EStepKind::Additive;
+				}
+				return Step;
+			}
+
+			case EExpressionKind::Assignment:
+			{
+				const FAssignmentExpression* Assign = static_cast<const FAssignmentExpression*>(Expr);
+				if (Assign->TargetName != Var || !Assign->MemberName.IsEmpty() || Assign->Index.IsValid())
+				{
+					return Step;
+				}
+
+				double Amount = 0.0;
+				const bool bLiteral = TryGetNumberLiteral(Assign->Value.Get(), Amount);
+				switch (Assign->Op)
+				{
+				case EAssignmentOp::AddAssign:
+				case EAssignmentOp::SubAssign:
+					// 증감량을 모르면 1로 봄 (반복 횟수는 어차피 n에 비례)
+					Step.Kind = EStepKind::Additive;
+					Step.Amount = (bLiteral && Amount != 0.0) ? FMath::Abs(Amount) : 1.0;
+					return Step;
+
+				case EAssignmentOp::MulAssign:
+				case EAssignmentOp::DivAssign:
+					return bLiteral ? MakeScaleStep(FMath::Abs(Amount)) : Step;
+
+				case EAssignmentOp::Assign:
+				{
+					// i = i + c / i = i * c 형태
+					const FExpression* Value = Assign->Value.Get();
+					if (!Value || Value->Kind != EExpressionKind::Binary)
+					{
+						return Step;
+					}
+					const FBinaryExpression* Bin = static_cast<const FBinaryExpression*>(Value);
+					const FExpression* Other = IsIdentifier(Bin->Left.Get(), Var) ? Bin->Right.Get()
+						: (IsIdentifier(Bin->Right.Get(), Var) ? Bin->Left.Get() : nullptr);
+					if (!Other)
+					{
+						return Step;
+					}
+
+					double Operand = 0.0;
+					const bool bOperandLiteral = TryGetNumberLiteral(Other, Operand);
+					if (Bin->Op == EBinaryOp::Add || Bin->Op == EBinaryOp::Sub)
+					{
+						Step.Kind = EStepKind::Additive;
+						Step.Amount = (bOperandLiteral && Operand != 0.0) ? FMath::Abs(Operand) : 1.0;
+						return Step;
+					}
+					if ((Bin->Op == EBinaryOp::Mul || Bin->Op == EBinaryOp::Div) && bOperandLiteral)
+					{
+						return MakeScaleStep(FMath::Abs(Operand));
+					}
+					return Step;
+				}
+
+				default:
+					return Step;
+				}
+			}
+
+			default:
+				return Step;
+			}
+		}
+
+		// 반복 상한 식이 입력 크기 n의 몇 차인지 (리터럴 0차, 변수/길이/호출 1차, 곱은 차수의 합)
+		uint8 BoundDegree(const FExpression* Expr)
+		{
+			if (!Expr)
+			{
+				return 1;
+			}
+
+			switch (Expr->Kind)
+			{
+			case EExpressionKind::Literal:
+				return 0;
+
+			case EExpressionKind::Grouping:
+				return BoundDegree(static_cast<const FGroupingExpression*>(Expr)->Inner.Get());
+
+			case EExpressionKind::Unary:
+				return BoundDegree(static_cast<const FUnaryExpression*>(Expr)->Operand.Get());
+
+			case EExpressionKind::Binary:
+			{
+				const FBinaryExpression* Bin = static_cast<const FBinaryExpression*>(Expr);
+				const uint8 Left = BoundDegree(Bin->Left.Get());
+				const uint8 Right = BoundDegree(Bin->Right.Get());
+				if (Bin->Op == EBinaryOp::Mul)
+				{
+					return static_cast<uint8>(FMath::Min(Left + Right, 255));
+				}
+				if (Bin->Op == EBinaryOp::Div || Bin->Op == EBinaryOp::Mod)
+				{
+					return Left;
+				}
+				return FMath::Max(Left, Right);
+			}
+
+			default:
+				return 1;
+			}
+		}
+
+		struct FTripCount
+		{
+			FComplexityBound Bound;
+			double Count = 0.0;
+		};
+
+		FTripCount UnknownTripCount()
+		{
+			return { FComplexityBound::Linear(), FTimeComplexityAnalyzer::ReferenceInputSize };
+		}
+
+		// 조건식 `Var <op> Bound` (또는 `Bound <op> Var`)에서 반복 횟수 유도
+		FTripCount DeriveTripCount(const FString& Var, const FExpression* InitValue, const FExpression* Condition, const FLoopStep& Step)
+		{
+			if (Var.IsEmpty() || Step.Kind == EStepKind::None || !Condition || Condition->Kind != EExpressionKind::Binary)
+			{
+				return UnknownTripCount();
+			}
+
+			const FBinaryExpression* Cond = static_cast<const FBinaryExpression*>(Condition);
+			switch (Cond->Op)
+			{
+			case EBinaryOp::Less:
+			case EBinaryOp::LessEqual:
+			case EBinaryOp::Greater:
+			case EBinaryOp::GreaterEqual:
+			case EBinaryOp::NotEqual:
+				break;
+			default:
+				return UnknownTripCount();
+			}
+
+			const FExpression* BoundExpr = IsIdentifier(Cond->Left.Get(), Var) ? Cond->Right.Get()
+				: (IsIdentifier(Cond->Right.Get(), Var) ? Cond->Left.Get() : nullptr);
+			if (!BoundExpr)
+			{
+				return UnknownTripCount();
+			}
+
+			const double N = FTimeComplexityAnalyzer::ReferenceInputSize;
+			double Start = 0.0;
+			double End = 0.0;
+			const bool bConstantRange = InitValue && TryGetNumberLiteral(InitValue, Start) && TryGetNumberLiteral(BoundExpr, End);
+			const bool bInclusive = Cond->Op == EBinaryOp::LessEqual || Cond->Op == EBinaryOp::GreaterEqual;
+
+			if (Step.Kind == EStepKind::Multiplicative)
+			{
+				if (bConstantRange && Start != 0.0 && End != 0.0)
+				{
+					const double Ratio = FMath::Max(FMath::Abs(End), FMath::Abs(Start)) / FMath::Min(FMath::Abs(End), FMath::Abs(Start));
+					return { FComplexityBound::Constant(), FMath::CeilToDouble(FMath::Loge(Ratio) / FMath::Loge(Step.Amount)) + (bInclusive ? 1.0 : 0.0) };
+				}
+				// n^k 까지 배로 늘리면 k log n 번 (부류는 log n)
+				const double Degree = FMath::Max<double>(1.0, BoundDegree(BoundExpr));
+				return { FComplexityBound::Logarithmic(), Degree * FMath::Log2(N) };
+			}
+
+			if (bConstantRange)
+			{
+				const double Count = FMath::CeilToDouble(FMath::Abs(End - Start) / Step.Amount) + (bInclusive ? 1.0 : 0.0);
+				return { FComplexityBound::Constant(), FMath::Max(0.0, Count) };
+			}
+
+			const uint8 Degree = FMath::Max<uint8>(1, BoundDegree(BoundExpr));
+			return { FComplexityBound::Polynomial(Degree), FMath::Pow(N, static_cast<double>(Degree)) };
+		}
+
+		// 조건식에서 비교 대상 변수 이름 (while 조건의 반복 변수 추정)
+		FString FindConditionVariable(const FExpression* Condition)
+		{
+			if (!Condition || Condition->Kind != EExpressionKind::Binary)
+			{
+				return FString();
+			}
+			const FBinaryExpression* Cond = static_cast<const FBinaryExpression*>(Condition);
+			if (Cond->Left.IsValid() && Cond->Left->Kind == EExpressionKind::Identifier)
+			{
+				return static_cast<const FIdentifierExpression*>(Cond->Left.Get())->Name;
+			}
+			if (Cond->Right.IsValid() && Cond->Right->Kind == EExpressionKind::Identifier)
+			{
+				return static_cast<const FIdentifierExpression*>(Cond->Right.Get())->Name;
+			}
+			return FString();
+		}
+
+		// 재귀 호출 인자가 입력을 나누는지 (n / 2 → 깊이 log n)
+		bool ContainsHalving(const FExpression* Expr)
+		{
+			if (!Expr)
+			{
+				return false;
+			}
+
+			switch (Expr->Kind)
+			{
+			case EExpressionKind::Binary:
+			{
+				const FBinaryExpression* Bin = static_cast<const FBinaryExpression*>(Expr);
+				double Divisor = 0.0;
+				if (Bin->Op == EBinaryOp::Div && TryGetNumberLiteral(Bin->Right.Get(), Divisor) && Divisor > 1.0)
+				{
+					return true;
+				}
+				return ContainsHalving(Bin->Left.Get()) || ContainsHalving(Bin->Right.Get());
+			}
+			case EExpressionKind::Grouping:
+				return ContainsHalving(static_cast<const FGroupingExpression*>(Expr)->Inner.Get());
+			case EExpressionKind::Call:
+				for (const FExpressionPtr& Arg : static_cast<const FCallExpression*>(Expr)->Arguments)
+				{
+					if (ContainsHalving(Arg.Get()))
+					{
+						return true;
+					}
+				}
+				return false;
+			default:
+				return false;
+			}
+		}
+
+		FComplexityBound BoundFromNativeScore(const int32 Score)
+		{
+			if (Score >= FTimeComplexityAnalyzer::LinearithmicNativeScore)
+			{
+				FComplexityBound Bound = FComplexityBound::Linear();
+				Bound.LogDegree = 1;
+				return Bound;
+			}
+			if (Score >= FTimeComplexityAnalyzer::LinearNativeScore)
+			{
+				return FComplexityBound::Linear();
+			}
+			return FComplexityBound::Constant();
+		}
+
+		uint64 MixHash(const uint64 Seed, const uint64 Value)
+		{
+			// splitmix64 마무리 단계로 섞음
+			uint64 X = Seed ^ (Value + 0x9E3779B97F4A7C15ull + (Seed << 6) + (Seed >> 2));
+			X = (X ^ (X >> 30)) * 0xBF58476D1CE4E5B9ull;
+			X = (X ^ (X >> 27)) * 0x94D049BB133111EBull;
+			return X ^ (X >> 31);
+		}
+
+		uint64 HashName(const FString& Name)
+		{
+			return CityHash64(reinterpret_cast<const char*>(*Name), Name.Len() * sizeof(TCHAR));
+		}
+
+		// 분석 결과가 바뀌었는지 비교하기 위한 지문
+		uint64 FingerprintOf(const FSpellComplexity& Complexity)
+		{
+			uint64 WorkBits = 0;
+			FMemory::Memcpy(&WorkBits, &Complexity.EstimatedWork, sizeof(WorkBits));
+
+			uint64 Hash = MixHash(Complexity.Bound.PolyDegree, Complexity.Bound.LogDegree);
+			Hash = MixHash(Hash, (Complexity.Bound.bExponential ? 2 : 0) | (Complexity.bRecursive ? 1 : 0));
+			return MixHash(Hash, WorkBits);
+		}
+
+		/**
+		 * AST 구조 해시 (노드 종류, 연산자, 이름, 리터럴만 반영하고 소스 위치는 제외)
+		 * - 중첩 spell 본문은 블록 포인터로 기억해 한 번만 해시
+		 */
+		class FStructuralHasher
+		{
+		public:
+			uint64 HashBlock(const FBlockStatement* Block)
+			{
+				if (!Block)
+				{
+					return 0x1;
+				}
+				if (const uint64* Cached = BlockHashes.Find(Block))
+				{
+					return *Cached;
+				}
+				const uint64 Hash = HashStatements(MixHash(0xB1, Block->Statements.Num()), Block->Statements);
+				BlockHashes.Add(Block, Hash);
+				return Hash;
+			}
+
+		private:
+			TMap<const FBlockStatement*, uint64> BlockHashes;
+
+			uint64 HashStatements(uint64 Hash, const TArray<FStatementPtr>& Statements)
+			{
+				for (const FStatementPtr& Stmt : Statements)
+				{
+					Hash = MixHash(Hash, HashStatement(Stmt.Get()));
+				}
+				return Hash;
+			}
+
+			uint64 HashStatement(const FStatement* Stmt)
+			{
+				if (!Stmt)
+				{
+					return 0x2;
+				}
+
+				uint64 Hash = MixHash(0x53, static_cast<uint64>(Stmt->Kind));
+				switch (Stmt->Kind)
+				{
+				case EStatementKind::Block:
+					return MixHash(Hash, HashBlock(static_cast<const FBlockStatement*>(Stmt)));
+
+				case EStatementKind::VarDecl:
+				{
+					const FVarDeclStatement* VarDecl = static_cast<const FVarDeclStatement*>(Stmt);
+					Hash = MixHash(Hash, HashName(VarDecl->Name));
+					Hash = MixHash(Hash, VarDecl->bIsConst ? 1 : 0);
+					return MixHash(Hash, HashExpression(VarDecl->Initializer.Get()));
+				}
+
+				case EStatementKind::FuncDecl:
+				{
+					const FFuncDeclStatement* FuncDecl = static_cast<const FFuncDeclStatement*>(Stmt);
+					Hash = MixHash(Hash, HashName(FuncDecl->Name));
+					for (const FString& Param : FuncDecl->Parameters)
+					{
+						Hash = MixHash(Hash, HashName(Param));
+					}
+					return MixHash(Hash, HashBlock(FuncDecl->Body.Get()));
+				}
+
+				case EStatementKind::Import:
+					return MixHash(Hash, HashName(static_cast<const FImportStatement*>(Stmt)->Path));
+
+				case EStatementKind::If:
+				{
+					const FIfStatement* IfStmt = static_cast<const FIfStatement*>(Stmt);
+					Hash = MixHash(Hash, HashExpression(IfStmt->Condition.Get()));
+					Hash = MixHash(Hash, HashStatement(IfStmt->ThenBranch.Get()));
+					return MixHash(Hash, HashStatement(IfStmt->ElseBranch.Get()));
+				}
+
+				case EStatementKind::Switch:
+				{
+					const FSwitchStatement* SwitchStmt = static_cast<const FSwitchStatement*>(Stmt);
+					Hash = MixHash(Hash, HashExpression(SwitchStmt->Expression.Get()));
+					for (const FSwitchCase& Case : SwitchStmt->Cases)
+					{
+						Hash = MixHash(Hash, HashExpression(Case.Value.Get()));
+						Hash = HashStatements(MixHash(Hash, Case.Statements.Num()), Case.Statements);
+					}
+					return Hash;
+				}
+
+				case EStatementKind::While:
+				{
+					const FWhileStatement* WhileStmt = static_cast<const FWhileStatement*>(Stmt);
+					Hash = MixHash(Hash, HashExpression(WhileStmt->Condition.Get()));
+					return MixHash(Hash, HashStatement(WhileStmt->Body.Get()));
+				}
+
+				case EStatementKind::For:
+				{
+					const FForStatement* ForStmt = static_cast<const FForStatement*>(Stmt);
+					Hash = MixHash(Hash, HashStatement(ForStmt->Init.Get()));
+					Hash = MixHash(Hash, HashExpression(ForStmt->Condition.Get()));
+					Hash = MixHash(Hash, HashExpression(ForStmt->Increment.Get()));
+					return MixHash(Hash, HashStatement(ForStmt->Body.Get()));
+				}
+
+				case EStatementKind::Return:
+					return MixHash(Hash, HashExpression(static_cast<const FReturnStatement*>(Stmt)->Value.Get()));
+
+				case EStatementKind::Expr:
+					return MixHash(Hash, HashExpression(static_cast<const FExpressionStatement*>(Stmt)->Expr.Get()));
+
+				default:
+					return Hash;
+				}
+			}
+
+			uint64 HashExpression(const FExpression* Expr)
+			{
+				if (!Expr)
+				{
+					return 0x3;
+				}
+
+				uint64 Hash = MixHash(0x45, static_cast<uint64>(Expr->Kind));
+				switch (Expr->Kind)
+				{
+				case EExpressionKind::Binary:
+				{
+					const FBinaryExpression* Bin = static_cast<const FBinaryExpression*>(Expr);
+					Hash = MixHash(Hash, static_cast<uint64>(Bin->Op));
+					Hash = MixHash(Hash, HashExpression(Bin->Left.Get()));
+					return MixHash(Hash, HashExpression(Bin->Right.Get()));
+				}
+
+				case EExpressionKind::Unary:
+				{
+					const FUnaryExpression* Un = static_cast<const FUnaryExpression*>(Expr);
+					Hash = MixHash(Hash, static_cast<uint64>(Un->Op));
+					return MixHash(Hash, HashExpression(Un->Operand.Get()));
+				}
+
+				case EExpressionKind::Literal:
+				{
+					const FToken& Token = static_cast<const FLiteralExpression*>(Expr)->LiteralToken;
+					Hash = MixHash(Hash, static_cast<uint64>(Token.Type));
+					return MixHash(Hash, HashName(Token.Lexeme));
+				}
+
+				case EExpressionKind::Identifier:
+					return MixHash(Hash, HashName(static_cast<const FIdentifierExpression*>(Expr)->Name));
+
+				case EExpressionKind::Assignment:
+				{
+					const FAssignmentExpression* Assign = static_cast<const FAssignmentExpression*>(Expr);
+					Hash = MixHash(Hash, static_cast<uint64>(Assign->Op));
+					Hash = MixHash(Hash, HashName(Assign->TargetName));
+					Hash = MixHash(Hash, HashName(Assign->MemberName));
+					Hash = MixHash(Hash, HashExpression(Assign->Index.Get()));
+					return MixHash(Hash, HashExpression(Assign->Value.Get()));
+				}
+
+				case EExpressionKind::Call:
+				{
+					const FCallExpression* Call = static_cast<const FCallExpression*>(Expr);
+					Hash = MixHash(Hash, HashName(Call->CalleeName));
+					Hash = MixHash(Hash, HashExpression(Call->ThisValue.Get()));
+					Hash = MixHash(Hash, Call->Arguments.Num());
+					for (const FExpressionPtr& Arg : Call->Arguments)
+					{
+						Hash = MixHash(Hash, HashExpression(Arg.Get()));
+					}
+					return Hash;
+				}
+
+				case EExpressionKind::Grouping:
+					return MixHash(Hash, HashExpression(static_cast<const FGroupingExpression*>(Expr)->Inner.Get()));
+
+				case EExpressionKind::ArrayLiteral:
+				{
+					const FArrayLiteralExpression* ArrayExpr = static_cast<const FArrayLiteralExpression*>(Expr);
+					Hash = MixHash(Hash, ArrayExpr->Elements.Num());
+					for (const FExpressionPtr& Element : ArrayExpr->Elements)
+					{
+						Hash = MixHash(Hash, HashExpression(Element.Get()));
+					}
+					return Hash;
+				}
+
+				case EExpressionKind::ObjectLiteral:
+				{
+					const FObjectLiteralExpression* ObjectExpr = static_cast<const FObjectLiteralExpression*>(Expr);
+					Hash = MixHash(Hash, ObjectExpr->Properties.Num());
+					for (const FObjectProperty& Property : ObjectExpr->Properties)
+					{
+						Hash = MixHash(Hash, HashName(Property.Key));
+						Hash = MixHash(Hash, HashExpression(Property.Value.Get()));
+					}
+					return Hash;
+				}
+
+				case EExpressionKind::Index:
+				{
+					const FIndexExpression* IndexExpr = static_cast<const FIndexExpression*>(Expr);
+					Hash = MixHash(Hash, HashExpression(IndexExpr->Target.Get()));
+					return MixHash(Hash, HashExpression(IndexExpr->Index.Get()));
+				}
+
+				case EExpressionKind::MemberAccess:
+				{
+					const FMemberAccessExpression* Member = static_cast<const FMemberAccessExpression*>(Expr);
+					Hash = MixHash(Hash, HashExpression(Member->Target.Get()));
+					return MixHash(Hash, HashName(Member->MemberName));
+				}
+
+				case EExpressionKind::ArrowFunction:
+				{
+					// 단일 표현식 본문도 파서가 BodyBlock으로 감싸 두므로 블록만 해시
+					const FArrowFunctionExpression* Arrow = static_cast<const FArrowFunctionExpression*>(Expr);
+					for (const FString& Param : Arrow->Parameters)
+					{
+						Hash = MixHash(Hash, HashName(Param));
+					}
+					return MixHash(Hash, Arrow->BodyBlock.IsValid()
+						? HashBlock(Arrow->BodyBlock.Get()) : HashExpression(Arrow->Body.Get()));
+				}
+
+				case EExpressionKind::PostfixIncrement:
+				case EExpressionKind::PostfixDecrement:
+					return MixHash(Hash, HashExpression(static_cast<const FPostfixExpression*>(Expr)->Operand.Get()));
+
+				default:
+					return Hash;
+				}
+			}
+		};
+
+		/**
+		 * 프로그램 하나를 분석하는 동안의 상태
+		 * - spell 비용은 처음 호출을 만났을 때 한 번 계산하고 기억 (호출 그래프 DFS)
+		 * - 분석 중인 spell을 다시 만나면 재귀 호출 위치로 세고 비용은 spell이 끝날 때 깊이만큼 곱함
+		 * - Cache가 있으면 spell을 분석하기 전에 기록을 찾고, 호출한 spell/네이티브 결과가 같으면 기록을 씀
+		 */
+		class FAnalysisContext
+		{
+		public:
+			FAnalysisContext(FTimeComplexityResult& InResult, const TSharedPtr<FEnvironment>& InNatives, FTimeComplexityCache* InCache)
+				: Result(InResult)
+				, Natives(InNatives)
+				, Cache(InCache)
+			{
+			}
+
+			// spell 선언(이름 있는 spell, `let f = (x) => ...`)을 모두 등록
+			void CollectSpells(const TArray<FStatementPtr>& Statements);
+			void CollectSpellsInStatement(const FStatement* Stmt);
+			void GetSpellNames(TArray<FString>& OutNames) const { Spells.GetKeys(OutNames); }
+
+			FCost AnalyzeStatements(const TArray<FStatementPtr>& Statements, int32 Depth);
+			FCost AnalyzeStatement(const FStatement* Stmt, int32 Depth);
+			FCost AnalyzeExpression(const FExpression* Expr, int32 Depth);
+
+			// 이름으로 spell 비용 (스크립트 spell이 아니면 null)
+			const FSpellComplexity* AnalyzeSpell(const FString& Name);
+
+			// 다른 spell/전역 코드에서 호출되지 않은 spell (진입점) 비용 합
+			double SumEntryPointWork() const;
+
+			// 전역 코드 분석이 끝나면 그 카운터를 결과에 더함
+			void FinishTopLevel() { AddCounters(Local); Local = FCounters(); }
+
+		private:
+			enum class ESpellState : uint8
+			{
+				Pending,
+				InProgress,
+				Done
+			};
+
+			struct FSpellEntry
+			{
+				const FBlockStatement* Body = nullptr;
+				ESpellState State = ESpellState::Pending;
+				int32 RecursiveCallSites = 0;   // 루프 안의 재귀 호출은 2로 셈
+				bool bHalvesInput = false;
+				FSpellComplexity Complexity;
+			};
+
+			// 분석 중인 spell 하나 (기록할 의존 목록을 모음)
+			struct FSpellFrame
+			{
+				FString Name;
+				TArray<FSpellDependency> Dependencies;
+				bool bCacheable = true;  // 상호 재귀 순환에 속하면 다른 spell의 분석 순서에 따라 결과가 달라지므로 기록하지 않음
+			};
+
+			// 지금 분석 중인 본문(spell 또는 전역 코드)에서 센 값 (호출한 spell 본문 것은 제외)
+			struct FCounters
+			{
+				int32 StatementCount = 0;
+				int32 FunctionCallCount = 0;
+				int32 MaxLoopDepth = 0;
+			};
+
+			FTimeComplexityResult& Result;
+			TSharedPtr<FEnvironment> Natives;
+			FTimeComplexityCache* Cache = nullptr;
+			FStructuralHasher Hasher;
+			TMap<FString, FSpellEntry> Spells;
+			TSet<FString> CalledSpells;
+			TArray<FSpellFrame> SpellStack;
+			FCounters Local;
+
+			void AddCounters(const FCounters& Counters)
+			{
+				Result.StatementCount += Counters.StatementCount;
+				Result.FunctionCallCount += Counters.FunctionCallCount;
+				Result.MaxLoopDepth = FMath::Max(Result.MaxLoopDepth, Counters.MaxLoopDepth);
+			}
+
+			void AddDependency(const FString& Name, const bool bNative, const uint64 Fingerprint)
+			{
+				if (SpellStack.Num() > 0)
+				{
+					SpellStack.Last().Dependencies.Add({ Name, bNative, Fingerprint });
+				}
+			}
+
+			// 분석 중인 spell(SpellStack 순서)의 재귀 호출 위치 수 (if 분기별로 따로 세기 위해 저장/복원)
+			using FRecursiveCallSites = TArray<int32, TInlineAllocator<8>>;
+			FRecursiveCallSites GetRecursiveCallSites() const
+			{
+				FRecursiveCallSites Sites;
+				for (const FSpellFrame& Frame : SpellStack)
+				{
+					Sites.Add(Spells.FindChecked(Frame.Name).RecursiveCallSites);
+				}
+				return Sites;
+			}
+			void SetRecursiveCallSites(const FRecursiveCallSites& Sites)
+			{
+				for (int32 Index = 0; Index < Sites.Num(); ++Index)
+				{
+					Spells.FindChecked(SpellStack[Index].Name).RecursiveCallSites = Sites[Index];
+				}
+			}
+
+			// 기록이 지금 프로그램에서도 맞는지 (호출한 spell은 이 과정에서 분석/재사용됨)
+			bool ValidateRecord(const FSpellAnalysisRecord& Record, const FSpellEntry& Entry);
+
+			FCost AnalyzeCall(const FCallExpression* Call, int32 Depth);
+			FCost AnalyzeLoop(const FString& Var, const FExpression* InitValue, const FExpression* Condition,
+				const FLoopStep& Step, const FCost& PerIteration, int32 Depth);
+			int32 FindNativeScore(const FString& CalleeName) const;
+		};
+
+		void FAnalysisContext::CollectSpells(const TArray<FStatementPtr>& Statements)
+		{
+			for (const FStatementPtr& Stmt : Statements)
+			{
+				CollectSpellsInStatement(Stmt.Get());
+			}
+		}
+
+		void FAnalysisContext::CollectSpellsInStatement(const FStatement* Stmt)
+		{
+			if (!Stmt)
+			{
+				return;
+			}
+
+			switch (Stmt->Kind)
+			{
+			case EStatementKind::FuncDecl:
+			{
+				const FFuncDeclStatement* FuncDecl = static_cast<const FFuncDeclStatement*>(Stmt);
+				if (FuncDecl->Body.IsValid())
+				{
+					Spells.FindOrAdd(FuncDecl->Name).Body = FuncDecl->Body.Get();
+					CollectSpells(FuncDecl->Body->Statements);
+				}
+				break;
+			}
+			case EStatementKind::VarDecl:
+			{
+				const FVarDeclStatement* Var = static_cast<const FVarDeclStatement*>(Stmt);
+				if (Var->Initializer.IsValid() && Var->Initializer->Kind == EExpressionKind::ArrowFunction)
+				{
+					const FArrowFunctionExpression* Arrow = static_cast<const FArrowFunctionExpression*>(Var->Initializer.Get());
+					if (Arrow->BodyBlock.IsValid())
+					{
+						Spells.FindOrAdd(Var->Name).Body = Arrow->BodyBlock.Get();
+						CollectSpells(Arrow->BodyBlock->Statements);
+					}
+				}
+				break;
+			}
+			case EStatementKind::Block:
+				CollectSpells(static_cast<const FBlockStatement*>(Stmt)->Statements);
+				break;
+			case EStatementKind::If:
+			{
+				const FIfStatement* If = static_cast<const FIfStatement*>(Stmt);
+				CollectSpellsInStatement(If->ThenBranch.Get());
+				CollectSpellsInStatement(If->ElseBranch.Get());
+				break;
+			}
+			case EStatementKind::Switch:
+				for (const FSwitchCase& Case : static_cast<const FSwitchStatement*>(Stmt)->Cases)
+				{
+					CollectSpells(Case.Statements);
+				}
+				break;
+			case EStatementKind::While:
+				CollectSpellsInStatement(static_cast<const FWhileStatement*>(Stmt)->Body.Get());
+				break;
+			case EStatementKind::For:
+				CollectSpellsInStatement(static_cast<const FForStatement*>(Stmt)->Body.Get());
+				break;
+			default:
+				break;
+			}
+		}
+
+		FCost FAnalysisContext::AnalyzeStatements(const TArray<FStatementPtr>& Statements, const int32 Depth)
+		{
+			FCost Cost;
+			for (const FStatementPtr& Stmt : Statements)
+			{
+				Cost.Add(AnalyzeStatement(Stmt.Get(), Depth));
+			}
+			return Cost;
+		}
+
+		FCost FAnalysisContext::AnalyzeLoop(const FString& Var, const FExpression* InitValue, const FExpression* Condition,
+			const FLoopStep& Step, const FCost& PerIteration, const int32 Depth)
+		{
+			Local.MaxLoopDepth = FMath::Max(Local.MaxLoopDepth, Depth + 1);
+
+			// 조건이 없거나 항상 참이면 횟수를 알 수 없으므로 n번으로 봄 (실행은 예산/while 상한이 막음)
+			const FTripCount Trip = DeriveTripCount(Var, InitValue, Condition, Step);
+			return PerIteration.Repeat(Trip.Bound, Trip.Count);
+		}
+
+		FCost FAnalysisContext::AnalyzeStatement(const FStatement* Stmt, const int32 Depth)
+		{
+			FCost Cost;
+			if (!Stmt)
+			{
+				return Cost;
+			}
+
+			Local.StatementCount++;
+			Cost.Work = 1.0;
+
+			switch (Stmt->Kind)
+			{
+			case EStatementKind::Block:
+				Cost.Add(AnalyzeStatements(static_cast<const FBlockStatement*>(Stmt)->Statements, Depth));
+				break;
+
+			case EStatementKind::VarDecl:
+			{
+				const FVarDeclStatement* VarDecl = static_cast<const FVarDeclStatement*>(Stmt);
+				Cost.Add(AnalyzeExpression(VarDecl->Initializer.Get(), Depth));
+				break;
+			}
+
+			case EStatementKind::FuncDecl:
+				// 본문 비용은 호출하는 쪽에서 AnalyzeSpell로 반영
+				break;
+
+			case EStatementKind::If:
+			{
+				// 두 분기 중 비싼 쪽
+				const FIfStatement* IfStmt = static_cast<const FIfStatement*>(Stmt);
+				Cost.Add(AnalyzeExpression(IfStmt->Condition.Get(), Depth));
+
+				// 한 번의 호출에서는 한 분기만 실행되므로 재귀 호출 위치도 분기별로 세고 많은 쪽을 씀 (이진 탐색은 1회)
+				const FRecursiveCallSites SitesBefore = GetRecursiveCallSites();
+				const FCost Then = AnalyzeStatement(IfStmt->ThenBranch.Get(), Depth);
+				const FRecursiveCallSites SitesThen = GetRecursiveCallSites();
+				SetRecursiveCallSites(SitesBefore);
+				const FCost Else = AnalyzeStatement(IfStmt->ElseBranch.Get(), Depth);
+				FRecursiveCallSites SitesBranch = GetRecursiveCallSites();
+				for (int32 Index = 0; Index < SitesBranch.Num(); ++Index)
+				{
+					SitesBranch[Index] = FMath::Max(SitesBranch[Index], SitesThen[Index]);
+				}
+				SetRecursiveCallSites(SitesBranch);
+
+				FCost Branch;
+				Branch.Bound = FComplexityBound::Max(Then.Bound, Else.Bound);
+				Branch.Work = FMath::Max(Then.Work, Else.Work);
+				Cost.Add(Branch);
+				break;
+			}
+
+			case EStatementKind::Switch:
+			{
+				// case는 다음 case로 이어질 수 있으므로 모두 더함
+				const FSwitchStatement* SwitchStmt = static_cast<const FSwitchStatement*>(Stmt);
+				Cost.Add(AnalyzeExpression(SwitchStmt->Expression.Get(), Depth));
+				for (const FSwitchCase& Case : SwitchStmt->Cases)
+				{
+					Cost.Add(AnalyzeExpression(Case.Value.Get(), Depth));
+					Cost.Add(AnalyzeStatements(Case.Statements, Depth));
+				}
+				break;
+			}
+
+			case EStatementKind::While:
+			{
+				const FWhileStatement* WhileStmt = static_cast<const FWhileStatement*>(Stmt);
+				FCost PerIteration = AnalyzeExpression(WhileStmt->Condition.Get(), Depth + 1);
+				PerIteration.Add(AnalyzeStatement(WhileStmt->Body.Get(), Depth + 1));
+
+				// 조건의 변수를 본문 최상위 문장에서 갱신하는 방식으로 반복 횟수 추정
+				const FString Var = FindConditionVariable(WhileStmt->Condition.Get());
+				FLoopStep Step;
+				if (!Var.IsEmpty() && WhileStmt->Body.IsValid())
+				{
+					const FStatement* Body = WhileStmt->Body.Get();
+					auto ClassifyStatement = [&Var](const FStatement* S)
+					{
+						return (S && S->Kind == EStatementKind::Expr)
+							? ClassifyUpdate(static_cast<const FExpressionStatement*>(S)->Expr.Get(), Var) : FLoopStep();
+					};
+
+					if (Body->Kind == EStatementKind::Block)
+					{
+						for (const FStatementPtr& Inner : static_cast<const FBlockStatement*>(Body)->Statements)
+						{
+							Step = ClassifyStatement(Inner.Get());
+							if (Step.Kind != EStepKind::None)
+							{
+								break;
+							}
+						}
+					}
+					else
+					{
+						Step = ClassifyStatement(Body);
+					}
+				}
+
+				Cost.Add(AnalyzeLoop(Var, nullptr, WhileStmt->Condition.Get(), Step, PerIteration, Depth));
+				break;
+			}
+
+			case EStatementKind::For:
+			{
+				const FForStatement* ForStmt = static_cast<const FForStatement*>(Stmt);
+				Cost.Add(AnalyzeStatement(ForStmt->Init.Get(), Depth));
+
+				FCost PerIteration = AnalyzeExpression(ForStmt->Condition.Get(), Depth + 1);
+				PerIteration.Add(AnalyzeExpression(ForStmt->Increment.Get(), Depth + 1));
+				PerIteration.Add(AnalyzeStatement(ForStmt->Body.Get(), Depth + 1));
+
+				// 초기화 문장에서 반복 변수와 시작값
+				FString Var;
+				const FExpression* InitValue = nullptr;
+				if (const FStatement* Init = ForStmt->Init.Get())
+				{
+					if (Init->Kind == EStatementKind::VarDecl)
+					{
+						const FVarDeclStatement* InitDecl = static_cast<const FVarDeclStatement*>(Init);
+						Var = InitDecl->Name;
+						InitValue = InitDecl->Initializer.Get();
+					}
+					else if (Init->Kind == EStatementKind::Expr)
+					{
+						const FExpression* InitExpr = static_cast<const FExpressionStatement*>(Init)->Expr.Get();
+						if (InitExpr && InitExpr->Kind == EExpressionKind::Assignment)
+						{
+							const FAssignmentExpression* InitAssign = static_cast<const FAssignmentExpression*>(InitExpr);
+							Var = InitAssign->TargetName;
+							InitValue = InitAssign->Value.Get();
+						}
+					}
+				}
+				if (Var.IsEmpty())
+				{
+					Var = FindConditionVariable(ForStmt->Condition.Get());
+				}
+
+				const FLoopStep Step = ClassifyUpdate(ForStmt->Increment.Get(), Var);
+				Cost.Add(AnalyzeLoop(Var, InitValue, ForStmt->Condition.Get(), Step, PerIteration, Depth));
+				break;
+			}
+
+			case EStatementKind::Return:
+				Cost.Add(AnalyzeExpression(static_cast<const FReturnStatement*>(Stmt)->Value.Get(), Depth));
+				break;
+
+			case EStatementKind::Expr:
+				Cost.Add(AnalyzeExpression(static_cast<const FExpressionStatement*>(Stmt)->Expr.Get(), Depth));
+				break;
+
+			case EStatementKind::Import:
+				// Import는 복잡도에 영향 없음
+				break;
+
+			default:
+				break;
+			}
+
+			return Cost;
+		}
+
+		FCost FAnalysisContext::AnalyzeExpression(const FExpression* Expr, const int32 Depth)
+		{
+			FCost Cost;
+			if (!Expr)
+			{
+				return Cost;
+			}
+
+			Cost.Work = 1.0;
+
+			switch (Expr->Kind)
+			{
+			case EExpressionKind::Binary:
+			{
+				const FBinaryExpression* Bin = static_cast<const FBinaryExpression*>(Expr);
+				Cost.Add(AnalyzeExpression(Bin->Left.Get(), Depth));
+				Cost.Add(AnalyzeExpression(Bin->Right.Get(), Depth));
+				break;
+			}
+
+			case EExpressionKind::Unary:
+				Cost.Add(AnalyzeExpression(static_cast<const FUnaryExpression*>(Expr)->Operand.Get(), Depth));
+				break;
+
+			case EExpressionKind::Call:
+				Cost.Add(AnalyzeCall(static_cast<const FCallExpression*>(Expr), Depth));
+				break;
+
+			case EExpressionKind::Assignment:
+			{
+				const FAssignmentExpression* Assign = static_cast<const FAssignmentExpression*>(Expr);
+				Cost.Add(AnalyzeExpression(Assign->Index.Get(), Depth));
+				Cost.Add(AnalyzeExpression(Assign->Value.Get(), Depth));
+				break;
+			}
+
+			case EExpressionKind::Grouping:
+				Cost.Add(AnalyzeExpression(static_cast<const FGroupingExpression*>(Expr)->Inner.Get(), Depth));
+				break;
+
+			case EExpressionKind::ArrayLiteral:
+				for (const FExpressionPtr& Element : static_cast<const FArrayLiteralExpression*>(Expr)->Elements)
+				{
+					Cost.Add(AnalyzeExpression(Element.Get(), Depth));
+				}
+				break;
+
+			case EExpressionKind::ObjectLiteral:
+				for (const FObjectProperty& Property : static_cast<const FObjectLiteralExpression*>(Expr)->Properties)
+				{
+					Cost.Add(AnalyzeExpression(Property.Value.Get(), Depth));
+				}
+				break;
+
+			case EExpressionKind::Index:
+			{
+				const FIndexExpression* IndexExpr = static_cast<const FIndexExpression*>(Expr);
+				Cost.Add(AnalyzeExpression(IndexExpr->Target.Get(), Depth));
+				Cost.Add(AnalyzeExpression(IndexExpr->Index.Get(), Depth));
+				break;
+			}
+
+			case EExpressionKind::MemberAccess:
+				Cost.Add(AnalyzeExpression(static_cast<const FMemberAccessExpression*>(Expr)->Target.Get(), Depth));
+				break;
+
+			case EExpressionKind::PostfixIncrement:
+			case EExpressionKind::PostfixDecrement:
+				Cost.Add(AnalyzeExpression(static_cast<const FPostfixExpression*>(Expr)->Operand.Get(), Depth));
+				break;
+
+			case EExpressionKind::ArrowFunction:
+				// 만드는 비용만 (본문은 호출되는 곳에서 반영)
+			case EExpressionKind::Literal:
+			case EExpressionKind::Identifier:
+				// 리터럴과 식별자는 기본 복잡도 1
+				break;
+
+			default:
+				break;
+			}
+
+			return Cost;
+		}
+
+		FCost FAnalysisContext::AnalyzeCall(const FCallExpression* Call, const int32 Depth)
+		{
+			Local.FunctionCallCount++;
+
+			FCost Cost;
+			Cost.Work = 5.0;  // 호출 자체의 추가 비용
+			Cost.Add(AnalyzeExpression(Call->ThisValue.Get(), Depth));
+
+			// 넘긴 arrow 콜백 본문 비용 (네이티브가 원소마다 부르면 그만큼 곱함)
+			FCost CallbackCost;
+			for (const FExpressionPtr& Arg : Call->Arguments)
+			{
+				Cost.Add(AnalyzeExpression(Arg.Get(), Depth));
+				if (Arg.IsValid() && Arg->Kind == EExpressionKind::ArrowFunction)
+				{
+					const FArrowFunctionExpression* Arrow = static_cast<const FArrowFunctionExpression*>(Arg.Get());
+					if (Arrow->BodyBlock.IsValid())
+					{
+						CallbackCost.Add(AnalyzeStatements(Arrow->BodyBlock->Statements, Depth + 1));
+					}
+				}
+			}
+
+			if (FSpellEntry* Entry = Spells.Find(Call->CalleeName))
+			{
+				if (Entry->State == ESpellState::InProgress)
+				{
+					// 분석 중인 spell을 다시 부름 → 재귀 호출 위치
+					Entry->RecursiveCallSites += (Depth > 0) ? 2 : 1;
+					Entry->Complexity.bRecursive = true;
+
+					// 상호 재귀면 순환에 속한 spell 모두 재귀로 표시 (비용은 순환의 시작 spell에만 반영)
+					int32 Index = SpellStack.Num() - 1;
+					for (; Index >= 0 && SpellStack[Index].Name != Call->CalleeName; --Index)
+					{
+						Spells[SpellStack[Index].Name].Complexity.bRecursive = true;
+						SpellStack[Index].bCacheable = false;
+					}
+					if (Index >= 0 && Index != SpellStack.Num() - 1)
+					{
+						SpellStack[Index].bCacheable = false;
+					}
+					for (const FExpressionPtr& Arg : Call->Arguments)
+					{
+						Entry->bHalvesInput |= ContainsHalving(Arg.Get());
+					}
+				}
+				else if (const FSpellComplexity* Callee = AnalyzeSpell(Call->CalleeName))
+				{
+					CalledSpells.Add(Call->CalleeName);
+					AddDependency(Call->CalleeName, false, FingerprintOf(*Callee));
+					FCost CalleeCost;
+					CalleeCost.Bound = Callee->Bound;
+					CalleeCost.Work = Callee->EstimatedWork;
+					Cost.Add(CalleeCost);
+				}
+				Cost.Add(CallbackCost);
+				return Cost;
+			}
+
+			const int32 NativeScore = FindNativeScore(Call->CalleeName);
+			AddDependency(Call->CalleeName, true, static_cast<uint64>(NativeScore));
+			const FComplexityBound NativeBound = BoundFromNativeScore(NativeScore);
+			FCost NativeCost;
+			NativeCost.Bound = NativeBound;
+			NativeCost.Work = NativeScore;
+			Cost.Add(NativeCost);
+			Cost.Add(CallbackCost.Repeat(NativeBound,
+				NativeBound.IsConstant() ? 1.0 : NativeBound.Evaluate(FTimeComplexityAnalyzer::ReferenceInputSize)));
+			return Cost;
+		}
+
+		int32 FAnalysisContext::FindNativeScore(const FString& CalleeName) const
+		{
+			if (!Natives.IsValid())
+			{
+				return 0;
+			}
+
+			auto ScoreOf = [this](const FString& Name) -> int32
+			{
+				const FEnvironment::FEntry* Entry = Natives->Lookup(Name);
+				return (Entry && Entry->Value.Type == EValueType::Function && Entry->Value.Function.IsValid())
+					? Entry->Value.Function->TimeComplexityAdditionalScore : 0;
+			};
+
+			int32 Score = ScoreOf(CalleeName);
+			FString Owner;
+			FString Member;
+			if (Score == 0 && CalleeName.Split(TEXT("."), &Owner, &Member, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+			{
+				// arr.push_back처럼 변수 이름으로 부른 메서드는 실행 시 값 타입으로 정해지므로 가능한 타입 중 가장 비싼 쪽
+				for (const TCHAR* TypeName : { TEXT("Array"), TEXT("String"), TEXT("Map"), TEXT("Set") })
+				{
+					Score = FMath::Max(Score, ScoreOf(FString::Printf(TEXT("%s.%s"), TypeName, *Member)));
+				}
+			}
+			return Score;
+		}
+
+		const FSpellComplexity* FAnalysisContext::AnalyzeSpell(const FString& Name)
+		{
+			FSpellEntry* Entry = Spells.Find(Name);
+			if (!Entry || !Entry->Body)
+			{
+				return nullptr;
+			}
+			if (Entry->State != ESpellState::Pending)
+			{
+				// 상호 재귀로 분석 중인 spell은 지금까지의 값 (순환의 시작 spell에 재귀 비용이 반영됨)
+				return &Entry->Complexity;
+			}
+
+			Entry->State = ESpellState::InProgress;
+			FSpellFrame& NewFrame = SpellStack.AddDefaulted_GetRef();
+			NewFrame.Name = Name;
+
+			const FCounters SavedCounters = Local;
+			Local = FCounters();
+
+			const uint64 Key = Cache ? MixHash(HashName(Name), Hasher.HashBlock(Entry->Body)) : 0;
+			if (Cache)
+			{
+				// 검증 중 다른 spell 기록이 추가되면 TMap이 커질 수 있으므로 복사해서 씀
+				const FSpellAnalysisRecord* Found = Cache->Find(Key);
+				const TOptional<FSpellAnalysisRecord> Record = Found ? TOptional<FSpellAnalysisRecord>(*Found) : TOptional<FSpellAnalysisRecord>();
+				if (Record.IsSet() && ValidateRecord(Record.GetValue(), *Entry))
+				{
+					SpellStack.Pop(EAllowShrinking::No);
+					Local = SavedCounters;
+					AddCounters({ Record->StatementCount, Record->FunctionCallCount, Record->MaxLoopDepth });
+					Result.ReusedSpellCount++;
+
+					Entry->Complexity = Record->Complexity;
+					Entry->State = ESpellState::Done;
+					return &Entry->Complexity;
+				}
+			}
+
+			FCost Cost = AnalyzeStatements(Entry->Body->Statements, 0);
+
+			if (Entry->RecursiveCallSites >= 2)
+			{
+				// 호출마다 두 번 이상 자신을 부르면 지수
+				Cost = Cost.Repeat(FComplexityBound::Exponential(),
+					FComplexityBound::Exponential().Evaluate(FTimeComplexityAnalyzer::ReferenceInputSize));
+			}
+			else if (Entry->RecursiveCallSites == 1)
+			{
+				// 한 번만 부르면 재귀 깊이만큼 (입력을 나누면 log n)
+				const FComplexityBound DepthBound = Entry->bHalvesInput ? FComplexityBound::Logarithmic() : FComplexityBound::Linear();
+				Cost = Cost.Repeat(DepthBound, DepthBound.Evaluate(FTimeComplexityAnalyzer::ReferenceInputSize));
+			}
+
+			Entry->Complexity.Bound = Cost.Bound;
+			Entry->Complexity.EstimatedWork = Cost.Work;
+			Entry->State = ESpellState::Done;
+
+			FSpellFrame Frame = SpellStack.Pop(EAllowShrinking::No);
+			const FCounters OwnCounters = Local;
+			Local = SavedCounters;
+			AddCounters(OwnCounters);
+
+			if (Cache && Frame.bCacheable)
+			{
+				FSpellAnalysisRecord Record;
+				Record.Complexity = Entry->Complexity;
+				Record.StatementCount = OwnCounters.StatementCount;
+				Record.FunctionCallCount = OwnCounters.FunctionCallCount;
+				Record.MaxLoopDepth = OwnCounters.MaxLoopDepth;
+				Record.Dependencies = MoveTemp(Frame.Dependencies);
+				Cache->Add(Key, MoveTemp(Record));
+			}
+			return &Entry->Complexity;
+		}
+
+		bool FAnalysisContext::ValidateRecord(const FSpellAnalysisRecord& Record, const FSpellEntry& Entry)
+		{
+			for (const FSpellDependency& Dependency : Record.Dependencies)
+			{
+				if (Dependency.bNative)
+				{
+					// 같은 이름의 스크립트 spell이 생겼거나 네이티브 점수가 바뀌면 다시 분석
+					if (Spells.Contains(Dependency.Name) || FindNativeScore(Dependency.Name) != static_cast<int32>(Dependency.Fingerprint))
+					{
+						return false;
+					}
+					continue;
+				}
+
+				const FSpellComplexity* Callee = AnalyzeSpell(Dependency.Name);
+				if (!Callee || FingerprintOf(*Callee) != Dependency.Fingerprint)
+				{
+					return false;
+				}
+				CalledSpells.Add(Dependency.Name);
+			}
+
+			// 호출한 spell이 이제 이 spell을 다시 부르면 (새 순환) 기록에 없는 재귀이므로 다시 분석
+			return Entry.RecursiveCallSites == 0 && SpellStack.Last().bCacheable;
+		}
+
+		double FAnalysisContext::SumEntryPointWork() const
+		{
+			double Work = 0.0;
+			for (const TPair<FString, FSpellEntry>& Pair : Spells)
+			{
+				if (!CalledSpells.Contains(Pair.Key))
+				{
+					Work += Pair.Value.Complexity.EstimatedWork;
+				}
+			}
+			return Work;
+		}
+	}
+
+	FTimeComplexityResult FTimeComplexityAnalyzer::AnalyzeProgram(const TSharedPtr<FProgram>& Program,
+		const TSharedPtr<FEnvironment>& Natives, FTimeComplexityCache* Cache)
+	{
+		FTimeComplexityResult Result;
+
+		if (!Program.IsValid())
+		{
+			return Result;
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		FAnalysisContext Context(Result, Natives, Cache);
+		Context.CollectSpells(Program->Statements);
+
+		// 전역 코드 (여기서 부른 spell은 호출 위치에서 비용이 반영됨)
+		const FCost TopLevel = Context.AnalyzeStatements(Program->Statements, 0);
+		Context.FinishTopLevel();
+		Result.AsymptoticBound = TopLevel.Bound;
+
+		// 전역 코드에서 부르지 않은 spell도 모두 분석 (진입점으로 호출될 수 있음)
+		TArray<FString> SpellNames;
+		Context.GetSpellNames(SpellNames);
+		for (const FString& Name : SpellNames)
+		{
+			if (const FSpellComplexity* Spell = Context.AnalyzeSpell(Name))
+			{
+				Result.SpellComplexities.Add(Name, *Spell);
+				Result.AsymptoticBound = FComplexityBound::Max(Result.AsymptoticBound, Spell->Bound);
+			}
+		}
+
+		Result.AnalysisTimeSeconds = FPlatformTime::Seconds() - StartTime;
+		const double Work = TopLevel.Work + Context.SumEntryPointWork();
+		Result.StaticComplexityScore = static_cast<int32>(FMath::Min(Work, static_cast<double>(MAX_int32)));
+
+		return Result;
+	}
+}
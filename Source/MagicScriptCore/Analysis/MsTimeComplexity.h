@@ -0,0 +1,166 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MagicScriptCore/Core/MsAst.h"
+
+namespace MagicScript
+{
+	class FEnvironment;
+
+	// 점근 복잡도 부류: O(n^PolyDegree * log^LogDegree n), bExponential이면 O(2^n)
+	struct MAGICSCRIPTCORE_API FComplexityBound
+	{
+		uint8 PolyDegree = 0;
+		uint8 LogDegree = 0;
+		bool bExponential = false;
+
+		static FComplexityBound Constant() { return FComplexityBound(); }
+		static FComplexityBound Logarithmic() { FComplexityBound B; B.LogDegree = 1; return B; }
+		static FComplexityBound Polynomial(const uint8 Degree) { FComplexityBound B; B.PolyDegree = Degree; return B; }
+		static FComplexityBound Linear() { return Polynomial(1); }
+		static FComplexityBound Exponential() { FComplexityBound B; B.bExponential = true; return B; }
+
+		// 이어서 실행 (큰 쪽)
+		static FComplexityBound Max(const FComplexityBound& A, const FComplexityBound& B);
+
+		// 반복 안에서 실행 (곱)
+		static FComplexityBound Multiply(const FComplexityBound& A, const FComplexityBound& B);
+
+		bool IsConstant() const { return !bExponential && PolyDegree == 0 && LogDegree == 0; }
+		bool operator<(const FComplexityBound& Other) const;
+
+		// 입력 크기 N에서의 값 (n^p * log2(n)^q 또는 2^n)
+		double Evaluate(double N) const;
+
+		// "O(1)", "O(log n)", "O(n)", "O(n log n)", "O(n^2)", "O(2^n)" ...
+		FString ToString() const;
+	};
+
+	// spell 하나의 정적 분석 결과 (1회 호출 기준)
+	struct MAGICSCRIPTCORE_API FSpellComplexity
+	{
+		FComplexityBound Bound;
+
+		// 기준 입력 크기(FTimeComplexityAnalyzer::ReferenceInputSize)에서의 예상 단위 연산 수
+		double EstimatedWork = 0.0;
+
+		// 자기 자신(또는 상호 재귀로 다시 자신)을 호출하는지
+		bool bRecursive = false;
+	};
+
+	// spell 분석 결과가 기대는 다른 spell/네이티브 (이름 + 그때의 결과 지문)
+	struct MAGICSCRIPTCORE_API FSpellDependency
+	{
+		FString Name;
+		bool bNative = false;
+		uint64 Fingerprint = 0;  // 스크립트 spell은 분석 결과 해시, 네이티브는 TimeComplexityAdditionalScore
+	};
+
+	// 메모해 둔 spell 하나의 분석 기록 (카운터는 본문 자체의 값, 호출한 spell 것은 제외)
+	struct MAGICSCRIPTCORE_API FSpellAnalysisRecord
+	{
+		FSpellComplexity Complexity;
+		int32 StatementCount = 0;
+		int32 FunctionCallCount = 0;
+		int32 MaxLoopDepth = 0;
+		TArray<FSpellDependency> Dependencies;
+	};
+
+	/**
+	 * spell 분석 결과 메모 (같은 모듈을 쓰는 스크립트끼리 공유)
+	 * - 키는 spell 이름 + 본문 AST의 구조 해시 (소스 위치는 넣지 않으므로 앞 줄을 고쳐도 키가 같음)
+	 * - 호출한 spell/네이티브의 지금 결과가 기록과 다르면 다시 분석 (고친 spell과 그 호출자만 다시 분석)
+	 * - 스크립트 캐시를 비워도 유지, MaxRecords를 넘으면 한 번에 비움
+	 */
+	class MAGICSCRIPTCORE_API FTimeComplexityCache
+	{
+	public:
+		static constexpr int32 MaxRecords = 4096;
+
+		const FSpellAnalysisRecord* Find(const uint64 Key) const { return Records.Find(Key); }
+		void Add(uint64 Key, FSpellAnalysisRecord&& Record);
+		void Empty() { Records.Empty(); }
+		int32 Num() const { return Records.Num(); }
+
+	private:
+		TMap<uint64, FSpellAnalysisRecord> Records;
+	};
+
+	// 스크립트의 시간 복잡도 분석 결과
+	struct MAGICSCRIPTCORE_API FTimeComplexityResult
+	{
+		// 정적 분석 점수 (기준 입력 크기에서 전역 코드 + 진입점 spell들의 예상 연산 수)
+		int32 StaticComplexityScore = 0;
+
+		// 프로그램 전체(전역 코드와 모든 spell 중 가장 큰) 점근 복잡도
+		FComplexityBound AsymptoticBound;
+
+		// spell 이름별 점근 복잡도 / 예상 연산 수
+		TMap<FString, FSpellComplexity> SpellComplexities;
+
+		// 동적 분석 점수 (실제 실행 횟수)
+		int64 DynamicExecutionCount = 0;
+
+		// 문장 수
+		int32 StatementCount = 0;
+
+		// 루프 깊이 (최대 중첩)
+		int32 MaxLoopDepth = 0;
+
+		// 함수 호출 수
+		int32 FunctionCallCount = 0;
+
+		// 메모(FTimeComplexityCache)에서 다시 분석하지 않고 가져온 spell 수
+		int32 ReusedSpellCount = 0;
+
+		// 표현식 평가 횟수
+		int64 ExpressionEvaluationCount = 0;
+
+		// 분석 시간 (초)
+		double AnalysisTimeSeconds = 0.0;
+
+		// 실행 시간 (초)
+		double ExecutionTimeSeconds = 0.0;
+
+		FString ToString() const
+		{
+			return FString::Printf(
+				TEXT("TimeComplexity[Static:%d %s, Dynamic:%lld, Statements:%d, MaxLoopDepth:%d, FuncCalls:%d, ReusedSpells:%d, ExprEvals:%lld, AnalysisTime:%.3fs, ExecTime:%.3fs]"),
+				StaticComplexityScore,
+				*AsymptoticBound.ToString(),
+				DynamicExecutionCount,
+				StatementCount,
+				MaxLoopDepth,
+				FunctionCallCount,
+				ReusedSpellCount,
+				ExpressionEvaluationCount,
+				AnalysisTimeSeconds,
+				ExecutionTimeSeconds
+			);
+		}
+	};
+
+	/**
+	 * AST를 분석하여 시간 복잡도를 계산하는 정적 분석기
+	 * - for/while의 초기값/조건/증감에서 반복 횟수를 기호적으로 유도 (상수, n, n^k, log n)
+	 * - 호출 그래프를 따라 호출된 spell의 비용을 호출 위치에 반영 (재귀 호출 위치 수로 O(n)/O(log n)/O(2^n) 판단)
+	 * - 네이티브 spell은 TimeComplexityAdditionalScore로 비용과 부류를 정하고, 넘긴 콜백 비용을 그만큼 곱함
+	 * - Cache를 주면 spell별 결과를 본문 구조 해시로 메모해 바뀌지 않은 spell은 다시 분석하지 않음
+	 */
+	class MAGICSCRIPTCORE_API FTimeComplexityAnalyzer
+	{
+	public:
+		// 반복 횟수를 모를 때 쓰는 기준 입력 크기 (점수는 이 크기에서의 예상 연산 수)
+		static constexpr double ReferenceInputSize = 16.0;
+
+		// 네이티브 점수 관례 (빌트인 등록 시 쓰는 값과 같음): 이 값 이상이면 O(n), O(n log n)
+		static constexpr int32 LinearNativeScore = 10;
+		static constexpr int32 LinearithmicNativeScore = 20;
+
+		// 프로그램의 시간 복잡도 분석
+		// Natives: 네이티브 spell을 찾을 환경 (null이면 네이티브 호출은 상수 비용)
+		// Cache: spell 분석 결과 메모 (null이면 매번 전체 분석)
+		static FTimeComplexityResult AnalyzeProgram(const TSharedPtr<FProgram>& Program,
+			const TSharedPtr<FEnvironment>& Natives = nullptr, FTimeComplexityCache* Cache = nullptr);
+	};
+}
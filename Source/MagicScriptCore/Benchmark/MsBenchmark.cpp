@@ -0,0 +1,507 @@
+#include "MagicScriptCore/Benchmark/MsBenchmark.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformProperties.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "MagicScriptCore/Core/MsLexer.h"
+#include "MagicScriptCore/Core/MsParser.h"
+#include "MagicScriptCore/Core/MsEnvironment.h"
+#include "MagicScriptCore/Logging/MsLogging.h"
+#include "MagicScriptCore/Runtime/MsInterpreter.h"
+#include "MagicScriptCore/Runtime/MsScriptRunner.h"
+#include <atomic>
+
+namespace MagicScript
+{
+	namespace
+	{
+		// 측정 중인 스레드의 할당만 집계 (다른 스레드는 카운터를 건드리지 않음)
+		thread_local bool bCountAllocations = false;
+		thread_local int64 ThreadAllocCount = 0;
+		thread_local int64 ThreadAllocBytes = 0;
+
+		/**
+		 * GMalloc을 감싸는 할당 카운터
+		 * - 첫 측정 때 한 번만 원자적으로 끼워 넣고 되돌리지 않음 (측정마다 GMalloc을 바꾸면 다른 스레드와 경쟁)
+		 * - 실제 할당은 원래 GMalloc에 그대로 위임하고, BeginCount()를 호출한 스레드의 할당만 집계
+		 */
+		class FMallocCounter final : public FMalloc
+		{
+		public:
+			// 감싸기에 실패하면 (다른 래퍼가 먼저 교체) false, 이때 할당 수는 0으로 보고됨
+			bool EnsureInstalled()
+			{
+				if (bInstalled.load(std::memory_order_acquire))
+				{
+					return true;
+				}
+				FMalloc* Current = GMalloc;
+				if (!Current || Current == this)
+				{
+					return false;
+				}
+				Inner = Current;
+				// Inner를 먼저 채운 뒤 교체를 공개 (전체 배리어)
+				if (FPlatformAtomics::InterlockedCompareExchangePointer(
+					reinterpret_cast<void**>(const_cast<FMalloc**>(&GMalloc)), this, Current) != Current)
+				{
+					Inner = nullptr;
+					return false;
+				}
+				bInstalled.store(true, std::memory_order_release);
+				return true;
+			}
+
+			void BeginCount()
+			{
+				ThreadAllocCount = 0;
+				ThreadAllocBytes = 0;
+				bCountAllocations = bInstalled.load(std::memory_order_acquire);
+			}
+
+			void EndCount() { bCountAllocations = false; }
+
+			int64 GetAllocCount() const { return ThreadAllocCount; }
+			int64 GetAllocBytes() const { return ThreadAllocBytes; }
+
+			virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+			{
+				Record(Count);
+				return Inner->Malloc(Count, Alignment);
+			}
+
+			virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+			{
+				Record(Count);
+				return Inner->TryMalloc(Count, Alignment);
+			}
+
+			virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+			{
+				// 크기 변경도 새 블록을 잡을 수 있으므로 할당으로 집계 (해제 목적의 0 크기는 제외)
+				if (Count > 0)
+				{
+					Record(Count);
+				}
+				return Inner->Realloc(Original, Count, Alignment);
+			}
+
+			virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+			{
+				if (Count > 0)
+				{
+					Record(Count);
+				}
+				return Inner->TryRealloc(Original, Count, Alignment);
+			}
+
+			virtual void Free(void* Original) override { Inner->Free(Original); }
+			virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+			virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+			virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+			virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+			virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+			virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+			virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+			virtual const TCHAR* GetDescriptiveName() override { return TEXT("MagicScriptBenchmarkCounter"); }
+
+		private:
+			static void Record(SIZE_T Count)
+			{
+				if (bCountAllocations)
+				{
+					++ThreadAllocCount;
+					ThreadAllocBytes += static_cast<int64>(Count);
+				}
+			}
+
+			FMalloc* Inner = nullptr;
+			std::atomic<bool> bInstalled{false};
+		};
+
+		FMallocCounter GMallocCounter;
+
+		// 호스트 없이 (빌트인 로그 없음) 모든 빌트인을 등록한 인터프리터
+		TSharedPtr<FInterpreter> CreateInterpreter(const FString& ScriptName)
+		{
+			return FScriptRunner::CreateInterpreter(ScriptName, nullptr);
+		}
+
+		TSharedPtr<FFunctionValue> FindNative(const TSharedPtr<FInterpreter>& Interpreter, const FString& Name)
+		{
+			FEnvironment::FEntry* Entry = Interpreter->GetGlobalEnv()->Lookup(Name);
+			check(Entry && Entry->Value.Type == EValueType::Function && Entry->Value.Function.IsValid());
+			return Entry->Value.Function;
+		}
+
+		// SpellCount개 spell로 이루어진 대형 소스 (렉서/파서 처리량 측정용)
+		FString GenerateLargeSource(int32 SpellCount)
+		{
+			TStringBuilder<16384> Builder;
+			for (int32 i = 0; i < SpellCount; ++i)
+			{
+				Builder.Appendf(TEXT("// generated helper %d\n"), i);
+				Builder.Appendf(TEXT("spell helper_%d(a, b) {\n"), i);
+				Builder.Appendf(TEXT("\tlet x = a * %d + b;\n"), i + 1);
+				Builder.Append(TEXT("\tif (x % 2 == 0) {\n\t\tx = x / 2;\n\t} else {\n\t\tx = x * 3 + 1;\n\t}\n"));
+				Builder.Appendf(TEXT("\tconst label = \"helper_%d\";\n"), i);
+				Builder.Append(TEXT("\treturn x;\n}\n\n"));
+			}
+
+			Builder.Append(TEXT("spell main() {\n\tlet total = 0;\n"));
+			for (int32 i = 0; i < SpellCount; ++i)
+			{
+				Builder.Appendf(TEXT("\ttotal = total + helper_%d(%d, total % 7);\n"), i, i);
+			}
+			Builder.Append(TEXT("\treturn total;\n}\n"));
+			return FString(Builder.ToString());
+		}
+
+		double CyclesToNanoseconds(uint64 Cycles)
+		{
+			return FPlatformTime::ToSeconds64(Cycles) * 1.0e9;
+		}
+	}
+
+	TArray<TPair<FString, FString>> FBenchmarkSuite::GetDefaultCorpus()
+	{
+		TArray<TPair<FString, FString>> Corpus;
+
+		// while은 반복 상한(128)이 있으므로 긴 루프는 모두 for 사용
+		Corpus.Emplace(TEXT("numeric_loop"), TEXT(
+			"spell main() {\n"
+			"\tlet sum = 0;\n"
+			"\tfor (let i = 0; i < 10000; i++) {\n"
+			"\t\tsum = sum + (i * 2) % 7;\n"
+			"\t\tif (sum > 100000) {\n"
+			"\t\t\tsum = sum - 100000;\n"
+			"\t\t}\n"
+			"\t}\n"
+			"\treturn sum;\n"
+			"}\n"));
+
+		// 호출 스택 상한(64) 안쪽 깊이의 재귀
+		Corpus.Emplace(TEXT("recursion_fib"), TEXT(
+			"spell fib(n) {\n"
+			"\tif (n < 2) {\n"
+			"\t\treturn n;\n"
+			"\t}\n"
+			"\treturn fib(n - 1) + fib(n - 2);\n"
+			"}\n"
+			"\n"
+			"spell main() {\n"
+			"\treturn fib(15);\n"
+			"}\n"));
+
+		Corpus.Emplace(TEXT("array_queue"), TEXT(
+			"spell main() {\n"
+			"\tlet queue = [];\n"
+			"\tfor (let i = 0; i < 2000; i++) {\n"
+			"\t\tArray.push_back(queue, i);\n"
+			"\t}\n"
+			"\tlet total = 0;\n"
+			"\tfor (let j = 0; j < 2000; j++) {\n"
+			"\t\tconst item = Array.pop_front(queue);\n"
+			"\t\ttotal = total + item;\n"
+			"\t\tif (item % 4 == 0) {\n"
+			"\t\t\tqueue.push_back(item + 1);\n"
+			"\t\t}\n"
+			"\t}\n"
+			"\treturn total;\n"
+			"}\n"));
+
+		Corpus.Emplace(TEXT("object_heavy"), TEXT(
+			"spell makeUnit(id) {\n"
+			"\treturn { id: id, hp: 100, pos: [id, id * 2], tag: \"unit\" };\n"
+			"}\n"
+			"\n"
+			"spell main() {\n"
+			"\tlet units = [];\n"
+			"\tfor (let i = 0; i < 500; i++) {\n"
+			"\t\tArray.push_back(units, makeUnit(i));\n"
+			"\t}\n"
+			"\tlet total = 0;\n"
+			"\tfor (let k = 0; k < 500; k++) {\n"
+			"\t\tlet unit = units[k];\n"
+			"\t\tunit.hp = unit.hp - k % 10;\n"
+			"\t\ttotal = total + unit.hp + unit.pos[1];\n"
+			"\t}\n"
+			"\treturn total;\n"
+			"}\n"));
+
+		Corpus.Emplace(TEXT("builtins_pipeline"), TEXT(
+			"spell main() {\n"
+			"\tlet data = [];\n"
+			"\tfor (let i = 0; i < 1000; i++) {\n"
+			"\t\tArray.push_back(data, (i * 7919) % 1000);\n"
+			"\t}\n"
+			"\tArray.sort(data);\n"
+			"\tlet doubled = Array.map(data, (v, i) => v * 2);\n"
+			"\tlet evens = Array.filter(doubled, (v, i) => v % 4 == 0);\n"
+			"\tlet seen = Map.create();\n"
+			"\tfor (let j = 0; j < Array.length(evens); j++) {\n"
+			"\t\tMap.set(seen, evens[j], j);\n"
+			"\t}\n"
+			"\treturn Array.reduce(evens, (acc, v, i) => acc + v, 0) + Map.size(seen);\n"
+			"}\n"));
+
+		Corpus.Emplace(TEXT("string_concat"), TEXT(
+			"spell main() {\n"
+			"\tlet text = \"\";\n"
+			"\tfor (let i = 0; i < 1000; i++) {\n"
+			"\t\ttext = text + \"ab,\";\n"
+			"\t}\n"
+			"\tlet parts = String.split(text, \",\");\n"
+			"\treturn String.length(text) + Array.length(parts);\n"
+			"}\n"));
+
+		Corpus.Emplace(TEXT("large_generated"), GenerateLargeSource(200));
+
+		return Corpus;
+	}
+
+	FBenchmarkSuite FBenchmarkSuite::CreateDefault(int32 IterationScale)
+	{
+		const int32 Scale = FMath::Max(1, IterationScale);
+
+		FBenchmarkSuite Suite;
+		for (const TPair<FString, FString>& Script : GetDefaultCorpus())
+		{
+			const int32 Iterations = (Script.Key == TEXT("large_generated") ? 10 : 20) * Scale;
+			Suite.AddScriptCases(Script.Key, Script.Value, Iterations);
+		}
+
+		// 배열 빌트인 네이티브 구현 직접 호출 (인터프리터 디스패치 비용 제외)
+		{
+			const TSharedPtr<FInterpreter> Interpreter = CreateInterpreter(TEXT("builtins"));
+			const TSharedPtr<FFunctionValue> Sort = FindNative(Interpreter, TEXT("Array.sort"));
+			const TSharedPtr<TArray<FValue>> Input = MakeScriptArray();
+			const TSharedPtr<TArray<FValue>> Shuffled = MakeScriptArray();
+			for (int32 i = 0; i < 4096; ++i)
+			{
+				Shuffled->Add(FValue::FromNumber((i * 7919) % 4096));
+			}
+
+			FBenchmarkCase Case;
+			Case.Name = TEXT("builtins/Array.sort_4096");
+			Case.Category = TEXT("builtins");
+			Case.Iterations = 50 * Scale;
+			Case.Prepare = [Input, Shuffled]() { *Input = *Shuffled; };
+			Case.Run = [Interpreter, Sort, Input]() -> int64
+			{
+				FScriptExecutionContext Context;
+				Context.Interpreter = Interpreter;
+				Sort->NativeImpl({ FValue::FromArray(Input) }, Context);
+				return 0;
+			};
+			Suite.AddCase(MoveTemp(Case));
+		}
+
+		{
+			const TSharedPtr<FInterpreter> Interpreter = CreateInterpreter(TEXT("builtins"));
+			const TSharedPtr<FFunctionValue> PushBack = FindNative(Interpreter, TEXT("Array.push_back"));
+			const TSharedPtr<FFunctionValue> PopFront = FindNative(Interpreter, TEXT("Array.pop_front"));
+			const TSharedPtr<TArray<FValue>> Queue = MakeScriptArray();
+
+			FBenchmarkCase Case;
+			Case.Name = TEXT("builtins/Array.queue_1024");
+			Case.Category = TEXT("builtins");
+			Case.Iterations = 50 * Scale;
+			Case.Prepare = [Queue]() { Queue->Reset(); };
+			Case.Run = [Interpreter, PushBack, PopFront, Queue]() -> int64
+			{
+				FScriptExecutionContext Context;
+				Context.Interpreter = Interpreter;
+				const FValue QueueValue = FValue::FromArray(Queue);
+				for (int32 i = 0; i < 1024; ++i)
+				{
+					PushBack->NativeImpl({ QueueValue, FValue::FromNumber(i) }, Context);
+				}
+				for (int32 i = 0; i < 1024; ++i)
+				{
+					PopFront->NativeImpl({ QueueValue }, Context);
+				}
+				return 0;
+			};
+			Suite.AddCase(MoveTemp(Case));
+		}
+
+		return Suite;
+	}
+
+	void FBenchmarkSuite::AddCase(FBenchmarkCase&& Case)
+	{
+		Cases.Add(MoveTemp(Case));
+	}
+
+	void FBenchmarkSuite::AddScriptCases(const FString& Name, const FString& Source, int32 Iterations, const FString& EntryName)
+	{
+		// parse / interpret 케이스 입력은 한 번만 만들어 두고 공유
+		const TArray<FToken> Tokens = FLexer(Source).Tokenize();
+		FParser Parser(Tokens);
+		const TSharedPtr<FProgram> Program = Parser.ParseProgram();
+
+		{
+			FBenchmarkCase Case;
+			Case.Name = FString::Printf(TEXT("lexer/%s"), *Name);
+			Case.Category = TEXT("lexer");
+			Case.Iterations = Iterations;
+			Case.Run = [Source]() -> int64
+			{
+				FLexer Lexer(Source);
+				const TArray<FToken> Result = Lexer.Tokenize();
+				return 0;
+			};
+			Cases.Add(MoveTemp(Case));
+		}
+
+		{
+			FBenchmarkCase Case;
+			Case.Name = FString::Printf(TEXT("parser/%s"), *Name);
+			Case.Category = TEXT("parser");
+			Case.Iterations = Iterations;
+			Case.Run = [Tokens]() -> int64
+			{
+				FParser LocalParser(Tokens);
+				const TSharedPtr<FProgram> Result = LocalParser.ParseProgram();
+				return 0;
+			};
+			Cases.Add(MoveTemp(Case));
+		}
+
+		if (Parser.HasError() || !Program.IsValid())
+		{
+			UE_LOG(LogMagicScript, Warning, TEXT("MagicScript Benchmark: %s failed to parse, interpreter case skipped"), *Name);
+			return;
+		}
+
+		{
+			// 인터프리터 생성과 빌트인 등록은 Prepare에서 (측정 제외)
+			TSharedPtr<TSharedPtr<FInterpreter>> Slot = MakeShared<TSharedPtr<FInterpreter>>();
+
+			FBenchmarkCase Case;
+			Case.Name = FString::Printf(TEXT("interpreter/%s"), *Name);
+			Case.Category = TEXT("interpreter");
+			Case.Iterations = Iterations;
+			Case.Prepare = [Slot, Name]() { *Slot = CreateInterpreter(Name); };
+			Case.Run = [Slot, Program, EntryName]() -> int64
+			{
+				const TSharedPtr<FInterpreter> Interpreter = *Slot;
+				FScriptExecutionContext Context;
+				Context.Interpreter = Interpreter;
+				Interpreter->ExecuteProgram(Program, Context);
+				if (!EntryName.IsEmpty())
+				{
+					Interpreter->CallFunctionByName(EntryName, {}, Context);
+				}
+				return Interpreter->GetPeakSpaceBytes();
+			};
+			Cases.Add(MoveTemp(Case));
+		}
+	}
+
+	TArray<FBenchmarkResult> FBenchmarkSuite::Run(const FString& Filter, int32 WarmupIterations) const
+	{
+		TArray<FBenchmarkResult> Results;
+		for (const FBenchmarkCase& Case : Cases)
+		{
+			if (!Filter.IsEmpty() && !Case.Name.Contains(Filter))
+			{
+				continue;
+			}
+			Results.Add(RunCase(Case, WarmupIterations));
+		}
+		return Results;
+	}
+
+	FBenchmarkResult FBenchmarkSuite::RunCase(const FBenchmarkCase& Case, int32 WarmupIterations)
+	{
+		FBenchmarkResult Result;
+		Result.Name = Case.Name;
+		Result.Category = Case.Category;
+		Result.Iterations = FMath::Max(1, Case.Iterations);
+
+		// 워밍업 (캐시/할당기 안정화, 측정 제외)
+		for (int32 i = 0; i < WarmupIterations; ++i)
+		{
+			if (Case.Prepare)
+			{
+				Case.Prepare();
+			}
+			Case.Run();
+		}
+
+		uint64 TotalCycles = 0;
+		uint64 MinCycles = MAX_uint64;
+		int64 TotalAllocs = 0;
+		int64 TotalAllocBytes = 0;
+		GMallocCounter.EnsureInstalled();
+
+		for (int32 i = 0; i < Result.Iterations; ++i)
+		{
+			if (Case.Prepare)
+			{
+				Case.Prepare();
+			}
+
+			GMallocCounter.BeginCount();
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			const int64 PeakScriptBytes = Case.Run();
+			const uint64 Elapsed = FPlatformTime::Cycles64() - StartCycles;
+			GMallocCounter.EndCount();
+
+			TotalCycles += Elapsed;
+			MinCycles = FMath::Min(MinCycles, Elapsed);
+			TotalAllocs += GMallocCounter.GetAllocCount();
+			TotalAllocBytes += GMallocCounter.GetAllocBytes();
+			Result.PeakScriptBytes = FMath::Max(Result.PeakScriptBytes, PeakScriptBytes);
+		}
+
+		Result.NsPerOp = CyclesToNanoseconds(TotalCycles) / Result.Iterations;
+		Result.MinNsPerOp = CyclesToNanoseconds(MinCycles);
+		Result.AllocsPerOp = static_cast<double>(TotalAllocs) / Result.Iterations;
+		Result.AllocBytesPerOp = static_cast<double>(TotalAllocBytes) / Result.Iterations;
+		return Result;
+	}
+
+	FString FBenchmarkSuite::ToJson(const TArray<FBenchmarkResult>& Results)
+	{
+		// 빌드 간 추세 비교용: 실행 환경 정보 + 케이스별 결과
+		// (프로세스 최대 물리 메모리는 케이스와 무관한 수명 전체 값이므로 실행 단위로 한 번만 기록)
+		FString Json = FString::Printf(
+			TEXT("{\n\t\"timestamp\":\"%s\",\n\t\"platform\":\"%s\",\n\t\"build\":\"%s\",\n\t\"engine\":\"%s\",\n\t\"peak_process_bytes\":%llu,\n\t\"results\":[\n"),
+			*FDateTime::UtcNow().ToIso8601(),
+			ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()),
+			LexToString(FApp::GetBuildConfiguration()),
+			*FEngineVersion::Current().ToString(),
+			static_cast<uint64>(FPlatformMemory::GetStats().PeakUsedPhysical));
+
+		for (int32 i = 0; i < Results.Num(); ++i)
+		{
+			const FBenchmarkResult& Result = Results[i];
+			Json += FString::Printf(
+				TEXT("%s\t\t{\"name\":\"%s\",\"category\":\"%s\",\"iterations\":%d,\"ns_per_op\":%.1f,\"min_ns_per_op\":%.1f,\"allocs_per_op\":%.2f,\"alloc_bytes_per_op\":%.1f,\"peak_script_bytes\":%lld}"),
+				i > 0 ? TEXT(",\n") : TEXT(""),
+				*Result.Name.ReplaceCharWithEscapedChar(), *Result.Category.ReplaceCharWithEscapedChar(), Result.Iterations,
+				Result.NsPerOp, Result.MinNsPerOp, Result.AllocsPerOp, Result.AllocBytesPerOp,
+				Result.PeakScriptBytes);
+		}
+		Json += TEXT("\n\t]\n}\n");
+		return Json;
+	}
+
+	FString FBenchmarkSuite::ToText(const TArray<FBenchmarkResult>& Results)
+	{
+		FString Text = FString::Printf(TEXT("%-40s %14s %14s %12s %14s %12s\n"),
+			TEXT("case"), TEXT("ns/op"), TEXT("min ns/op"), TEXT("allocs/op"), TEXT("bytes/op"), TEXT("peak script"));
+		for (const FBenchmarkResult& Result : Results)
+		{
+			Text += FString::Printf(TEXT("%-40s %14.1f %14.1f %12.2f %14.1f %12lld\n"),
+				*Result.Name, Result.NsPerOp, Result.MinNsPerOp, Result.AllocsPerOp, Result.AllocBytesPerOp, Result.PeakScriptBytes);
+		}
+		return Text;
+	}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace MagicScript
+{
+	// 벤치마크 케이스 측정 결과 (op = 케이스 1회 실행)
+	struct MAGICSCRIPTCORE_API FBenchmarkResult
+	{
+		FString Name;
+		FString Category;            // lexer / parser / interpreter / builtins
+		int32 Iterations = 0;
+		double NsPerOp = 0.0;        // 평균
+		double MinNsPerOp = 0.0;     // 최솟값 (노이즈가 가장 적은 측정)
+		double AllocsPerOp = 0.0;    // 측정 스레드의 GMalloc 할당 횟수 / op
+		double AllocBytesPerOp = 0.0;
+		int64 PeakScriptBytes = 0;   // 인터프리터 스크립트 힙 최대 메모리 (인터프리터 케이스만)
+	};
+
+	// 벤치마크 케이스
+	struct MAGICSCRIPTCORE_API FBenchmarkCase
+	{
+		FString Name;
+		FString Category;
+		int32 Iterations = 100;
+
+		// 매 반복 전에 호출 (측정 제외): 입력 준비
+		TFunction<void()> Prepare;
+
+		// 측정 대상, 인터프리터 스크립트 힙 최대 메모리를 반환 (해당 없으면 0)
+		TFunction<int64()> Run;
+	};
+
+	/**
+	 * 마이크로 벤치마크 스위트
+	 * - 기본 코퍼스: 수치 루프, 재귀, 배열 큐, 객체 위주 코드, 빌트인, 대형 생성 소스
+	 * - 스크립트마다 lex / parse / interpret 케이스를 만들고, 배열 빌트인은 네이티브 구현을 직접 호출
+	 * - 월드/Subsystem 없이 동작 (빌트인은 호스트 없이 등록되므로 로그를 남기지 않음)
+	 */
+	class MAGICSCRIPTCORE_API FBenchmarkSuite
+	{
+	public:
+		// 기본 코퍼스로 구성된 스위트 (IterationScale로 반복 횟수 배율 조절)
+		static FBenchmarkSuite CreateDefault(int32 IterationScale = 1);
+
+		// 기본 코퍼스 (이름, 소스) - 모든 스크립트는 main()을 진입점으로 사용
+		static TArray<TPair<FString, FString>> GetDefaultCorpus();
+
+		void AddCase(FBenchmarkCase&& Case);
+
+		// 스크립트 하나에 대한 lex / parse / interpret 케이스 추가 (EntryName이 비어 있으면 전역 코드만 실행)
+		void AddScriptCases(const FString& Name, const FString& Source, int32 Iterations, const FString& EntryName = TEXT("main"));
+
+		const TArray<FBenchmarkCase>& GetCases() const { return Cases; }
+
+		// Filter가 비어 있지 않으면 이름에 Filter를 포함하는 케이스만 실행
+		TArray<FBenchmarkResult> Run(const FString& Filter = FString(), int32 WarmupIterations = 3) const;
+
+		static FBenchmarkResult RunCase(const FBenchmarkCase& Case, int32 WarmupIterations = 3);
+
+		// 결과 출력
+		static FString ToJson(const TArray<FBenchmarkResult>& Results);
+		static FString ToText(const TArray<FBenchmarkResult>& Results);
+
+	private:
+		TArray<FBenchmarkCase> Cases;
+	};
+}
@@ -1,19 +1,16 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "MagicScript/Core/MsToken.h"
+#include "MagicScriptCore/Core/MsToken.h"
+#include "MagicScriptCore/Core/MsAstArena.h"
 
 namespace MagicScript
 {
-	struct FStatement;
-	struct FExpression;
-
-	using FStatementPtr = TSharedPtr<FStatement>;
-	using FExpressionPtr = TSharedPtr<FExpression>;
-
-	struct MAGICSCRIPT_API FProgram
+	// 파싱 결과 (모든 노드는 Arena에 있고 프로그램과 함께 한 번에 해제)
+	struct MAGICSCRIPTCORE_API FProgram : public TSharedFromThis<FProgram>
 	{
 		TArray<FStatementPtr> Statements;
+		FAstArena Arena;
 	};
 
 	enum class EStatementKind : uint8
@@ -48,10 +45,10 @@ namespace MagicScript
 		PostfixDecrement   // x--
 	};
 
-	struct MAGICSCRIPT_API FStatement
+	struct MAGICSCRIPTCORE_API FStatement : FAstNode
 	{
-		virtual ~FStatement() = default;
 		EStatementKind Kind;
+		FSourceLocation Location;  // 문장 시작 토큰 위치
 
 	protected:
 		explicit FStatement(EStatementKind InKind)
@@ -60,10 +57,10 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FExpression
+	struct MAGICSCRIPTCORE_API FExpression : FAstNode
 	{
-		virtual ~FExpression() = default;
 		EExpressionKind Kind;
+		FSourceLocation Location;  // 연산자/식별자 등 대표 토큰 위치
 
 	protected:
 		explicit FExpression(EExpressionKind InKind)
@@ -73,7 +70,7 @@ namespace MagicScript
 	};
 
 	// === 문장 노드 ===
-	struct MAGICSCRIPT_API FBlockStatement : FStatement
+	struct MAGICSCRIPTCORE_API FBlockStatement : FStatement
 	{
 		TArray<FStatementPtr> Statements;
 
@@ -83,7 +80,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FVarDeclStatement : FStatement
+	struct MAGICSCRIPTCORE_API FVarDeclStatement : FStatement
 	{
 		bool bIsConst = false;
 		FString Name;
@@ -95,11 +92,12 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FFuncDeclStatement : FStatement
+	struct MAGICSCRIPTCORE_API FFuncDeclStatement : FStatement
 	{
 		FString Name;
 		TArray<FString> Parameters;
-		TSharedPtr<FBlockStatement> Body;
+		TAstPtr<FBlockStatement> Body;
+		FProgram* Owner = nullptr;  // spell 값이 본문 AST를 붙잡기 위한 소속 프로그램
 
 		FFuncDeclStatement()
 			: FStatement(EStatementKind::FuncDecl)
@@ -107,7 +105,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FImportStatement : FStatement
+	struct MAGICSCRIPTCORE_API FImportStatement : FStatement
 	{
 		FString Path; // ex: Scripts/Util.ms
 
@@ -117,7 +115,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FIfStatement : FStatement
+	struct MAGICSCRIPTCORE_API FIfStatement : FStatement
 	{
 		FExpressionPtr Condition;
 		FStatementPtr ThenBranch;
@@ -129,13 +127,13 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FSwitchCase
+	struct MAGICSCRIPTCORE_API FSwitchCase
 	{
 		FExpressionPtr Value;  // case 값 (null이면 default)
 		TArray<FStatementPtr> Statements;
 	};
 
-	struct MAGICSCRIPT_API FSwitchStatement : FStatement
+	struct MAGICSCRIPTCORE_API FSwitchStatement : FStatement
 	{
 		FExpressionPtr Expression;  // switch (expression)
 		TArray<FSwitchCase> Cases;   // case/default 목록
@@ -146,7 +144,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FWhileStatement : FStatement
+	struct MAGICSCRIPTCORE_API FWhileStatement : FStatement
 	{
 		FExpressionPtr Condition;
 		FStatementPtr Body;
@@ -157,7 +155,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FForStatement : FStatement
+	struct MAGICSCRIPTCORE_API FForStatement : FStatement
 	{
 		FStatementPtr Init;        // VarDecl 또는 ExprStmt, null 허용
 		FExpressionPtr Condition;  // null -> true
@@ -170,7 +168,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FReturnStatement : FStatement
+	struct MAGICSCRIPTCORE_API FReturnStatement : FStatement
 	{
 		FExpressionPtr Value; // null 허용
 
@@ -180,7 +178,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FExpressionStatement : FStatement
+	struct MAGICSCRIPTCORE_API FExpressionStatement : FStatement
 	{
 		FExpressionPtr Expr;
 
@@ -218,7 +216,7 @@ namespace MagicScript
 		ModAssign   // %=
 	};
 
-	struct MAGICSCRIPT_API FBinaryExpression : FExpression
+	struct MAGICSCRIPTCORE_API FBinaryExpression : FExpression
 	{
 		EBinaryOp Op;
 		FExpressionPtr Left;
@@ -230,7 +228,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FUnaryExpression : FExpression
+	struct MAGICSCRIPTCORE_API FUnaryExpression : FExpression
 	{
 		EUnaryOp Op;
 		FExpressionPtr Operand;
@@ -241,7 +239,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FLiteralExpression : FExpression
+	struct MAGICSCRIPTCORE_API FLiteralExpression : FExpression
 	{
 		// 실제 값은 인터프리터 단계에서 MsValue로 변환
 		FToken LiteralToken;
@@ -252,7 +250,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FIdentifierExpression : FExpression
+	struct MAGICSCRIPTCORE_API FIdentifierExpression : FExpression
 	{
 		FString Name;
 
@@ -262,7 +260,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FAssignmentExpression : FExpression
+	struct MAGICSCRIPTCORE_API FAssignmentExpression : FExpression
 	{
 		EAssignmentOp Op = EAssignmentOp::Assign;
 		FString TargetName;
@@ -276,7 +274,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FCallExpression : FExpression
+	struct MAGICSCRIPTCORE_API FCallExpression : FExpression
 	{
 		FString CalleeName;
 		TArray<FExpressionPtr> Arguments;
@@ -288,7 +286,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FGroupingExpression : FExpression
+	struct MAGICSCRIPTCORE_API FGroupingExpression : FExpression
 	{
 		FExpressionPtr Inner;
 
@@ -298,7 +296,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FArrayLiteralExpression : FExpression
+	struct MAGICSCRIPTCORE_API FArrayLiteralExpression : FExpression
 	{
 		TArray<FExpressionPtr> Elements;
 
@@ -308,13 +306,13 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FObjectProperty
+	struct MAGICSCRIPTCORE_API FObjectProperty
 	{
 		FString Key;              // 속성 이름 (식별자 또는 문자열)
 		FExpressionPtr Value;     // 속성 값 표현식
 	};
 
-	struct MAGICSCRIPT_API FObjectLiteralExpression : FExpression
+	struct MAGICSCRIPTCORE_API FObjectLiteralExpression : FExpression
 	{
 		TArray<FObjectProperty> Properties;  // 객체 속성 목록
 
@@ -324,7 +322,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FIndexExpression : FExpression
+	struct MAGICSCRIPTCORE_API FIndexExpression : FExpression
 	{
 		FExpressionPtr Target;  // 배열 변수 (Identifier 또는 다른 표현식)
 		FExpressionPtr Index;   // 인덱스 표현식
@@ -335,7 +333,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FMemberAccessExpression : FExpression
+	struct MAGICSCRIPTCORE_API FMemberAccessExpression : FExpression
 	{
 		FExpressionPtr Target;  // 객체 (배열 등)
 		FString MemberName;      // 멤버 이름 (push_back, pop_front 등)
@@ -346,11 +344,12 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FArrowFunctionExpression : FExpression
+	struct MAGICSCRIPTCORE_API FArrowFunctionExpression : FExpression
 	{
 		TArray<FString> Parameters;  // 파라미터 목록
 		FExpressionPtr Body;         // 단일 표현식 (x => x + 1)
-		TSharedPtr<FBlockStatement> BodyBlock;  // 블록 문장 (x => { ... })
+		TAstPtr<FBlockStatement> BodyBlock;  // 블록 문장 (x => { ... }), 단일 표현식이면 파서가 { return Body; }로 감싸 둠
+		FProgram* Owner = nullptr;   // spell 값이 본문 AST를 붙잡기 위한 소속 프로그램
 
 		FArrowFunctionExpression()
 			: FExpression(EExpressionKind::ArrowFunction)
@@ -358,7 +357,7 @@ namespace MagicScript
 		}
 	};
 
-	struct MAGICSCRIPT_API FPostfixExpression : FExpression
+	struct MAGICSCRIPTCORE_API FPostfixExpression : FExpression
 	{
 		FExpressionPtr Operand;  // x++ 또는 x--에서 x
 		bool bIsIncrement;      // true면 ++, false면 --
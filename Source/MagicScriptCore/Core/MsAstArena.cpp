@@ -0,0 +1,37 @@
+#include "MagicScriptCore/Core/MsAstArena.h"
+
+namespace MagicScript
+{
+	FAstArena::~FAstArena()
+	{
+		for (int32 Index = Nodes.Num() - 1; Index >= 0; --Index)
+		{
+			Nodes[Index]->~FAstNode();
+		}
+		Nodes.Empty();
+
+		for (uint8* Block : Blocks)
+		{
+			FMemory::Free(Block);
+		}
+		Blocks.Empty();
+	}
+
+	void* FAstArena::Allocate(const SIZE_T Size, const SIZE_T Alignment)
+	{
+		uint8* Aligned = Cursor ? Align(Cursor, Alignment) : nullptr;
+		if (!Aligned || Aligned + Size > BlockEnd)
+		{
+			// 현재 블록에 자리가 없으면 새 블록 (남은 공간은 버림)
+			const SIZE_T NewBlockSize = FMath::Max<SIZE_T>(BlockSize, Size + Alignment);
+			uint8* Block = static_cast<uint8*>(FMemory::Malloc(NewBlockSize, FMath::Max<SIZE_T>(Alignment, 16)));
+			Blocks.Add(Block);
+			AllocatedBytes += NewBlockSize;
+			BlockEnd = Block + NewBlockSize;
+			Aligned = Align(Block, Alignment);
+		}
+
+		Cursor = Aligned + Size;
+		return Aligned;
+	}
+}
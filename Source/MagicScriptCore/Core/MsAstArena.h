@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <type_traits>
+
+namespace MagicScript
+{
+	struct FStatement;
+	struct FExpression;
+
+	// 모든 AST 노드의 공통 베이스 (아레나를 해제할 때 노드 소멸자를 호출하기 위함)
+	struct MAGICSCRIPTCORE_API FAstNode
+	{
+		virtual ~FAstNode() = default;
+	};
+
+	/**
+	 * 아레나에 있는 AST 노드를 가리키는 비소유 포인터
+	 * - 참조 카운트 없이 포인터 하나 크기 (노드 수명은 FProgram의 아레나가 관리)
+	 * - 기존 TSharedPtr와 같은 IsValid/Get/-> 사용법 유지
+	 */
+	template<typename NodeType>
+	class TAstPtr
+	{
+	public:
+		TAstPtr() = default;
+		TAstPtr(TYPE_OF_NULLPTR) {}
+		TAstPtr(NodeType* InNode) : Node(InNode) {}
+
+		template<typename OtherType, typename = std::enable_if_t<std::is_convertible_v<OtherType*, NodeType*>>>
+		TAstPtr(const TAstPtr<OtherType>& Other) : Node(Other.Get()) {}
+
+		bool IsValid() const { return Node != nullptr; }
+		explicit operator bool() const { return Node != nullptr; }
+		NodeType* Get() const { return Node; }
+		NodeType* operator->() const { check(Node); return Node; }
+		NodeType& operator*() const { check(Node); return *Node; }
+		void Reset() { Node = nullptr; }
+
+		bool operator==(const TAstPtr& Other) const { return Node == Other.Node; }
+		bool operator!=(const TAstPtr& Other) const { return Node != Other.Node; }
+
+	private:
+		NodeType* Node = nullptr;
+	};
+
+	template<typename ToType, typename FromType>
+	TAstPtr<ToType> StaticCastAstPtr(const TAstPtr<FromType>& Ptr)
+	{
+		return TAstPtr<ToType>(static_cast<ToType*>(Ptr.Get()));
+	}
+
+	using FStatementPtr = TAstPtr<FStatement>;
+	using FExpressionPtr = TAstPtr<FExpression>;
+
+	/**
+	 * 프로그램 하나의 AST 노드를 담는 아레나
+	 * - 노드를 64KB 블록에 연속으로 배치 (노드마다 힙 할당/참조 카운트 없음, 순회 시 캐시 지역성)
+	 * - 개별 해제는 없고 아레나(FProgram)가 사라질 때 생성 역순으로 소멸자 호출 후 블록을 한 번에 해제
+	 */
+	class MAGICSCRIPTCORE_API FAstArena
+	{
+	public:
+		static constexpr SIZE_T BlockSize = 64 * 1024;
+
+		FAstArena() = default;
+		~FAstArena();
+
+		FAstArena(const FAstArena&) = delete;
+		FAstArena& operator=(const FAstArena&) = delete;
+
+		template<typename NodeType>
+		NodeType* New()
+		{
+			static_assert(std::is_base_of_v<FAstNode, NodeType>, "FAstArena only holds AST nodes");
+			NodeType* Node = new (Allocate(sizeof(NodeType), alignof(NodeType))) NodeType();
+			Nodes.Add(Node);
+			return Node;
+		}
+
+		int32 NumNodes() const { return Nodes.Num(); }
+		SIZE_T GetAllocatedBytes() const { return AllocatedBytes; }
+
+	private:
+		void* Allocate(SIZE_T Size, SIZE_T Alignment);
+
+		TArray<uint8*> Blocks;
+		uint8* Cursor = nullptr;
+		uint8* BlockEnd = nullptr;
+		SIZE_T AllocatedBytes = 0;
+
+		// 생성 순서대로 기록 (해제 시 역순으로 소멸자 호출)
+		TArray<FAstNode*> Nodes;
+	};
+}
@@ -0,0 +1,129 @@
+#include "MagicScriptCore/Core/MsEnvironment.h"
+
+namespace MagicScript
+{
+	FEnvironment::FEnvironment(const TSharedPtr<FEnvironment>& InParent)
+		: FEnvironment(InParent, FScriptHeap::GetCurrent())
+	{
+	}
+
+	FEnvironment::FEnvironment(const TSharedPtr<FEnvironment>& InParent, FScriptHeap* InHeap)
+		: Parent(InParent)
+	{
+		HeapNode.Object = this;
+		HeapNode.Category = EScriptHeapCategory::Environment;
+		if (InHeap)
+		{
+			Heap = InHeap->AsShared();
+			Heap->LinkNode(HeapNode, sizeof(FEnvironment));
+		}
+	}
+
+	FEnvironment::~FEnvironment()
+	{
+		if (Heap.IsValid())
+		{
+			Heap->UnlinkNode(HeapNode);
+		}
+	}
+
+	void FEnvironment::UpdateTracking()
+	{
+		if (!Heap.IsValid())
+		{
+			return;
+		}
+
+		Heap->ResizeNode(HeapNode, sizeof(FEnvironment) + Table.GetAllocatedSize(), PayloadBytes);
+	}
+
+	bool FEnvironment::Define(const FString& Name, const FValue& Value, bool bIsConst)
+	{
+		if (Table.Contains(Name))
+		{
+			// 이미 존재: 재정의 불가 (간단 처리)
+			return false;
+		}
+
+		FEntry Entry;
+		Entry.Value = Value;
+		Entry.bIsConst = bIsConst;
+		const FEntry& Added = Table.Add(Name, Entry);
+		if (Heap.IsValid())
+		{
+			PayloadBytes += Name.GetAllocatedSize() + GetValuePayloadBytes(Added.Value);
+			UpdateTracking();
+		}
+		return true;
+	}
+
+	bool FEnvironment::Assign(const FString& Name, const FValue& Value)
+	{
+		// 문자열 본문 변화량을 항목이 속한 환경에 반영해야 하므로 체인을 직접 따라감
+		for (FEnvironment* Scope = this; Scope; Scope = Scope->Parent.Get())
+		{
+			FEntry* Entry = Scope->Table.Find(Name);
+			if (!Entry)
+			{
+				continue;
+			}
+			if (Entry->bIsConst)
+			{
+				return false;
+			}
+
+			const int64 OldPayload = GetValuePayloadBytes(Entry->Value);
+			Entry->Value = Value;
+			if (Scope->Heap.IsValid())
+			{
+				Scope->PayloadBytes += GetValuePayloadBytes(Entry->Value) - OldPayload;
+				Scope->UpdateTracking();
+			}
+			return true;
+		}
+
+		return false;
+	}
+
+	FEnvironment::FEntry* FEnvironment::Lookup(const FString& Name)
+	{
+		if (FEntry* Found = Table.Find(Name))
+		{
+			return Found;
+		}
+
+		if (Parent.IsValid())
+		{
+			return Parent->Lookup(Name);
+		}
+
+		return nullptr;
+	}
+
+	TSharedPtr<FEnvironment> FEnvironment::Clone() const
+	{
+		// Parent도 복사 (재귀적으로 전체 체인 복사)
+		TSharedPtr<FEnvironment> ClonedParent = nullptr;
+		if (Parent.IsValid())
+		{
+			ClonedParent = Parent->Clone();
+		}
+
+		// 새 Environment 생성
+		TSharedPtr<FEnvironment> Cloned = MakeShared<FEnvironment>(ClonedParent);
+		
+		// Table 복사 (TMap은 값 복사이므로 자동으로 깊은 복사됨)
+		Cloned->Table = Table;
+		if (Cloned->Heap.IsValid())
+		{
+			for (const TPair<FString, FEntry>& Pair : Table)
+			{
+				Cloned->PayloadBytes += Pair.Key.GetAllocatedSize() + GetValuePayloadBytes(Pair.Value.Value);
+			}
+			Cloned->UpdateTracking();
+		}
+		
+		return Cloned;
+	}
+}
+
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MagicScriptCore/Core/MsValue.h"
+#include "MagicScriptCore/Runtime/MsScriptHeap.h"
+
+namespace MagicScript
+{
+	class FScriptCycleCollector;
+
+	// 스코프 단위 즉 렉시컬 환경을 의미함.
+	class MAGICSCRIPTCORE_API FEnvironment : public TSharedFromThis<FEnvironment>
+	{
+	public:
+		// 현재 실행 중인 스크립트 힙(FScriptHeap::GetCurrent)에 변수 테이블 크기를 기록
+		explicit FEnvironment(const TSharedPtr<FEnvironment>& InParent = nullptr);
+		FEnvironment(const TSharedPtr<FEnvironment>& InParent, FScriptHeap* InHeap);
+		~FEnvironment();
+
+		struct FEntry
+		{
+			FValue Value;
+			bool   bIsConst = false;
+		};
+
+		bool Define(const FString& Name, const FValue& Value, bool bIsConst);
+		bool Assign(const FString& Name, const FValue& Value);
+		FEntry* Lookup(const FString& Name);
+
+		// Environment의 깊은 복사본 생성 - 스냅샷 전용 로직
+		TSharedPtr<FEnvironment> Clone() const;
+
+	private:
+		// 순환 수집기가 참조를 따라가고 끊을 수 있도록 허용
+		friend class FScriptCycleCollector;
+
+		TSharedPtr<FEnvironment> Parent;
+		TMap<FString, FEntry>    Table;
+
+		// 메모리 추적 (테이블 버퍼 + 키/문자열 값 본문), 순환 수집기는 HeapNode로 환경을 순회
+		TSharedPtr<FScriptHeap, ESPMode::ThreadSafe> Heap;
+		FScriptHeapNode HeapNode;
+		int64 PayloadBytes = 0;
+
+		void UpdateTracking();
+	};
+}
+
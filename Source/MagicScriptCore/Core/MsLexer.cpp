@@ -1,4 +1,4 @@
-#include "MagicScript/Core/MsLexer.h"
+#include "MagicScriptCore/Core/MsLexer.h"
 
 namespace MagicScript
 {
@@ -272,68 +272,72 @@ namespace MagicScript
 		return MakeErrorToken(Msg, StartLoc);
 	}
 
-	TArray<FToken> FLexer::Tokenize()
+	FToken FLexer::NextToken()
 	{
-		TArray<FToken> Result;
-		Result.Reserve(128);
+		SkipWhitespace();
+		if (IsAtEnd())
+		{
+			// 끝에 도달하면 이후 호출에도 계속 EndOfFile
+			return FToken(ETokenType::EndOfFile, TEXT(""), Location);
+		}
 
-		while (!IsAtEnd())
+		const FSourceLocation StartLoc = Location;
+		TCHAR C = Peek();
+
+		// 주석 체크 (공백 스킵 후)
+		if (C == TEXT('/') && Index + 1 < Source.Len())
 		{
-			SkipWhitespace();
-			if (IsAtEnd())
+			TCHAR NextC = Source[Index + 1];
+			if (NextC == TEXT('/') || NextC == TEXT('*'))
 			{
-				break;
+				Advance(); // /
+				return LexComment();
 			}
+		}
 
-			const FSourceLocation StartLoc = Location;
-			TCHAR C = Peek();
+		// 주석이 아니면 일반 토큰 처리
+		C = Advance();
 
-			// 주석 체크 (공백 스킵 후)
-			if (C == TEXT('/') && Index + 1 < Source.Len())
-			{
-				TCHAR NextC = Source[Index + 1];
-				if (NextC == TEXT('/') || NextC == TEXT('*'))
-				{
-					Advance(); // /
-					Result.Add(LexComment());
-					continue;
-				}
-			}
+		if (FChar::IsAlpha(C) || C == TEXT('_'))
+		{
+			// LexIdentifierOrKeyword는 첫 글자를 이미 읽었다고 가정하므로
+			Index--; // 한 글자 되돌리기
+			Location = StartLoc;
+			Advance(); // 다시 첫 글자 소비
+			return LexIdentifierOrKeyword();
+		}
+
+		if (FChar::IsDigit(C))
+		{
+			Index--;
+			Location = StartLoc;
+			Advance();
+			return LexNumber();
+		}
 
-			// 주석이 아니면 일반 토큰 처리
-			C = Advance();
+		if (C == TEXT('"'))
+		{
+			return LexString();
+		}
 
-			if (FChar::IsAlpha(C) || C == TEXT('_'))
-			{
-				// LexIdentifierOrKeyword는 첫 글자를 이미 읽었다고 가정하므로
-				Index--; // 한 글자 되돌리기
-				Location = StartLoc;
-				Advance(); // 다시 첫 글자 소비
-				Result.Add(LexIdentifierOrKeyword());
-				continue;
-			}
+		Index--;
+		Location = StartLoc;
+		return LexOperatorOrSeparator();
+	}
 
-			if (FChar::IsDigit(C))
-			{
-				Index--;
-				Location = StartLoc;
-				Advance();
-				Result.Add(LexNumber());
-				continue;
-			}
+	TArray<FToken> FLexer::Tokenize()
+	{
+		TArray<FToken> Result;
+		Result.Reserve(128);
 
-			if (C == TEXT('"'))
+		while (true)
+		{
+			Result.Add(NextToken());
+			if (Result.Last().Type == ETokenType::EndOfFile)
 			{
-				Result.Add(LexString());
-				continue;
+				break;
 			}
-
-			Index--;
-			Location = StartLoc;
-			Result.Add(LexOperatorOrSeparator());
 		}
-
-		Result.Add(FToken(ETokenType::EndOfFile, TEXT(""), Location));
 		return Result;
 	}
 }
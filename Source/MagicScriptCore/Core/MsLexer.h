@@ -1,7 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "MagicScript/Core/MsToken.h"
+#include "MagicScriptCore/Core/MsToken.h"
 
 namespace MagicScript
 {
@@ -10,11 +10,15 @@ namespace MagicScript
 	 * - 공백/주석 제거
 	 * - 토큰 시퀀스 생성
 	 */
-	class MAGICSCRIPT_API FLexer
+	class MAGICSCRIPTCORE_API FLexer
 	{
 	public:
 		explicit FLexer(const FString& InSource);
 
+		// 다음 토큰 하나 (주석 포함, 끝에 도달한 뒤에는 계속 EndOfFile)
+		FToken NextToken();
+
+		// 전체 토큰 배열 (NextToken을 EndOfFile까지 반복)
 		TArray<FToken> Tokenize();
 
 	private:
@@ -1,56 +1,191 @@
-#include "MagicScript/Core/MsParser.h"
-#include "MagicScript/Logging/MsLogging.h"
-#include "MagicScript/Logging/MsLoggingEnum.h"
+#include "MagicScriptCore/Core/MsParser.h"
+#include "MagicScriptCore/Core/MsLexer.h"
+#include "MagicScriptCore/Logging/MsLogging.h"
+#include "MagicScriptCore/Logging/MsLoggingEnum.h"
+#include "MagicScriptCore/Runtime/MsScriptHost.h"
 
 namespace MagicScript
 {
-	FParser::FParser(const TArray<FToken>& InTokens)
-		: Tokens(InTokens)
+	namespace
 	{
-	}
-
-	const FToken& FParser::Peek() const
-	{
-		// 주석 토큰 스킵
-		int32 Index = Current;
-		while (Index < Tokens.Num() && Tokens[Index].Type == ETokenType::Comment)
+		// 중위 연산자 우선순위 (클수록 먼저 묶임, 전위 연산자는 모든 중위 연산자보다 먼저 묶임)
+		namespace Precedence
 		{
-			Index++;
+			constexpr uint8 Assignment = 1;
+			constexpr uint8 LogicalOr = 2;
+			constexpr uint8 LogicalAnd = 3;
+			constexpr uint8 Equality = 4;
+			constexpr uint8 Relational = 5;
+			constexpr uint8 Additive = 6;
+			constexpr uint8 Multiplicative = 7;
 		}
-		// 범위 체크
-		if (Index >= Tokens.Num())
+
+		enum class EInfixKind : uint8
+		{
+			None,
+			Binary,
+			Assignment
+		};
+
+		struct FInfixRule
+		{
+			EInfixKind Kind = EInfixKind::None;
+			uint8 Precedence = 0;
+			bool bRightAssociative = false;
+			EBinaryOp BinaryOp = EBinaryOp::Add;
+			EAssignmentOp AssignmentOp = EAssignmentOp::Assign;
+		};
+
+		struct FPrefixRule
+		{
+			bool bValid = false;
+			EUnaryOp Op = EUnaryOp::Negate;
+		};
+
+		/**
+		 * 토큰 종류로 바로 찾는 연산자 표
+		 * - 새 연산자는 렉서 토큰을 추가한 뒤 MakeOperatorTable에 한 줄 추가하면 됨 (파싱 함수는 그대로)
+		 */
+		struct FOperatorTable
+		{
+			FInfixRule Infix[64];
+			FPrefixRule Prefix[64];
+
+			constexpr void AddBinary(const ETokenType Token, const uint8 InPrecedence, const EBinaryOp Op)
+			{
+				FInfixRule& Rule = Infix[static_cast<uint8>(Token)];
+				Rule.Kind = EInfixKind::Binary;
+				Rule.Precedence = InPrecedence;
+				Rule.BinaryOp = Op;
+			}
+
+			constexpr void AddAssignment(const ETokenType Token, const EAssignmentOp Op)
+			{
+				FInfixRule& Rule = Infix[static_cast<uint8>(Token)];
+				Rule.Kind = EInfixKind::Assignment;
+				Rule.Precedence = Precedence::Assignment;
+				Rule.bRightAssociative = true;
+				Rule.AssignmentOp = Op;
+			}
+
+			constexpr void AddPrefix(const ETokenType Token, const EUnaryOp Op)
+			{
+				FPrefixRule& Rule = Prefix[static_cast<uint8>(Token)];
+				Rule.bValid = true;
+				Rule.Op = Op;
+			}
+
+			const EUnaryOp* FindPrefix(const ETokenType Token) const
+			{
+				const FPrefixRule& Rule = Prefix[static_cast<uint8>(Token)];
+				return Rule.bValid ? &Rule.Op : nullptr;
+			}
+		};
+
+		constexpr FOperatorTable MakeOperatorTable()
 		{
-			return Tokens.Last(); // EndOfFile 토큰 반환
+			FOperatorTable Table;
+
+			Table.AddAssignment(ETokenType::Equal, EAssignmentOp::Assign);
+			Table.AddAssignment(ETokenType::PlusEqual, EAssignmentOp::AddAssign);
+			Table.AddAssignment(ETokenType::MinusEqual, EAssignmentOp::SubAssign);
+			Table.AddAssignment(ETokenType::StarEqual, EAssignmentOp::MulAssign);
+			Table.AddAssignment(ETokenType::SlashEqual, EAssignmentOp::DivAssign);
+			Table.AddAssignment(ETokenType::PercentEqual, EAssignmentOp::ModAssign);
+
+			Table.AddBinary(ETokenType::OrOr, Precedence::LogicalOr, EBinaryOp::Or);
+			Table.AddBinary(ETokenType::AndAnd, Precedence::LogicalAnd, EBinaryOp::And);
+			Table.AddBinary(ETokenType::EqualEqual, Precedence::Equality, EBinaryOp::Equal);
+			Table.AddBinary(ETokenType::BangEqual, Precedence::Equality, EBinaryOp::NotEqual);
+			Table.AddBinary(ETokenType::Less, Precedence::Relational, EBinaryOp::Less);
+			Table.AddBinary(ETokenType::LessEqual, Precedence::Relational, EBinaryOp::LessEqual);
+			Table.AddBinary(ETokenType::Greater, Precedence::Relational, EBinaryOp::Greater);
+			Table.AddBinary(ETokenType::GreaterEqual, Precedence::Relational, EBinaryOp::GreaterEqual);
+			Table.AddBinary(ETokenType::Plus, Precedence::Additive, EBinaryOp::Add);
+			Table.AddBinary(ETokenType::Minus, Precedence::Additive, EBinaryOp::Sub);
+			Table.AddBinary(ETokenType::Star, Precedence::Multiplicative, EBinaryOp::Mul);
+			Table.AddBinary(ETokenType::Slash, Precedence::Multiplicative, EBinaryOp::Div);
+			Table.AddBinary(ETokenType::Percent, Precedence::Multiplicative, EBinaryOp::Mod);
+
+			Table.AddPrefix(ETokenType::Bang, EUnaryOp::Not);
+			Table.AddPrefix(ETokenType::Minus, EUnaryOp::Negate);
+			Table.AddPrefix(ETokenType::PlusPlus, EUnaryOp::PreIncrement);
+			Table.AddPrefix(ETokenType::MinusMinus, EUnaryOp::PreDecrement);
+
+			return Table;
 		}
-		return Tokens[Index];
-	}
 
-	const FToken& FParser::Previous() const
-	{
-		return Tokens[Current - 1];
+		constexpr FOperatorTable OperatorTable = MakeOperatorTable();
 	}
 
-	bool FParser::IsAtEnd() const
+	FParser::FParser(const TArray<FToken>& InTokens, IScriptHost* InHost, const FString& InScriptName)
+		: SourceTokens(&InTokens)
+		, Host(InHost)
+		, ScriptName(InScriptName)
 	{
-		return Peek().Type == ETokenType::EndOfFile;
+		Lookahead.Reserve(LookaheadTrimThreshold + 2);
+		EndOfFileToken.Type = ETokenType::EndOfFile;
 	}
 
-	bool FParser::Check(ETokenType Type) const
+	FParser::FParser(FLexer& InLexer, IScriptHost* InHost, const FString& InScriptName)
+		: Lexer(&InLexer)
+		, Host(InHost)
+		, ScriptName(InScriptName)
 	{
-		return !IsAtEnd() && Peek().Type == Type;
+		Lookahead.Reserve(LookaheadTrimThreshold + 2);
+		EndOfFileToken.Type = ETokenType::EndOfFile;
 	}
 
-	bool FParser::Match(const TArray<ETokenType>& Types)
+	FToken FParser::PullToken()
 	{
-		for (ETokenType Type : Types)
+		while (true)
 		{
-			if (Check(Type))
+			FToken Token;
+			if (Lexer)
 			{
-				Advance();
-				return true;
+				Token = Lexer->NextToken();
+			}
+			else if (SourceIndex < SourceTokens->Num())
+			{
+				Token = (*SourceTokens)[SourceIndex++];
 			}
+			else
+			{
+				Token = EndOfFileToken;
+			}
+
+			// 주석은 파싱에 쓰이지 않으므로 버퍼에 넣지 않음
+			if (Token.Type == ETokenType::Comment)
+			{
+				continue;
+			}
+
+			if (Token.Type == ETokenType::Error)
+			{
+				ReportLexError(Token);
+				return FToken(ETokenType::EndOfFile, TEXT(""), Token.Location);
+			}
+			return Token;
+		}
+	}
+
+	void FParser::ReportLexError(const FToken& ErrorToken)
+	{
+		bHadError = true;
+		bHadLexError = true;
+
+		const FString Msg = FString::Printf(TEXT("MagicScript Lex Error %s(%d:%d): %s"),
+			*ScriptName, ErrorToken.Location.Line, ErrorToken.Location.Column, *ErrorToken.Lexeme);
+		ErrorMessages.Add(Msg);
+		if (Host)
+		{
+			Host->AddScriptLog(EScriptLogType::Error, Msg, ScriptName.IsEmpty() ? NAME_None : FName(*ScriptName),
+				ErrorToken.Location.Line, ErrorToken.Location.Column);
+		}
+		else
+		{
+			AddScriptLog(EScriptLogType::Error, Msg, ErrorToken.Location.Line, ErrorToken.Location.Column);
 		}
-		return false;
 	}
 
 	const FToken& FParser::Advance()
@@ -58,10 +193,13 @@ namespace MagicScript
 		if (!IsAtEnd())
 		{
 			++Current;
-			// 주석 토큰 스킵
-			while (Current < Tokens.Num() && Tokens[Current].Type == ETokenType::Comment)
+
+			// 직전 토큰만 남기고 소비한 토큰을 버림 (되돌아갈 수 있는 구간에서는 유지)
+			const int32 Consumed = Current - 1 - LookaheadBase;
+			if (BacktrackDepth == 0 && Consumed >= LookaheadTrimThreshold)
 			{
-				++Current;
+				Lookahead.RemoveAt(0, Consumed, EAllowShrinking::No);
+				LookaheadBase += Consumed;
 			}
 		}
 		return Previous();
@@ -76,13 +214,19 @@ namespace MagicScript
 
 		// 기대한 토큰이 아니면 에러 기록
 		ReportError(Peek(), ErrorMessage);
-		return Tokens.Last();
+		return EndOfFileToken;
 	}
 
 	void FParser::ReportError(const FToken& AtToken, const FString& Message)
 	{
 		bHadError = true;
 
+		// 렉스 에러로 입력이 끊긴 뒤의 구문 에러는 렉스 에러의 결과이므로 남기지 않음
+		if (bHadLexError)
+		{
+			return;
+		}
+
 		FString TokenDisplay = AtToken.Lexeme;
 		if (TokenDisplay.Len() > 50)
 		{
@@ -101,14 +245,27 @@ namespace MagicScript
 		);
 
 		ErrorMessages.Add(FullMsg);
-		AddScriptLog(EScriptLogType::Error, FullMsg);
-		UE_LOG(LogTemp, Error, TEXT("%s"), *FullMsg);
+		if (Host)
+		{
+			Host->AddScriptLog(EScriptLogType::Error, FullMsg, NAME_None, AtToken.Location.Line, AtToken.Location.Column);
+		}
+		else
+		{
+			AddScriptLog(EScriptLogType::Error, FullMsg, AtToken.Location.Line, AtToken.Location.Column);
+		}
+		UE_LOG(LogMagicScript, Error, TEXT("%s"), *FullMsg);
 
 		// 에러가 발생했을 때 현재 토큰 위치를 앞으로 진행시켜
 		// 같은 위치에서 무한히 ParseStatement/ParseExpression을 반복하지 않도록 한다.
 		Synchronize();
 	}
 
+	// 에러 복구 시 문장 경계로 보는 토큰
+	static constexpr FTokenTypeSet StatementStartTokens(
+		ETokenType::Let, ETokenType::Const, ETokenType::Function, ETokenType::Import,
+		ETokenType::If, ETokenType::Switch, ETokenType::While, ETokenType::For,
+		ETokenType::Return, ETokenType::LBrace);
+
 	void FParser::Synchronize()
 	{
 		// 최소 한 토큰은 소비
@@ -123,21 +280,9 @@ namespace MagicScript
 			}
 
 			// 다음 토큰이 문장 시작 키워드면 여기서 멈추고 상위에서 처리
-			switch (Peek().Type)
+			if (StatementStartTokens.Contains(Peek().Type))
 			{
-			case ETokenType::Let:
-			case ETokenType::Const:
-			case ETokenType::Function:
-			case ETokenType::Import:
-			case ETokenType::If:
-			case ETokenType::Switch:
-			case ETokenType::While:
-			case ETokenType::For:
-			case ETokenType::Return:
-			case ETokenType::LBrace:
 				return;
-			default:
-				break;
 			}
 
 			Advance();
@@ -146,7 +291,9 @@ namespace MagicScript
 
 	TSharedPtr<FProgram> FParser::ParseProgram()
 	{
-		TSharedPtr<FProgram> Program = MakeShared<FProgram>();
+		// 모든 노드는 이 프로그램의 아레나에 만들어짐
+		TSharedPtr<FProgram> NewProgram = MakeShared<FProgram>();
+		Program = NewProgram.Get();
 
 		while (!IsAtEnd())
 		{
@@ -169,48 +316,61 @@ namespace MagicScript
 			}
 		}
 
-		return Program;
+		Program = nullptr;
+		return NewProgram;
 	}
 
 	FStatementPtr FParser::ParseStatement()
 	{
-		if (Match({ ETokenType::Import }))
+		// 문장 시작 토큰 위치를 노드에 기록 (런타임 에러/프로파일러에서 라인 표시용)
+		const FSourceLocation StartLocation = Peek().Location;
+		FStatementPtr Stmt = ParseStatementByKeyword();
+		if (Stmt.IsValid())
+		{
+			Stmt->Location = StartLocation;
+		}
+		return Stmt;
+	}
+
+	FStatementPtr FParser::ParseStatementByKeyword()
+	{
+		if (Match(ETokenType::Import))
 		{
 			return ParseImportStatement();
 		}
-		if (Match({ ETokenType::Let }))
+		if (Match(ETokenType::Let))
 		{
 			return ParseVariableDeclaration(false);
 		}
-		if (Match({ ETokenType::Const }))
+		if (Match(ETokenType::Const))
 		{
 			return ParseVariableDeclaration(true);
 		}
-		if (Match({ ETokenType::Function }))
+		if (Match(ETokenType::Function))
 		{
 			return ParseFunctionDeclaration();
 		}
-		if (Match({ ETokenType::If }))
+		if (Match(ETokenType::If))
 		{
 			return ParseIfStatement();
 		}
-		if (Match({ ETokenType::Switch }))
+		if (Match(ETokenType::Switch))
 		{
 			return ParseSwitchStatement();
 		}
-		if (Match({ ETokenType::While }))
+		if (Match(ETokenType::While))
 		{
 			return ParseWhileStatement();
 		}
-		if (Match({ ETokenType::For }))
+		if (Match(ETokenType::For))
 		{
 			return ParseForStatement();
 		}
-		if (Match({ ETokenType::Return }))
+		if (Match(ETokenType::Return))
 		{
 			return ParseReturnStatement();
 		}
-		if (Match({ ETokenType::LBrace }))
+		if (Match(ETokenType::LBrace))
 		{
 			return ParseBlockStatement();
 		}
@@ -227,7 +387,7 @@ namespace MagicScript
 
 		FStatementPtr Body = ParseStatement();
 
-		TSharedPtr<FWhileStatement> WhileStmt = MakeShared<FWhileStatement>();
+		FWhileStatement* WhileStmt = NewNode<FWhileStatement>();
 		WhileStmt->Condition = Condition;
 		WhileStmt->Body = Body;
 		return WhileStmt;
@@ -236,11 +396,9 @@ namespace MagicScript
 	FStatementPtr FParser::ParseImportStatement()
 	{
 		// import "Scripts/Util.ms";
-		const FToken& PathTok = Consume(ETokenType::String, TEXT("Expected string literal after 'import'."));
+		FImportStatement* ImportStmt = NewNode<FImportStatement>();
+		ImportStmt->Path = Consume(ETokenType::String, TEXT("Expected string literal after 'import'.")).Lexeme;
 		Consume(ETokenType::Semicolon, TEXT("Expected ';' after import statement."));
-
-		TSharedPtr<FImportStatement> ImportStmt = MakeShared<FImportStatement>();
-		ImportStmt->Path = PathTok.Lexeme;
 		return ImportStmt;
 	}
 
@@ -248,11 +406,12 @@ namespace MagicScript
 	{
 		const FToken& NameTok = Consume(ETokenType::Identifier, TEXT("Expected variable name."));
 
-		TSharedPtr<FVarDeclStatement> Decl = MakeShared<FVarDeclStatement>();
+		FVarDeclStatement* Decl = NewNode<FVarDeclStatement>();
+		Decl->Location = NameTok.Location;
 		Decl->bIsConst = bIsConst;
 		Decl->Name = NameTok.Lexeme;
 
-		if (Match({ ETokenType::Equal }))
+		if (Match(ETokenType::Equal))
 		{
 			Decl->Initializer = ParseExpression();
 		}
@@ -263,12 +422,11 @@ namespace MagicScript
 
 	FStatementPtr FParser::ParseFunctionDeclaration()
 	{
-		const FToken& NameTok = Consume(ETokenType::Identifier, TEXT("Expected function name."));
+		FFuncDeclStatement* Func = NewNode<FFuncDeclStatement>();
+		Func->Name = Consume(ETokenType::Identifier, TEXT("Expected function name.")).Lexeme;
+		Func->Owner = Program;
 		Consume(ETokenType::LParen, TEXT("Expected '(' after function name."));
 
-		TSharedPtr<FFuncDeclStatement> Func = MakeShared<FFuncDeclStatement>();
-		Func->Name = NameTok.Lexeme;
-
 		if (!Check(ETokenType::RParen))
 		{
 			do
@@ -276,13 +434,13 @@ namespace MagicScript
 				const FToken& ParamTok = Consume(ETokenType::Identifier, TEXT("Expected parameter name."));
 				Func->Parameters.Add(ParamTok.Lexeme);
 			}
-			while (Match({ ETokenType::Comma }));
+			while (Match(ETokenType::Comma));
 		}
 
 		Consume(ETokenType::RParen, TEXT("Expected ')' after parameters."));
 		Consume(ETokenType::LBrace, TEXT("Expected '{' before function body."));
 
-		Func->Body = StaticCastSharedPtr<FBlockStatement>(ParseBlockStatement());
+		Func->Body = ParseBlockStatement();
 		return Func;
 	}
 
@@ -295,12 +453,12 @@ namespace MagicScript
 		FStatementPtr ThenBranch = ParseStatement();
 		FStatementPtr ElseBranch;
 
-		if (Match({ ETokenType::Else }))
+		if (Match(ETokenType::Else))
 		{
 			ElseBranch = ParseStatement();
 		}
 
-		TSharedPtr<FIfStatement> IfStmt = MakeShared<FIfStatement>();
+		FIfStatement* IfStmt = NewNode<FIfStatement>();
 		IfStmt->Condition = Condition;
 		IfStmt->ThenBranch = ThenBranch;
 		IfStmt->ElseBranch = ElseBranch;
@@ -315,14 +473,14 @@ namespace MagicScript
 		Consume(ETokenType::RParen, TEXT("Expected ')' after switch expression."));
 		Consume(ETokenType::LBrace, TEXT("Expected '{' after switch expression."));
 
-		TSharedPtr<FSwitchStatement> SwitchStmt = MakeShared<FSwitchStatement>();
+		FSwitchStatement* SwitchStmt = NewNode<FSwitchStatement>();
 		SwitchStmt->Expression = Expression;
 
 		bool bFoundDefault = false;
 
 		while (!Check(ETokenType::RBrace) && !IsAtEnd())
 		{
-			if (Match({ ETokenType::Case }))
+			if (Match(ETokenType::Case))
 			{
 				FSwitchCase Case;
 				Case.Value = ParseExpression();
@@ -340,7 +498,7 @@ namespace MagicScript
 
 				SwitchStmt->Cases.Add(Case);
 			}
-			else if (Match({ ETokenType::Default }))
+			else if (Match(ETokenType::Default))
 			{
 				if (bFoundDefault)
 				{
@@ -382,11 +540,11 @@ namespace MagicScript
 		FStatementPtr Init;
 		if (!Check(ETokenType::Semicolon))
 		{
-			if (Match({ ETokenType::Let }))
+			if (Match(ETokenType::Let))
 			{
 				Init = ParseVariableDeclaration(false);
 			}
-			else if (Match({ ETokenType::Const }))
+			else if (Match(ETokenType::Const))
 			{
 				Init = ParseVariableDeclaration(true);
 			}
@@ -416,7 +574,7 @@ namespace MagicScript
 
 		FStatementPtr Body = ParseStatement();
 
-		TSharedPtr<FForStatement> ForStmt = MakeShared<FForStatement>();
+		FForStatement* ForStmt = NewNode<FForStatement>();
 		ForStmt->Init = Init;
 		ForStmt->Condition = Condition;
 		ForStmt->Increment = Increment;
@@ -426,7 +584,7 @@ namespace MagicScript
 
 	FStatementPtr FParser::ParseReturnStatement()
 	{
-		TSharedPtr<FReturnStatement> Ret = MakeShared<FReturnStatement>();
+		FReturnStatement* Ret = NewNode<FReturnStatement>();
 
 		if (!Check(ETokenType::Semicolon))
 		{
@@ -437,9 +595,10 @@ namespace MagicScript
 		return Ret;
 	}
 
-	TSharedPtr<FBlockStatement> FParser::ParseBlockStatement()
+	TAstPtr<FBlockStatement> FParser::ParseBlockStatement()
 	{
-		TSharedPtr<FBlockStatement> Block = MakeShared<FBlockStatement>();
+		FBlockStatement* Block = NewNode<FBlockStatement>();
+		Block->Location = Previous().Location;  // '{'
 
 		while (!Check(ETokenType::RBrace) && !IsAtEnd())
 		{
@@ -463,8 +622,12 @@ namespace MagicScript
 		FExpressionPtr Expr = ParseExpression();
 		Consume(ETokenType::Semicolon, TEXT("Expected ';' after expression."));
 
-		TSharedPtr<FExpressionStatement> Stmt = MakeShared<FExpressionStatement>();
+		FExpressionStatement* Stmt = NewNode<FExpressionStatement>();
 		Stmt->Expr = Expr;
+		if (Expr.IsValid())
+		{
+			Stmt->Location = Expr->Location;
+		}
 		return Stmt;
 	}
 
@@ -472,51 +635,51 @@ namespace MagicScript
 
 	FExpressionPtr FParser::ParseExpression()
 	{
-		return ParseAssignment();
+		return ParseExpression(Precedence::Assignment);
 	}
 
-	FExpressionPtr FParser::ParseAssignment()
+	FExpressionPtr FParser::ParseExpression(const uint8 MinPrecedence)
 	{
-		// 좌변은 Identifier 로 제한 (초기 버전)
-		FExpressionPtr Left = ParseLogicalOr();
+		// Pratt 파싱: 전위 식 하나를 읽고, 다음 연산자의 우선순위가 MinPrecedence 이상인 동안 이어 붙임
+		FExpressionPtr Left = ParseUnary();
 
-		// 복합 할당 연산자 확인
-		EAssignmentOp AssignOp = EAssignmentOp::Assign;
-		if (Match({ ETokenType::Equal }))
-		{
-			AssignOp = EAssignmentOp::Assign;
-		}
-		else if (Match({ ETokenType::PlusEqual }))
-		{
-			AssignOp = EAssignmentOp::AddAssign;
-		}
-		else if (Match({ ETokenType::MinusEqual }))
-		{
-			AssignOp = EAssignmentOp::SubAssign;
-		}
-		else if (Match({ ETokenType::StarEqual }))
-		{
-			AssignOp = EAssignmentOp::MulAssign;
-		}
-		else if (Match({ ETokenType::SlashEqual }))
-		{
-			AssignOp = EAssignmentOp::DivAssign;
-		}
-		else if (Match({ ETokenType::PercentEqual }))
-		{
-			AssignOp = EAssignmentOp::ModAssign;
-		}
-		else
+		while (true)
 		{
-			return Left;
-		}
+			const FInfixRule& Rule = OperatorTable.Infix[static_cast<uint8>(Peek().Type)];
+			if (Rule.Kind == EInfixKind::None || Rule.Precedence < MinPrecedence)
+			{
+				return Left;
+			}
+
+			Advance();
+			const FSourceLocation OpLocation = Previous().Location;
+			const uint8 RightPrecedence = Rule.bRightAssociative ? Rule.Precedence : Rule.Precedence + 1;
 
-		FExpressionPtr Value = ParseAssignment();
+			if (Rule.Kind == EInfixKind::Assignment)
+			{
+				// 할당은 가장 낮은 우선순위이고 우결합이므로 우변이 나머지 식을 모두 소비함
+				const FSourceLocation AssignLocation = Left.IsValid() ? Left->Location : OpLocation;
+				FExpressionPtr Value = ParseExpression(RightPrecedence);
+				return FinishAssignment(Left, Rule.AssignmentOp, AssignLocation, Value);
+			}
 
+			FBinaryExpression* Bin = NewNode<FBinaryExpression>();
+			Bin->Location = OpLocation;
+			Bin->Op = Rule.BinaryOp;
+			Bin->Left = Left;
+			Bin->Right = ParseExpression(RightPrecedence);
+			Left = Bin;
+		}
+	}
+
+	FExpressionPtr FParser::FinishAssignment(const FExpressionPtr& Left, const EAssignmentOp AssignOp,
+		const FSourceLocation& AssignLocation, const FExpressionPtr& Value)
+	{
 		if (Left.IsValid() && Left->Kind == EExpressionKind::Identifier)
 		{
-			TSharedPtr<FIdentifierExpression> Ident = StaticCastSharedPtr<FIdentifierExpression>(Left);
-			TSharedPtr<FAssignmentExpression> Assign = MakeShared<FAssignmentExpression>();
+			TAstPtr<FIdentifierExpression> Ident = StaticCastAstPtr<FIdentifierExpression>(Left);
+			FAssignmentExpression* Assign = NewNode<FAssignmentExpression>();
+			Assign->Location = AssignLocation;
 			Assign->Op = AssignOp;
 			Assign->TargetName = Ident->Name;
 			Assign->Value = Value;
@@ -526,12 +689,13 @@ namespace MagicScript
 		if (Left.IsValid() && Left->Kind == EExpressionKind::MemberAccess)
 		{
 			// 객체 멤버 할당: obj.property = value
-			TSharedPtr<FMemberAccessExpression> MemberAccess = StaticCastSharedPtr<FMemberAccessExpression>(Left);
+			TAstPtr<FMemberAccessExpression> MemberAccess = StaticCastAstPtr<FMemberAccessExpression>(Left);
 			
 			if (MemberAccess->Target->Kind == EExpressionKind::Identifier)
 			{
-				TSharedPtr<FIdentifierExpression> Ident = StaticCastSharedPtr<FIdentifierExpression>(MemberAccess->Target);
-				TSharedPtr<FAssignmentExpression> Assign = MakeShared<FAssignmentExpression>();
+				TAstPtr<FIdentifierExpression> Ident = StaticCastAstPtr<FIdentifierExpression>(MemberAccess->Target);
+				FAssignmentExpression* Assign = NewNode<FAssignmentExpression>();
+				Assign->Location = AssignLocation;
 				Assign->Op = AssignOp;
 				Assign->TargetName = Ident->Name;
 				Assign->MemberName = MemberAccess->MemberName;
@@ -554,13 +718,14 @@ namespace MagicScript
 		if (Left.IsValid() && Left->Kind == EExpressionKind::Index)
 		{
 			// 배열 인덱싱 할당: arr[0] = value
-			TSharedPtr<FIndexExpression> IndexExpr = StaticCastSharedPtr<FIndexExpression>(Left);
-			TSharedPtr<FAssignmentExpression> Assign = MakeShared<FAssignmentExpression>();
+			TAstPtr<FIndexExpression> IndexExpr = StaticCastAstPtr<FIndexExpression>(Left);
+			FAssignmentExpression* Assign = NewNode<FAssignmentExpression>();
+			Assign->Location = AssignLocation;
 			Assign->Op = AssignOp;
 			
 			if (IndexExpr->Target->Kind == EExpressionKind::Identifier)
 			{
-				TSharedPtr<FIdentifierExpression> Ident = StaticCastSharedPtr<FIdentifierExpression>(IndexExpr->Target);
+				TAstPtr<FIdentifierExpression> Ident = StaticCastAstPtr<FIdentifierExpression>(IndexExpr->Target);
 				Assign->TargetName = Ident->Name;
 				Assign->Index = IndexExpr->Index;
 				Assign->Value = Value;
@@ -585,163 +750,29 @@ namespace MagicScript
 		return Left;
 	}
 
-	FExpressionPtr FParser::ParseLogicalOr()
-	{
-		FExpressionPtr Expr = ParseLogicalAnd();
-
-		while (Match({ ETokenType::OrOr }))
-		{
-			TSharedPtr<FBinaryExpression> Bin = MakeShared<FBinaryExpression>();
-			Bin->Op = EBinaryOp::Or;
-			Bin->Left = Expr;
-			Bin->Right = ParseLogicalAnd();
-			Expr = Bin;
-		}
-
-		return Expr;
-	}
-
-	FExpressionPtr FParser::ParseLogicalAnd()
-	{
-		FExpressionPtr Expr = ParseEquality();
-
-		while (Match({ ETokenType::AndAnd }))
-		{
-			TSharedPtr<FBinaryExpression> Bin = MakeShared<FBinaryExpression>();
-			Bin->Op = EBinaryOp::And;
-			Bin->Left = Expr;
-			Bin->Right = ParseEquality();
-			Expr = Bin;
-		}
-
-		return Expr;
-	}
-
-	FExpressionPtr FParser::ParseEquality()
-	{
-		FExpressionPtr Expr = ParseRelational();
-
-		while (Match({ ETokenType::EqualEqual, ETokenType::BangEqual }))
-		{
-			const FToken& OpTok = Previous();
-			TSharedPtr<FBinaryExpression> Bin = MakeShared<FBinaryExpression>();
-			Bin->Op = (OpTok.Type == ETokenType::EqualEqual) ? EBinaryOp::Equal : EBinaryOp::NotEqual;
-			Bin->Left = Expr;
-			Bin->Right = ParseRelational();
-			Expr = Bin;
-		}
-
-		return Expr;
-	}
-
-	FExpressionPtr FParser::ParseRelational()
-	{
-		FExpressionPtr Expr = ParseAdditive();
-
-		while (Match({ ETokenType::Less, ETokenType::LessEqual, ETokenType::Greater, ETokenType::GreaterEqual }))
-		{
-			const FToken& OpTok = Previous();
-			TSharedPtr<FBinaryExpression> Bin = MakeShared<FBinaryExpression>();
-
-			switch (OpTok.Type)
-			{
-			case ETokenType::Less:          Bin->Op = EBinaryOp::Less; break;
-			case ETokenType::LessEqual:     Bin->Op = EBinaryOp::LessEqual; break;
-			case ETokenType::Greater:       Bin->Op = EBinaryOp::Greater; break;
-			case ETokenType::GreaterEqual:  Bin->Op = EBinaryOp::GreaterEqual; break;
-			default:                        Bin->Op = EBinaryOp::Less; break;
-			}
-
-			Bin->Left = Expr;
-			Bin->Right = ParseAdditive();
-			Expr = Bin;
-		}
-
-		return Expr;
-	}
-
-	FExpressionPtr FParser::ParseAdditive()
-	{
-		FExpressionPtr Expr = ParseMultiplicative();
-
-		while (Match({ ETokenType::Plus, ETokenType::Minus }))
-		{
-			const FToken& OpTok = Previous();
-			TSharedPtr<FBinaryExpression> Bin = MakeShared<FBinaryExpression>();
-			Bin->Op = (OpTok.Type == ETokenType::Plus) ? EBinaryOp::Add : EBinaryOp::Sub;
-			Bin->Left = Expr;
-			Bin->Right = ParseMultiplicative();
-			Expr = Bin;
-		}
-
-		return Expr;
-	}
-
-	FExpressionPtr FParser::ParseMultiplicative()
-	{
-		FExpressionPtr Expr = ParseUnary();
-
-		while (Match({ ETokenType::Star, ETokenType::Slash, ETokenType::Percent }))
-		{
-			const FToken& OpTok = Previous();
-			TSharedPtr<FBinaryExpression> Bin = MakeShared<FBinaryExpression>();
-
-			switch (OpTok.Type)
-			{
-			case ETokenType::Star:    Bin->Op = EBinaryOp::Mul; break;
-			case ETokenType::Slash:   Bin->Op = EBinaryOp::Div; break;
-			case ETokenType::Percent: Bin->Op = EBinaryOp::Mod; break;
-			default:                  Bin->Op = EBinaryOp::Mul; break;
-			}
-
-			Bin->Left = Expr;
-			Bin->Right = ParseUnary();
-			Expr = Bin;
-		}
-
-		return Expr;
-	}
-
 	FExpressionPtr FParser::ParseUnary()
 	{
-		if (Match({ ETokenType::Bang }))
+		const EUnaryOp* PrefixOp = OperatorTable.FindPrefix(Peek().Type);
+		if (!PrefixOp)
 		{
-			TSharedPtr<FUnaryExpression> Expr = MakeShared<FUnaryExpression>();
-			Expr->Op = EUnaryOp::Not;
-			Expr->Operand = ParseUnary();
-			return Expr;
-		}
-		if (Match({ ETokenType::Minus }))
-		{
-			TSharedPtr<FUnaryExpression> Expr = MakeShared<FUnaryExpression>();
-			Expr->Op = EUnaryOp::Negate;
-			Expr->Operand = ParseUnary();
-			return Expr;
-		}
-		if (Match({ ETokenType::PlusPlus }))
-		{
-			TSharedPtr<FUnaryExpression> Expr = MakeShared<FUnaryExpression>();
-			Expr->Op = EUnaryOp::PreIncrement;
-			Expr->Operand = ParseUnary();
-			return Expr;
-		}
-		if (Match({ ETokenType::MinusMinus }))
-		{
-			TSharedPtr<FUnaryExpression> Expr = MakeShared<FUnaryExpression>();
-			Expr->Op = EUnaryOp::PreDecrement;
-			Expr->Operand = ParseUnary();
-			return Expr;
+			return ParseCallOrIdentifier();
 		}
 
-		return ParseCallOrIdentifier();
+		Advance();
+		FUnaryExpression* Expr = NewNode<FUnaryExpression>();
+		Expr->Location = Previous().Location;
+		Expr->Op = *PrefixOp;
+		Expr->Operand = ParseUnary();
+		return Expr;
 	}
 
 	FExpressionPtr FParser::ParseCallOrIdentifier()
 	{
 		// 객체 리터럴
-		if (Match({ ETokenType::LBrace }))
+		if (Match(ETokenType::LBrace))
 		{
-			TSharedPtr<FObjectLiteralExpression> ObjectLit = MakeShared<FObjectLiteralExpression>();
+			FObjectLiteralExpression* ObjectLit = NewNode<FObjectLiteralExpression>();
+			ObjectLit->Location = Previous().Location;
 
 			// 빈 객체 체크
 			if (Check(ETokenType::RBrace))
@@ -756,11 +787,11 @@ namespace MagicScript
 				FObjectProperty Prop;
 				
 				// 키는 식별자 또는 문자열 리터럴
-				if (Match({ ETokenType::Identifier }))
+				if (Match(ETokenType::Identifier))
 				{
 					Prop.Key = Previous().Lexeme;
 				}
-				else if (Match({ ETokenType::String }))
+				else if (Match(ETokenType::String))
 				{
 					Prop.Key = Previous().Lexeme;
 					// 따옴표 제거
@@ -789,7 +820,7 @@ namespace MagicScript
 				ObjectLit->Properties.Add(Prop);
 				
 				// trailing comma 체크: 쉼표 후 바로 }가 오는 경우 허용
-				if (Match({ ETokenType::Comma }))
+				if (Match(ETokenType::Comma))
 				{
 					if (Check(ETokenType::RBrace))
 					{
@@ -809,9 +840,10 @@ namespace MagicScript
 		}
 
 		// 배열 리터럴
-		if (Match({ ETokenType::LBracket }))
+		if (Match(ETokenType::LBracket))
 		{
-			TSharedPtr<FArrayLiteralExpression> ArrayLit = MakeShared<FArrayLiteralExpression>();
+			FArrayLiteralExpression* ArrayLit = NewNode<FArrayLiteralExpression>();
+			ArrayLit->Location = Previous().Location;
 
 			if (!Check(ETokenType::RBracket))
 			{
@@ -819,7 +851,7 @@ namespace MagicScript
 				{
 					ArrayLit->Elements.Add(ParseExpression());
 				}
-				while (Match({ ETokenType::Comma }));
+				while (Match(ETokenType::Comma));
 			}
 
 			Consume(ETokenType::RBracket, TEXT("Expected ']' after array elements."));
@@ -827,10 +859,12 @@ namespace MagicScript
 		}
 
 		// 기본 단위
-		if (Match({ ETokenType::LParen }))
+		if (Match(ETokenType::LParen))
 		{
 			// Arrow 함수인지 확인: () => ... 또는 (param) => ... 또는 (param1, param2) => ...
-			int32 SavedCurrent = Current;
+			// 아니면 되돌아가야 하므로 확인하는 동안 lookahead 버퍼를 버리지 않음
+			const int32 SavedCurrent = Current;
+			++BacktrackDepth;
 			TArray<FString> Params;
 			
 			// 파라미터 목록 파싱 시도
@@ -849,61 +883,56 @@ namespace MagicScript
 						break;
 					}
 				}
-				while (Match({ ETokenType::Comma }));
+				while (Match(ETokenType::Comma));
 			}
 			
 			// ) 다음에 => 가 오는지 확인 (파라미터가 있든 없든)
 			// 파라미터가 없는 경우 () => 형태도 처리
+			bool bIsArrow = false;
 			if (Check(ETokenType::RParen))
 			{
 				Advance(); // ) 소비
 				if (Check(ETokenType::Arrow))
 				{
 					Advance(); // => 소비
-					// Arrow 함수 파싱
-					return ParseArrowFunction(Params);
-				}
-				else
-				{
-					// ) 다음에 => 가 없으면 Arrow 함수가 아님
-					// 원래대로 그룹 표현식으로 파싱
-					Current = SavedCurrent;
-					FExpressionPtr Inner = ParseExpression();
-					Consume(ETokenType::RParen, TEXT("Expected ')' after expression."));
-
-					TSharedPtr<FGroupingExpression> Group = MakeShared<FGroupingExpression>();
-					Group->Inner = Inner;
-					return Group;
+					bIsArrow = true;
 				}
 			}
-			else
+			--BacktrackDepth;
+
+			if (bIsArrow)
 			{
-				// ) 가 없으면 Arrow 함수가 아님
-				// 원래대로 그룹 표현식으로 파싱
-				Current = SavedCurrent;
-				FExpressionPtr Inner = ParseExpression();
-				Consume(ETokenType::RParen, TEXT("Expected ')' after expression."));
-
-				TSharedPtr<FGroupingExpression> Group = MakeShared<FGroupingExpression>();
-				Group->Inner = Inner;
-				return Group;
+				return ParseArrowFunction(Params);
 			}
+
+			// Arrow 함수가 아니면 원래대로 그룹 표현식으로 파싱
+			Current = SavedCurrent;
+			FExpressionPtr Inner = ParseExpression();
+			Consume(ETokenType::RParen, TEXT("Expected ')' after expression."));
+
+			FGroupingExpression* Group = NewNode<FGroupingExpression>();
+			Group->Location = Previous().Location;
+			Group->Inner = Inner;
+			return Group;
 		}
 
-		if (Match({ ETokenType::Number, ETokenType::String, ETokenType::True, ETokenType::False, ETokenType::Null }))
+		if (Match(ETokenType::Number, ETokenType::String, ETokenType::True, ETokenType::False, ETokenType::Null))
 		{
 			return ParseLiteral(Previous());
 		}
 
-		if (Match({ ETokenType::Identifier }))
+		if (Match(ETokenType::Identifier))
 		{
-			const FToken& NameTok = Previous();
+			// 다음 토큰을 당겨 오면 Previous 참조가 무효가 될 수 있으므로 먼저 복사
+			const FSourceLocation NameLocation = Previous().Location;
+			FString Name = Previous().Lexeme;
 
 			// 함수 호출인지 확인
-			if (Match({ ETokenType::LParen }))
+			if (Match(ETokenType::LParen))
 			{
-				TSharedPtr<FCallExpression> Call = MakeShared<FCallExpression>();
-				Call->CalleeName = NameTok.Lexeme;
+				FCallExpression* Call = NewNode<FCallExpression>();
+				Call->Location = NameLocation;
+				Call->CalleeName = MoveTemp(Name);
 
 				if (!Check(ETokenType::RParen))
 				{
@@ -911,7 +940,7 @@ namespace MagicScript
 					{
 						Call->Arguments.Add(ParseExpression());
 					}
-					while (Match({ ETokenType::Comma }));
+					while (Match(ETokenType::Comma));
 				}
 
 				Consume(ETokenType::RParen, TEXT("Expected ')' after arguments."));
@@ -919,8 +948,9 @@ namespace MagicScript
 			}
 			else
 			{
-				TSharedPtr<FIdentifierExpression> Ident = MakeShared<FIdentifierExpression>();
-				Ident->Name = NameTok.Lexeme;
+				FIdentifierExpression* Ident = NewNode<FIdentifierExpression>();
+				Ident->Location = NameLocation;
+				Ident->Name = MoveTemp(Name);
 				return ParsePostfix(Ident);
 			}
 		}
@@ -935,37 +965,40 @@ namespace MagicScript
 		// 인덱싱 및 멤버 접근 처리
 		while (true)
 		{
-			if (Match({ ETokenType::LBracket }))
+			if (Match(ETokenType::LBracket))
 			{
 				FExpressionPtr Index = ParseExpression();
 				Consume(ETokenType::RBracket, TEXT("Expected ']' after index."));
 
-				TSharedPtr<FIndexExpression> IndexExpr = MakeShared<FIndexExpression>();
+				FIndexExpression* IndexExpr = NewNode<FIndexExpression>();
+				IndexExpr->Location = Previous().Location;
 				IndexExpr->Target = Left;
 				IndexExpr->Index = Index;
 				Left = IndexExpr;
 			}
-			else if (Match({ ETokenType::Dot }))
+			else if (Match(ETokenType::Dot))
 			{
 				// 멤버 접근: arr.push_back 또는 console.log
 				const FToken& MemberTok = Consume(ETokenType::Identifier, TEXT("Expected member name after '.'"));
 				
-				TSharedPtr<FMemberAccessExpression> MemberAccess = MakeShared<FMemberAccessExpression>();
+				FMemberAccessExpression* MemberAccess = NewNode<FMemberAccessExpression>();
+				MemberAccess->Location = MemberTok.Location;
 				MemberAccess->Target = Left;
 				MemberAccess->MemberName = MemberTok.Lexeme;
 				Left = MemberAccess;
 				
 				// 멤버 접근 후 함수 호출이 오는 경우: arr.push_back(value) 또는 console.log(value)
-				if (Match({ ETokenType::LParen }))
+				if (Match(ETokenType::LParen))
 				{
-					TSharedPtr<FCallExpression> Call = MakeShared<FCallExpression>();
+					FCallExpression* Call = NewNode<FCallExpression>();
+					Call->Location = MemberAccess->Location;
 					
 					// Target이 Identifier인 경우 objectName.memberName 형태로 저장
 					// 인터프리터에서 ThisValue 타입에 따라 Array.memberName으로 변환할지 결정
 					FString CalleeName;
 					if (MemberAccess->Target->Kind == EExpressionKind::Identifier)
 					{
-						TSharedPtr<FIdentifierExpression> Ident = StaticCastSharedPtr<FIdentifierExpression>(MemberAccess->Target);
+						TAstPtr<FIdentifierExpression> Ident = StaticCastAstPtr<FIdentifierExpression>(MemberAccess->Target);
 						CalleeName = FString::Printf(TEXT("%s.%s"), *Ident->Name, *MemberAccess->MemberName);
 					}
 					else
@@ -983,26 +1016,28 @@ namespace MagicScript
 						{
 							Call->Arguments.Add(ParseExpression());
 						}
-						while (Match({ ETokenType::Comma }));
+						while (Match(ETokenType::Comma));
 					}
 					
 					Consume(ETokenType::RParen, TEXT("Expected ')' after arguments."));
 					Left = Call;
 				}
 			}
-			else if (Match({ ETokenType::PlusPlus }))
+			else if (Match(ETokenType::PlusPlus))
 			{
 				// 후위 증가: x++
-				TSharedPtr<FPostfixExpression> Postfix = MakeShared<FPostfixExpression>();
+				FPostfixExpression* Postfix = NewNode<FPostfixExpression>();
+				Postfix->Location = Previous().Location;
 				Postfix->Kind = EExpressionKind::PostfixIncrement;
 				Postfix->Operand = Left;
 				Postfix->bIsIncrement = true;
 				Left = Postfix;
 			}
-			else if (Match({ ETokenType::MinusMinus }))
+			else if (Match(ETokenType::MinusMinus))
 			{
 				// 후위 감소: x--
-				TSharedPtr<FPostfixExpression> Postfix = MakeShared<FPostfixExpression>();
+				FPostfixExpression* Postfix = NewNode<FPostfixExpression>();
+				Postfix->Location = Previous().Location;
 				Postfix->Kind = EExpressionKind::PostfixDecrement;
 				Postfix->Operand = Left;
 				Postfix->bIsIncrement = false;
@@ -1025,18 +1060,21 @@ namespace MagicScript
 
 	FExpressionPtr FParser::ParseLiteral(const FToken& Token)
 	{
-		TSharedPtr<FLiteralExpression> Lit = MakeShared<FLiteralExpression>();
+		FLiteralExpression* Lit = NewNode<FLiteralExpression>();
+		Lit->Location = Token.Location;
 		Lit->LiteralToken = Token;
 		return Lit;
 	}
 
 	FExpressionPtr FParser::ParseArrowFunction(const TArray<FString>& Parameters)
 	{
-		TSharedPtr<FArrowFunctionExpression> ArrowFunc = MakeShared<FArrowFunctionExpression>();
+		FArrowFunctionExpression* ArrowFunc = NewNode<FArrowFunctionExpression>();
+		ArrowFunc->Location = Previous().Location;
 		ArrowFunc->Parameters = Parameters;
+		ArrowFunc->Owner = Program;
 
 		// 단일 표현식인지 블록인지 확인
-		if (Match({ ETokenType::LBrace }))
+		if (Match(ETokenType::LBrace))
 		{
 			// 블록: (x) => { return x + 1; }
 			ArrowFunc->BodyBlock = ParseBlockStatement();
@@ -1044,7 +1082,19 @@ namespace MagicScript
 		else
 		{
 			// 단일 표현식: (x) => x + 1
+			// 호출할 때마다 감싸지 않도록 { return Body; } 블록을 미리 만들어 둠
 			ArrowFunc->Body = ParseExpression();
+			if (ArrowFunc->Body.IsValid())
+			{
+				FReturnStatement* ReturnStmt = NewNode<FReturnStatement>();
+				ReturnStmt->Location = ArrowFunc->Body->Location;
+				ReturnStmt->Value = ArrowFunc->Body;
+
+				FBlockStatement* BodyBlock = NewNode<FBlockStatement>();
+				BodyBlock->Location = ArrowFunc->Location;
+				BodyBlock->Statements.Add(ReturnStmt);
+				ArrowFunc->BodyBlock = BodyBlock;
+			}
 		}
 
 		return ArrowFunc;
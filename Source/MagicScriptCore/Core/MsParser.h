@@ -0,0 +1,152 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MagicScriptCore/Core/MsToken.h"
+#include "MagicScriptCore/Core/MsAst.h"
+
+namespace MagicScript
+{
+	class IScriptHost;
+	class FLexer;
+
+	/**
+	 * 재귀 하향 파서 뼈대
+	 * - EBNF 스펙에 맞는 AST 생성 책임
+	 * - 현재는 인터페이스와 주요 진입점만 정의
+	 */
+	class MAGICSCRIPTCORE_API FParser
+	{
+	public:
+		// InHost: 구문 에러 로그를 받을 호스트 (null이면 기본 호스트 사용)
+		// InScriptName: 렉스 에러 로그에 붙일 스크립트 이름
+		FParser(const TArray<FToken>& InTokens, IScriptHost* InHost = nullptr, const FString& InScriptName = FString());
+
+		// 렉서에서 필요할 때마다 토큰을 당겨 오며 파싱 (전체 토큰 배열을 만들지 않음, 렉스 에러도 파싱 중에 보고)
+		FParser(FLexer& InLexer, IScriptHost* InHost = nullptr, const FString& InScriptName = FString());
+
+		// 프로그램 전체 파싱
+		TSharedPtr<FProgram> ParseProgram();
+
+		// 파싱 도중 에러가 발생했는지 여부
+		bool HasError() const { return bHadError; }
+
+		// 렉스 에러로 파싱을 멈췄는지 여부 (렉스 에러 로그는 이미 남김)
+		bool HasLexError() const { return bHadLexError; }
+
+		// 에러 메시지 목록 (간단 텍스트)
+		const TArray<FString>& GetErrors() const { return ErrorMessages; }
+
+	private:
+		// 소비한 토큰이 이만큼 쌓이면 lookahead 버퍼 앞부분을 버림
+		static constexpr int32 LookaheadTrimThreshold = 16;
+
+		// 토큰 공급원 (렉서 또는 미리 만든 토큰 배열)
+		FLexer* Lexer = nullptr;
+		const TArray<FToken>* SourceTokens = nullptr;
+		int32 SourceIndex = 0;
+
+		/**
+		 * 주석을 걸러낸 lookahead 버퍼
+		 * - Lookahead[0]의 절대 위치가 LookaheadBase, Current는 절대 위치
+		 * - 직전 토큰(Previous)과 아직 소비하지 않은 토큰만 남기므로 메모리는 O(lookahead)
+		 * - 되돌아갈 수 있는 구간(BacktrackDepth > 0)에서는 버리지 않음
+		 * - Peek/Previous가 돌려준 참조는 다음 토큰을 당겨 오기 전까지만 유효
+		 */
+		TArray<FToken> Lookahead;
+		int32 LookaheadBase = 0;
+		int32 Current = 0;
+		int32 BacktrackDepth = 0;
+		FToken EndOfFileToken;
+
+		IScriptHost* Host = nullptr;
+		FString ScriptName;
+
+		bool bHadError = false;
+		bool bHadLexError = false;
+		TArray<FString> ErrorMessages;
+
+		// 파싱 중인 프로그램 (노드를 이 프로그램의 아레나에 할당)
+		FProgram* Program = nullptr;
+
+		template<typename NodeType>
+		NodeType* NewNode()
+		{
+			return Program->Arena.New<NodeType>();
+		}
+
+		const FToken& Peek()
+		{
+			if (Current - LookaheadBase >= Lookahead.Num())
+			{
+				Lookahead.Add(PullToken());
+			}
+			return Lookahead[Current - LookaheadBase];
+		}
+
+		const FToken& Previous() const { return Lookahead[Current - 1 - LookaheadBase]; }
+		bool IsAtEnd() { return Peek().Type == ETokenType::EndOfFile; }
+		bool Check(const ETokenType Type) { return Type != ETokenType::EndOfFile && Peek().Type == Type; }
+		bool Check(const FTokenTypeSet& Types) { return Types.Contains(Peek().Type) && !IsAtEnd(); }
+
+		// 다음 토큰이 주어진 종류 중 하나면 소비 (Match(ETokenType::Plus, ETokenType::Minus))
+		template<typename... TTypes>
+		bool Match(const ETokenType First, const TTypes... Rest)
+		{
+			const ETokenType Type = Peek().Type;
+			if (Type != ETokenType::EndOfFile && ((Type == First) || ... || (Type == Rest)))
+			{
+				Advance();
+				return true;
+			}
+			return false;
+		}
+
+		bool Match(const FTokenTypeSet& Types)
+		{
+			if (Check(Types))
+			{
+				Advance();
+				return true;
+			}
+			return false;
+		}
+
+		const FToken& Advance();
+		const FToken& Consume(ETokenType Type, const FString& ErrorMessage);
+
+		// 공급원에서 주석이 아닌 다음 토큰을 가져옴 (렉스 에러는 보고하고 EndOfFile로 바꿔 파싱을 끝냄)
+		FToken PullToken();
+		void ReportLexError(const FToken& ErrorToken);
+
+		void ReportError(const FToken& AtToken, const FString& Message);
+		void Synchronize();
+
+		// 문장
+		FStatementPtr ParseStatement();
+		FStatementPtr ParseStatementByKeyword();
+		FStatementPtr ParseVariableDeclaration(bool bIsConst);
+		FStatementPtr ParseFunctionDeclaration();
+		FStatementPtr ParseImportStatement();
+		FStatementPtr ParseIfStatement();
+		FStatementPtr ParseSwitchStatement();
+		FStatementPtr ParseWhileStatement();
+		FStatementPtr ParseForStatement();
+		FStatementPtr ParseReturnStatement();
+		TAstPtr<FBlockStatement> ParseBlockStatement();
+		FStatementPtr ParseExpressionStatement();
+
+		// 표현식 (이항/할당 연산자는 MsParser.cpp의 연산자 표로 우선순위를 한 루프에서 처리)
+		FExpressionPtr ParseExpression();
+		FExpressionPtr ParseExpression(uint8 MinPrecedence);
+		FExpressionPtr FinishAssignment(const FExpressionPtr& Left, EAssignmentOp AssignOp,
+			const FSourceLocation& AssignLocation, const FExpressionPtr& Value);
+		FExpressionPtr ParseUnary();
+		FExpressionPtr ParsePrimary();
+
+		FExpressionPtr ParseCallOrIdentifier();
+		FExpressionPtr ParsePostfix(FExpressionPtr Left);
+		FExpressionPtr ParseLiteral(const FToken& Token);
+		FExpressionPtr ParseArrowFunction(const TArray<FString>& Parameters);
+	};
+}
+
@@ -0,0 +1,160 @@
+#include "MagicScriptCore/Core/MsStringRope.h"
+#include "MagicScriptCore/Runtime/MsScriptHeap.h"
+
+namespace MagicScript
+{
+	FStringRope::FStringRope()
+	{
+		if (FScriptHeap* CurrentHeap = FScriptHeap::GetCurrent())
+		{
+			Heap = CurrentHeap->AsShared();
+			TrackedBytes = sizeof(FStringRope);
+			Heap->Allocate(EScriptHeapCategory::String, TrackedBytes);
+		}
+	}
+
+	FStringRope::~FStringRope()
+	{
+		if (Heap.IsValid())
+		{
+			Heap->Release(EScriptHeapCategory::String, TrackedBytes);
+		}
+	}
+
+	void FStringRope::UpdateTracking()
+	{
+		if (!Heap.IsValid())
+		{
+			return;
+		}
+
+		const int64 NewBytes = sizeof(FStringRope) + Flat.GetAllocatedSize();
+		Heap->Resize(EScriptHeapCategory::String, TrackedBytes, NewBytes);
+		TrackedBytes = NewBytes;
+	}
+
+	TSharedPtr<FStringRope> FStringRope::MakeLeaf(FString InText)
+	{
+		TSharedPtr<FStringRope> Leaf = MakeShared<FStringRope>();
+		Leaf->Length = InText.Len();
+		Leaf->Flat = MoveTemp(InText);
+		Leaf->UpdateTracking();
+		return Leaf;
+	}
+
+	TSharedPtr<FStringRope> FStringRope::Concat(const TSharedPtr<FStringRope>& InLeft, const TSharedPtr<FStringRope>& InRight)
+	{
+		if (!InLeft.IsValid() || InLeft->Len() == 0)
+		{
+			return InRight;
+		}
+		if (!InRight.IsValid() || InRight->Len() == 0)
+		{
+			return InLeft;
+		}
+
+		// 짧은 결과는 바로 복사해서 평탄한 노드로 만든다
+		const int32 Length = InLeft->Len() + InRight->Len();
+		if (Length <= FlatConcatThreshold)
+		{
+			TSharedPtr<FStringRope> Leaf = MakeShared<FStringRope>();
+			Leaf->Length = Length;
+			Leaf->Flat.Reserve(Length);
+			Leaf->Flat += InLeft->Flatten();
+			Leaf->Flat += InRight->Flatten();
+			Leaf->UpdateTracking();
+			return Leaf;
+		}
+
+		// AVL 결합: 깊은 쪽의 안쪽 가장자리를 따라 내려가 깊이가 맞는 곳에 붙이고 회전으로 균형 복구
+		// s = s + x, s = x + s 어느 쪽을 반복해도 깊이가 O(log n), 작은 조각은 FlatConcatThreshold까지 한 잎으로 합쳐짐
+		if (InLeft->Depth > InRight->Depth + 1)
+		{
+			TSharedPtr<FStringRope> Joined = Concat(InLeft->Right, InRight);
+			if (Joined->Depth <= InLeft->Left->Depth + 1)
+			{
+				return MakeNode(InLeft->Left, Joined);
+			}
+			if (Joined->Left->Depth > Joined->Right->Depth)
+			{
+				Joined = RotateRight(Joined);
+			}
+			return RotateLeft(MakeNode(InLeft->Left, Joined));
+		}
+		if (InRight->Depth > InLeft->Depth + 1)
+		{
+			TSharedPtr<FStringRope> Joined = Concat(InLeft, InRight->Left);
+			if (Joined->Depth <= InRight->Right->Depth + 1)
+			{
+				return MakeNode(Joined, InRight->Right);
+			}
+			if (Joined->Right->Depth > Joined->Left->Depth)
+			{
+				Joined = RotateLeft(Joined);
+			}
+			return RotateRight(MakeNode(Joined, InRight->Right));
+		}
+
+		TSharedPtr<FStringRope> Node = MakeNode(InLeft, InRight);
+		if (Node->Depth > MaxDepth)
+		{
+			Node->Flatten();
+		}
+		return Node;
+	}
+
+	TSharedPtr<FStringRope> FStringRope::MakeNode(const TSharedPtr<FStringRope>& InLeft, const TSharedPtr<FStringRope>& InRight)
+	{
+		TSharedPtr<FStringRope> Node = MakeShared<FStringRope>();
+		Node->Length = InLeft->Len() + InRight->Len();
+		Node->Left = InLeft;
+		Node->Right = InRight;
+		Node->Depth = FMath::Max(InLeft->Depth, InRight->Depth) + 1;
+		return Node;
+	}
+
+	TSharedPtr<FStringRope> FStringRope::RotateLeft(const TSharedPtr<FStringRope>& InNode)
+	{
+		const TSharedPtr<FStringRope>& Pivot = InNode->Right;
+		return MakeNode(MakeNode(InNode->Left, Pivot->Left), Pivot->Right);
+	}
+
+	TSharedPtr<FStringRope> FStringRope::RotateRight(const TSharedPtr<FStringRope>& InNode)
+	{
+		const TSharedPtr<FStringRope>& Pivot = InNode->Left;
+		return MakeNode(Pivot->Left, MakeNode(Pivot->Right, InNode->Right));
+	}
+
+	const FString& FStringRope::Flatten()
+	{
+		if (IsFlat())
+		{
+			return Flat;
+		}
+
+		FString Result;
+		Result.Reserve(Length);
+
+		// 중위 순회를 명시적 스택으로 수행 (깊은 로프에서도 네이티브 스택을 쓰지 않음)
+		TArray<FStringRope*, TInlineAllocator<64>> Stack;
+		Stack.Add(this);
+		while (Stack.Num() > 0)
+		{
+			FStringRope* Node = Stack.Pop();
+			if (Node->IsFlat())
+			{
+				Result += Node->Flat;
+				continue;
+			}
+			Stack.Add(Node->Right.Get());
+			Stack.Add(Node->Left.Get());
+		}
+
+		Flat = MoveTemp(Result);
+		Left.Reset();
+		Right.Reset();
+		Depth = 0;
+		UpdateTracking();
+		return Flat;
+	}
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace MagicScript
+{
+	class FScriptHeap;
+
+	/**
+	 * 스크립트 문자열 연결용 로프(Rope) 노드
+	 * - 연결은 문자열을 복사하지 않고 노드만 만듦 (AVL 방식 결합으로 깊이를 O(log n)으로 유지)
+	 * - s = s + x 반복도 연결 한 번에 O(log n) 노드만 새로 만들어 전체 복사가 생기지 않음
+	 * - 실제 문자열이 필요할 때 한 번만 평탄화(Flatten)하고 결과를 노드에 캐싱
+	 * - 값 복사본끼리 노드를 공유하므로 평탄화 비용도 공유됨
+	 * - 생성 시점의 스크립트 힙(FScriptHeap)에 노드와 버퍼 크기를 기록
+	 */
+	class MAGICSCRIPTCORE_API FStringRope
+	{
+	public:
+		// 이 길이 이하의 연결은 로프를 만들지 않고 바로 복사 (작은 문자열은 복사가 더 저렴)
+		static constexpr int32 FlatConcatThreshold = 64;
+
+		// 균형 결합의 안전장치: 로프 깊이가 이 값을 넘으면 평탄화 (소멸 시 재귀 깊이 제한)
+		static constexpr int32 MaxDepth = 256;
+
+		FStringRope();
+		~FStringRope();
+
+		static TSharedPtr<FStringRope> MakeLeaf(FString InText);
+		static TSharedPtr<FStringRope> Concat(const TSharedPtr<FStringRope>& InLeft, const TSharedPtr<FStringRope>& InRight);
+
+		int32 Len() const { return Length; }
+		int32 GetDepth() const { return Depth; }
+		bool IsFlat() const { return !Left.IsValid(); }
+
+		// 전체 문자열 반환 (최초 호출 시 한 번만 버퍼를 만들고 자식 노드를 해제)
+		const FString& Flatten();
+
+	private:
+		FString Flat;
+		TSharedPtr<FStringRope> Left;
+		TSharedPtr<FStringRope> Right;
+		int32 Length = 0;
+		int32 Depth = 0;
+
+		// 메모리 추적 (노드 + 평탄 버퍼)
+		TSharedPtr<FScriptHeap, ESPMode::ThreadSafe> Heap;
+		int64 TrackedBytes = 0;
+
+		void UpdateTracking();
+
+		// 균형 규칙 없이 두 노드를 잇는 노드 생성
+		static TSharedPtr<FStringRope> MakeNode(const TSharedPtr<FStringRope>& InLeft, const TSharedPtr<FStringRope>& InRight);
+
+		// 균형 복구용 회전 (기존 노드는 공유될 수 있으므로 수정하지 않고 새 노드를 만듦)
+		static TSharedPtr<FStringRope> RotateLeft(const TSharedPtr<FStringRope>& InNode);
+		static TSharedPtr<FStringRope> RotateRight(const TSharedPtr<FStringRope>& InNode);
+	};
+}
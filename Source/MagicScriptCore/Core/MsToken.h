@@ -74,15 +74,41 @@ namespace MagicScript
 		Arrow       // =>
 	};
 
+	/** 토큰 종류 집합 (64비트 비트셋, 만들 때/확인할 때 할당 없음) */
+	struct FTokenTypeSet
+	{
+		uint64 Bits = 0;
+
+		constexpr FTokenTypeSet() = default;
+
+		template<typename... TTypes>
+		constexpr explicit FTokenTypeSet(const ETokenType First, const TTypes... Rest)
+			: Bits((Bit(First) | ... | Bit(Rest)))
+		{
+		}
+
+		constexpr bool Contains(const ETokenType Type) const
+		{
+			return (Bits & Bit(Type)) != 0;
+		}
+
+	private:
+		static constexpr uint64 Bit(const ETokenType Type)
+		{
+			return uint64(1) << static_cast<uint8>(Type);
+		}
+	};
+	static_assert(static_cast<uint8>(ETokenType::Arrow) < 64, "FTokenTypeSet holds at most 64 token types");
+
 	/** 소스 코드 상의 위치 정보 */
-	struct MAGICSCRIPT_API FSourceLocation
+	struct MAGICSCRIPTCORE_API FSourceLocation
 	{
 		int32 Line = 1;
 		int32 Column = 1;
 	};
 
 	/** 렉서 결과 토큰 */
-	struct MAGICSCRIPT_API FToken
+	struct MAGICSCRIPTCORE_API FToken
 	{
 		ETokenType Type = ETokenType::Error;
 		FString    Lexeme;
@@ -0,0 +1,263 @@
+#include "MagicScriptCore/Core/MsValue.h"
+#include "MagicScriptCore/Runtime/MsScriptHeap.h"
+
+namespace MagicScript
+{
+	namespace
+	{
+		/**
+		 * 제한 깊이/길이를 지키며 하나의 버퍼에 값을 기록하는 포맷터
+		 * - 길이 제한에 걸리면 "..."을 한 번만 붙이고 이후 기록은 모두 무시
+		 * - 제한 깊이를 넘는 컨테이너는 내용 대신 "[...]" 등으로 요약
+		 */
+		struct FDebugStringWriter
+		{
+			FStringBuilderBase& Out;
+			int32 MaxDepth = 0;
+			int32 EndLength = 0;  // 0이면 무제한
+			bool bTruncated = false;
+
+			bool HasRoom() const
+			{
+				return !bTruncated && (EndLength <= 0 || Out.Len() < EndLength);
+			}
+
+			void Truncate()
+			{
+				if (!bTruncated)
+				{
+					bTruncated = true;
+					Out.Append(TEXT("..."));
+				}
+			}
+
+			void Write(const TCHAR* Text, int32 TextLen)
+			{
+				if (!HasRoom())
+				{
+					Truncate();
+					return;
+				}
+
+				if (EndLength > 0 && Out.Len() + TextLen > EndLength)
+				{
+					Out.Append(Text, EndLength - Out.Len());
+					Truncate();
+					return;
+				}
+				Out.Append(Text, TextLen);
+			}
+
+			void Write(const TCHAR* Text)
+			{
+				Write(Text, FCString::Strlen(Text));
+			}
+
+			void Write(const FString& Text)
+			{
+				Write(*Text, Text.Len());
+			}
+
+			// 깊이 제한에 걸렸는지 (0이면 무제한)
+			bool IsTooDeep(int32 Depth) const
+			{
+				return MaxDepth > 0 && Depth >= MaxDepth;
+			}
+
+			void WriteValue(const FValue& Value, int32 Depth)
+			{
+				if (!HasRoom())
+				{
+					Truncate();
+					return;
+				}
+
+				switch (Value.Type)
+				{
+				case EValueType::Null:   Write(TEXT("null")); return;
+				case EValueType::Number: Write(FString::SanitizeFloat(Value.Number)); return;
+				case EValueType::Bool:   Write(Value.Bool ? TEXT("true") : TEXT("false")); return;
+				case EValueType::String:
+					Write(TEXT("\""));
+					Write(Value.GetString());
+					Write(TEXT("\""));
+					return;
+				case EValueType::Function:
+					Write(TEXT("<spell "));
+					Write(Value.Function.IsValid() ? Value.Function->Name : FString());
+					Write(TEXT(">"));
+					return;
+				case EValueType::NativeObject:
+					Write(Value.NativeObjectPtr.IsValid() ? Value.NativeObjectPtr->GetName() : FString(TEXT("null")));
+					return;
+				case EValueType::Array:
+				{
+					if (!Value.Array.IsValid() || Value.Array->Num() == 0)
+					{
+						Write(TEXT("[]"));
+						return;
+					}
+					if (IsTooDeep(Depth))
+					{
+						Write(TEXT("[...]"));
+						return;
+					}
+					Write(TEXT("["));
+					for (int32 i = 0; i < Value.Array->Num() && HasRoom(); ++i)
+					{
+						if (i > 0)
+						{
+							Write(TEXT(", "));
+						}
+						WriteValue((*Value.Array)[i], Depth + 1);
+					}
+					Write(TEXT("]"));
+					return;
+				}
+				case EValueType::Object:
+				{
+					if (!Value.Object.IsValid() || Value.Object->Num() == 0)
+					{
+						Write(TEXT("{}"));
+						return;
+					}
+					if (IsTooDeep(Depth))
+					{
+						Write(TEXT("{...}"));
+						return;
+					}
+					Write(TEXT("{ "));
+					bool bFirst = true;
+					for (const auto& Pair : *Value.Object)
+					{
+						if (!HasRoom())
+						{
+							break;
+						}
+						if (!bFirst)
+						{
+							Write(TEXT(", "));
+						}
+						bFirst = false;
+						Write(Pair.Key);
+						Write(TEXT(": "));
+						WriteValue(Pair.Value, Depth + 1);
+					}
+					Write(TEXT(" }"));
+					return;
+				}
+				case EValueType::Map:
+				{
+					if (!Value.Map.IsValid() || Value.Map->Num() == 0)
+					{
+						Write(TEXT("Map {}"));
+						return;
+					}
+					if (IsTooDeep(Depth))
+					{
+						Write(TEXT("Map {...}"));
+						return;
+					}
+					Write(TEXT("Map { "));
+					bool bFirst = true;
+					for (const auto& Pair : *Value.Map)
+					{
+						if (!HasRoom())
+						{
+							break;
+						}
+						if (!bFirst)
+						{
+							Write(TEXT(", "));
+						}
+						bFirst = false;
+						WriteValue(Pair.Key, Depth + 1);
+						Write(TEXT(" => "));
+						WriteValue(Pair.Value, Depth + 1);
+					}
+					Write(TEXT(" }"));
+					return;
+				}
+				case EValueType::Set:
+				{
+					if (!Value.Set.IsValid() || Value.Set->Num() == 0)
+					{
+						Write(TEXT("Set {}"));
+						return;
+					}
+					if (IsTooDeep(Depth))
+					{
+						Write(TEXT("Set {...}"));
+						return;
+					}
+					Write(TEXT("Set { "));
+					bool bFirst = true;
+					for (const FValue& Elem : *Value.Set)
+					{
+						if (!HasRoom())
+						{
+							break;
+						}
+						if (!bFirst)
+						{
+							Write(TEXT(", "));
+						}
+						bFirst = false;
+						WriteValue(Elem, Depth + 1);
+					}
+					Write(TEXT(" }"));
+					return;
+				}
+				default:
+					Write(TEXT("<unknown>"));
+					return;
+				}
+			}
+		};
+	}
+
+	FValue FValue::FromArray(const TSharedPtr<TArray<FValue>>& InArray)
+	{
+		FValue V;
+		V.Type = EValueType::Array;
+		V.Array = AdoptScriptContainer(InArray);
+		return V;
+	}
+
+	FValue FValue::FromObject(const TSharedPtr<TMap<FString, FValue>>& InObject)
+	{
+		FValue V;
+		V.Type = EValueType::Object;
+		V.Object = AdoptScriptContainer(InObject);
+		return V;
+	}
+
+	FValue FValue::FromMap(const TSharedPtr<FValueMap>& InMap)
+	{
+		FValue V;
+		V.Type = EValueType::Map;
+		V.Map = AdoptScriptContainer(InMap);
+		return V;
+	}
+
+	FValue FValue::FromSet(const TSharedPtr<FValueSet>& InSet)
+	{
+		FValue V;
+		V.Type = EValueType::Set;
+		V.Set = AdoptScriptContainer(InSet);
+		return V;
+	}
+
+	FString FValue::ToDebugString() const
+	{
+		TStringBuilder<256> Builder;
+		AppendDebugString(Builder);
+		return FString(Builder.ToString());
+	}
+
+	void FValue::AppendDebugString(FStringBuilderBase& Out, int32 MaxDepth, int32 MaxLength) const
+	{
+		FDebugStringWriter Writer{ Out, MaxDepth, MaxLength > 0 ? Out.Len() + MaxLength : 0 };
+		Writer.WriteValue(*this, 0);
+	}
+}
@@ -0,0 +1,260 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MagicScriptCore/Core/MsStringRope.h"
+#include "MagicScriptCore/Core/MsAstArena.h"
+
+namespace MagicScript
+{
+	class FEnvironment;
+	struct FProgram;
+	struct FValue;
+	struct FScriptExecutionContext;
+
+	struct FValueMapKeyFuncs;
+	struct FValueSetKeyFuncs;
+
+	// Map/Set 컬렉션 (Number/String/Bool 키를 타입 그대로 해싱)
+	using FValueMap = TMap<FValue, FValue, FDefaultSetAllocator, FValueMapKeyFuncs>;
+	using FValueSet = TSet<FValue, FValueSetKeyFuncs>;
+
+	// 값 타입
+	enum class EValueType : uint8
+	{
+		Null,
+		Number,
+		String,
+		Bool,
+		Function,
+		Array,
+		Object,
+		NativeObject,
+		Map,
+		Set
+	};
+
+	// 런타임 함수 표현 (AST + 환경)
+	struct MAGICSCRIPTCORE_API FFunctionValue
+	{
+		FString Name;
+		TArray<FString> Parameters;
+		FStatementPtr Body;
+		TSharedPtr<const FProgram> Program;  // Body가 있는 AST 아레나를 spell 값이 살아 있는 동안 유지
+		TSharedPtr<FEnvironment> Closure;
+
+		// 네이티브(C++) 함수 여부 및 구현
+		bool bIsNative = false;
+		TFunction<FValue(const TArray<FValue>&, const FScriptExecutionContext&)> NativeImpl;
+
+		int32 SpaceCostBytes = 0;
+		int32 TimeComplexityAdditionalScore = 0;
+	};
+
+	// 인터프리터 런타임 값
+	struct MAGICSCRIPTCORE_API FValue
+	{
+		EValueType Type = EValueType::Null;
+		double     Number = 0.0;
+		bool       Bool = false;
+		FString    String;
+		TSharedPtr<FFunctionValue> Function;
+		TSharedPtr<TArray<FValue>> Array;
+		TSharedPtr<TMap<FString, FValue>> Object;  // 객체: 키-값 쌍
+		TWeakObjectPtr<> NativeObjectPtr;
+		TSharedPtr<FValueMap> Map;
+		TSharedPtr<FValueSet> Set;
+		TSharedPtr<FStringRope> Rope;  // 연결로 만들어진 문자열 (유효하면 String 대신 사용)
+
+		static FValue Null()
+		{
+			return FValue();
+		}
+
+		static FValue FromNumber(double InNumber)
+		{
+			FValue V;
+			V.Type = EValueType::Number;
+			V.Number = InNumber;
+			return V;
+		}
+
+		static FValue FromBool(bool bInBool)
+		{
+			FValue V;
+			V.Type = EValueType::Bool;
+			V.Bool = bInBool;
+			return V;
+		}
+
+		static FValue FromString(const FString& InString)
+		{
+			FValue V;
+			V.Type = EValueType::String;
+			V.String = InString;
+			return V;
+		}
+
+		static FValue FromRope(const TSharedPtr<FStringRope>& InRope)
+		{
+			FValue V;
+			V.Type = EValueType::String;
+			V.Rope = InRope;
+			return V;
+		}
+
+		static FValue FromFunction(const TSharedPtr<FFunctionValue>& InFunc)
+		{
+			FValue V;
+			V.Type = EValueType::Function;
+			V.Function = InFunc;
+			return V;
+		}
+
+		// 컨테이너 값 생성 - MakeScript*로 만들지 않은 컨테이너(호스트의 MakeShared 등)는 스크립트 힙 컨테이너로 복사해서 담음
+		// (스크립트가 바꾸는 것은 복사본이므로 호스트는 반환된 값의 컨테이너를 읽어야 함)
+		static FValue FromArray(const TSharedPtr<TArray<FValue>>& InArray);
+		static FValue FromObject(const TSharedPtr<TMap<FString, FValue>>& InObject);
+
+		static FValue FromNativeObject(UObject* InObject)
+		{
+			FValue V;
+			V.Type = EValueType::NativeObject;
+			V.NativeObjectPtr = InObject;
+
+			return V;
+		}
+
+		static FValue FromMap(const TSharedPtr<FValueMap>& InMap);
+		static FValue FromSet(const TSharedPtr<FValueSet>& InSet);
+
+		// 문자열 값 접근 (로프라면 최초 접근 시 한 번만 평탄화)
+		const FString& GetString() const
+		{
+			return Rope.IsValid() ? Rope->Flatten() : String;
+		}
+
+		int32 GetStringLen() const
+		{
+			return Rope.IsValid() ? Rope->Len() : String.Len();
+		}
+
+		// 문자열 연결 등에서 사용하는 표시용 문자열 (문자열은 따옴표 없이)
+		FString ToScriptString() const;
+
+		// 문자열 연결: 한쪽이라도 문자열이면 사용, 큰 문자열은 복사 없이 로프 노드로 연결
+		static FValue ConcatStrings(const FValue& Left, const FValue& Right);
+
+		// Map/Set 키로 사용할 수 있는 타입인지 (원시 값만 허용)
+		bool IsHashableKey() const
+		{
+			return Type == EValueType::Number || Type == EValueType::String || Type == EValueType::Bool;
+		}
+
+		// 디버깅용 문자열 (제한 없음)
+		FString ToDebugString() const;
+
+		// 디버깅용 문자열을 버퍼에 이어서 기록 (중간 FString 없이 스트리밍)
+		// MaxDepth: 중첩 컨테이너 출력 깊이, MaxLength: 이번 호출로 기록할 최대 글자 수 (0이면 무제한)
+		void AppendDebugString(FStringBuilderBase& Out, int32 MaxDepth = 0, int32 MaxLength = 0) const;
+	};
+
+	// 로그 출력용 디버그 문자열 제한 (큰 배열/객체를 로그로 남겨도 비용이 일정하도록)
+	constexpr int32 DebugStringLogMaxDepth = 4;
+	constexpr int32 DebugStringLogMaxLength = 1024;
+
+	// 스크립트 숫자를 int32 인덱스/길이로 변환 (소수점 버림, NaN은 0, 범위를 넘으면 양 끝으로 보정)
+	inline int32 NumberToInt32(const double Number)
+	{
+		if (FMath::IsNaN(Number))
+		{
+			return 0;
+		}
+		return static_cast<int32>(FMath::Clamp(Number, static_cast<double>(MIN_int32), static_cast<double>(MAX_int32)));
+	}
+
+	// 원시 값 키 해싱/비교 (문자열은 대소문자 구분, 숫자와 문자열 "1"은 서로 다른 키, NaN 키끼리는 같은 키)
+	inline bool ValueKeysMatch(const FValue& A, const FValue& B)
+	{
+		if (A.Type != B.Type)
+		{
+			return false;
+		}
+
+		switch (A.Type)
+		{
+		case EValueType::Number: return A.Number == B.Number || (FMath::IsNaN(A.Number) && FMath::IsNaN(B.Number));
+		case EValueType::String: return A.GetString().Equals(B.GetString(), ESearchCase::CaseSensitive);
+		case EValueType::Bool:   return A.Bool == B.Bool;
+		case EValueType::Null:   return true;
+		default:                 return false;
+		}
+	}
+
+	inline uint32 GetValueKeyHash(const FValue& Key)
+	{
+		uint32 Hash = ::GetTypeHash(static_cast<uint8>(Key.Type));
+		switch (Key.Type)
+		{
+		case EValueType::Number:
+			// -0.0 과 0.0 은 같은 키로, NaN은 비트 패턴과 관계없이 한 키로 취급
+			Hash = HashCombine(Hash, FMath::IsNaN(Key.Number) ? 0x7ff80000u : ::GetTypeHash(Key.Number == 0.0 ? 0.0 : Key.Number));
+			break;
+		case EValueType::String:
+			Hash = HashCombine(Hash, FCrc::StrCrc32(*Key.GetString()));
+			break;
+		case EValueType::Bool:
+			Hash = HashCombine(Hash, ::GetTypeHash(Key.Bool));
+			break;
+		default:
+			break;
+		}
+		return Hash;
+	}
+
+	struct FValueMapKeyFuncs : TDefaultMapKeyFuncs<FValue, FValue, false>
+	{
+		static FORCEINLINE bool Matches(KeyInitType A, KeyInitType B) { return ValueKeysMatch(A, B); }
+		static FORCEINLINE uint32 GetKeyHash(KeyInitType Key) { return GetValueKeyHash(Key); }
+	};
+
+	struct FValueSetKeyFuncs : DefaultKeyFuncs<FValue>
+	{
+		static FORCEINLINE bool Matches(KeyInitType A, KeyInitType B) { return ValueKeysMatch(A, B); }
+		static FORCEINLINE uint32 GetKeyHash(KeyInitType Key) { return GetValueKeyHash(Key); }
+	};
+
+	inline FString FValue::ToScriptString() const
+	{
+		switch (Type)
+		{
+		case EValueType::Null:   return TEXT("null");
+		case EValueType::Number: return FString::SanitizeFloat(Number);
+		case EValueType::Bool:   return Bool ? TEXT("true") : TEXT("false");
+		case EValueType::String: return GetString();
+		default:                 return ToDebugString();
+		}
+	}
+
+	inline FValue FValue::ConcatStrings(const FValue& Left, const FValue& Right)
+	{
+		const bool bLeftRope = Left.Type == EValueType::String && Left.Rope.IsValid();
+		const bool bRightRope = Right.Type == EValueType::String && Right.Rope.IsValid();
+
+		// 양쪽 모두 평탄한 짧은 문자열이면 노드 없이 바로 연결
+		if (!bLeftRope && !bRightRope)
+		{
+			FString LeftText = (Left.Type == EValueType::String) ? Left.String : Left.ToScriptString();
+			const FString RightText = (Right.Type == EValueType::String) ? Right.String : Right.ToScriptString();
+			if (LeftText.Len() + RightText.Len() <= FStringRope::FlatConcatThreshold)
+			{
+				LeftText += RightText;
+				return FromString(LeftText);
+			}
+			return FromRope(FStringRope::Concat(FStringRope::MakeLeaf(MoveTemp(LeftText)), FStringRope::MakeLeaf(RightText)));
+		}
+
+		const TSharedPtr<FStringRope> LeftRope = bLeftRope ? Left.Rope : FStringRope::MakeLeaf(Left.Type == EValueType::String ? Left.String : Left.ToScriptString());
+		const TSharedPtr<FStringRope> RightRope = bRightRope ? Right.Rope : FStringRope::MakeLeaf(Right.Type == EValueType::String ? Right.String : Right.ToScriptString());
+		return FromRope(FStringRope::Concat(LeftRope, RightRope));
+	}
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+namespace MagicScript
+{
+	/**
+	 * 고정 용량 lock-free MPSC 링 버퍼 (Vyukov bounded queue)
+	 * - TryPush: 여러 스레드에서 동시에 호출 가능, 가득 차면 false (대기/할당 없음)
+	 * - TryPop: 단일 소비자(게임 스레드)만 호출
+	 * - 용량은 2의 거듭제곱으로 올림
+	 */
+	template <typename T>
+	class TMpscRingBuffer
+	{
+	public:
+		explicit TMpscRingBuffer(uint32 InCapacity)
+		{
+			const uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2));
+			Mask = Capacity - 1;
+			Cells = MakeUnique<FCell[]>(Capacity);
+			for (uint32 i = 0; i < Capacity; ++i)
+			{
+				Cells[i].Sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		TMpscRingBuffer(const TMpscRingBuffer&) = delete;
+		TMpscRingBuffer& operator=(const TMpscRingBuffer&) = delete;
+
+		bool TryPush(T&& Item)
+		{
+			uint64 Pos = EnqueuePos.load(std::memory_order_relaxed);
+			FCell* Cell = nullptr;
+			for (;;)
+			{
+				Cell = &Cells[Pos & Mask];
+				const uint64 Seq = Cell->Sequence.load(std::memory_order_acquire);
+				const int64 Diff = static_cast<int64>(Seq) - static_cast<int64>(Pos);
+				if (Diff == 0)
+				{
+					// 이 칸을 선점
+					if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (Diff < 0)
+				{
+					// 소비자가 아직 비우지 못한 칸 → 가득 참
+					return false;
+				}
+				else
+				{
+					Pos = EnqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			Cell->Value = MoveTemp(Item);
+			Cell->Sequence.store(Pos + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool TryPop(T& OutItem)
+		{
+			FCell& Cell = Cells[DequeuePos & Mask];
+			const uint64 Seq = Cell.Sequence.load(std::memory_order_acquire);
+			if (static_cast<int64>(Seq) - static_cast<int64>(DequeuePos + 1) < 0)
+			{
+				return false;
+			}
+
+			OutItem = MoveTemp(Cell.Value);
+			Cell.Sequence.store(DequeuePos + Mask + 1, std::memory_order_release);
+			++DequeuePos;
+			return true;
+		}
+
+		uint32 GetCapacity() const { return static_cast<uint32>(Mask + 1); }
+
+	private:
+		struct FCell
+		{
+			std::atomic<uint64> Sequence{0};
+			T Value;
+		};
+
+		TUniquePtr<FCell[]> Cells;
+		uint64 Mask = 0;
+
+		// 생산자/소비자 위치를 서로 다른 캐시 라인에 배치 (false sharing 방지)
+		alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> EnqueuePos{0};
+		alignas(PLATFORM_CACHE_LINE_SIZE) uint64 DequeuePos = 0;
+	};
+}
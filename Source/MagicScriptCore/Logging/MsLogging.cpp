@@ -0,0 +1,45 @@
+﻿#include "MagicScriptCore/Logging/MsLogging.h"
+#include "MagicScriptCore/Logging/MsLoggingEnum.h"
+#include "MagicScriptCore/Runtime/MsScriptHost.h"
+
+#include <atomic>
+
+DEFINE_LOG_CATEGORY(LogMagicScript);
+
+namespace MagicScript
+{
+	namespace
+	{
+		// 한 번 등록된 기본 호스트 (로그마다 WorldContext를 순회하지 않음)
+		std::atomic<IScriptHost*> GDefaultScriptHost{nullptr};
+	}
+
+	void SetDefaultScriptHost(IScriptHost* Host)
+	{
+		GDefaultScriptHost.store(Host, std::memory_order_release);
+	}
+
+	void ClearDefaultScriptHost(IScriptHost* Host)
+	{
+		// 다른 호스트가 이미 등록되어 있으면 유지
+		IScriptHost* Expected = Host;
+		GDefaultScriptHost.compare_exchange_strong(Expected, nullptr, std::memory_order_acq_rel);
+	}
+
+	IScriptHost* GetDefaultScriptHost()
+	{
+		return GDefaultScriptHost.load(std::memory_order_acquire);
+	}
+
+	void AddScriptLog(const EScriptLogType ScriptLogType, const FString& ScriptLogMessage, const int32 Line, const int32 Column)
+	{
+		if (IScriptHost* Host = GetDefaultScriptHost())
+		{
+			Host->AddScriptLog(ScriptLogType, ScriptLogMessage, NAME_None, Line, Column);
+			return;
+		}
+		
+		// 호스트가 없는 경우 UE_LOG로 대체
+		UE_LOG(LogMagicScript, Warning, TEXT("MagicScript: Failed to add script log (host not available): %s"), *ScriptLogMessage);
+	}
+}
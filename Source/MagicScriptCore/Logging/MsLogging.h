@@ -0,0 +1,22 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EScriptLogType : uint8;
+
+// MagicScript 엔진 로그 카테고리 (LogTemp 대신 사용, 별도 Verbosity 필터링 가능)
+MAGICSCRIPTCORE_API DECLARE_LOG_CATEGORY_EXTERN(LogMagicScript, Log, All);
+
+namespace MagicScript
+{
+	class IScriptHost;
+
+	// 호스트가 지정되지 않은 파서/인터프리터가 사용하는 기본 호스트로 로그 추가 (어느 스레드에서든 호출 가능)
+	// 기본 호스트도 없으면 LogMagicScript로 출력
+	MAGICSCRIPTCORE_API void AddScriptLog(const EScriptLogType ScriptLogType, const FString& ScriptLogMessage, const int32 Line = 0, const int32 Column = 0);
+
+	// 기본 호스트 등록/해제 (서브시스템 Initialize/Deinitialize 등에서 호출)
+	MAGICSCRIPTCORE_API void SetDefaultScriptHost(IScriptHost* Host);
+	MAGICSCRIPTCORE_API void ClearDefaultScriptHost(IScriptHost* Host);
+	MAGICSCRIPTCORE_API IScriptHost* GetDefaultScriptHost();
+}
@@ -11,7 +11,7 @@ enum class EScriptLogType : uint8
 };
 
 USTRUCT(BlueprintType)
-struct MAGICSCRIPT_API FScriptLog
+struct MAGICSCRIPTCORE_API FScriptLog
 {
 	GENERATED_BODY()
 
@@ -21,8 +21,21 @@ struct MAGICSCRIPT_API FScriptLog
 	UPROPERTY(BlueprintReadWrite)
 	FString LogMessage;
 
+	// 로그를 남긴 스크립트 (상대 경로, 알 수 없으면 None)
+	UPROPERTY(BlueprintReadWrite)
+	FName ScriptId;
+
+	// 소스 위치 (알 수 없으면 0)
+	UPROPERTY(BlueprintReadWrite)
+	int32 Line;
+
+	UPROPERTY(BlueprintReadWrite)
+	int32 Column;
+
 	FScriptLog()
 		: LogType(EScriptLogType::Default)
+		, Line(0)
+		, Column(0)
 	{
 	}
 };
\ No newline at end of file
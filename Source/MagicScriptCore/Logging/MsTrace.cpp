@@ -0,0 +1,22 @@
+#include "MagicScriptCore/Logging/MsTrace.h"
+
+#if MAGICSCRIPT_TRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(MagicScriptChannel);
+#endif
+
+namespace MagicScript
+{
+	void FScriptTraceScope::Begin(const TCHAR* Phase, const TCHAR* Detail, const TCHAR* SubDetail)
+	{
+#if MAGICSCRIPT_TRACE_ENABLED
+		TStringBuilder<256> Name;
+		Name << TEXT("MagicScript ") << Phase << TEXT(' ') << Detail;
+		if (SubDetail)
+		{
+			Name << TEXT(" (") << SubDetail << TEXT(')');
+		}
+		FCpuProfilerTrace::OutputBeginDynamicEvent(Name.ToString());
+		bActive = true;
+#endif
+	}
+}
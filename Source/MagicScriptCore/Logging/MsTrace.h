@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+#define MAGICSCRIPT_TRACE_ENABLED (UE_TRACE_ENABLED && CPUPROFILERTRACE_ENABLED)
+
+#if MAGICSCRIPT_TRACE_ENABLED
+// Unreal Insights 트레이스 채널 (-trace=cpu,MagicScript 로 켬)
+UE_TRACE_CHANNEL_EXTERN(MagicScriptChannel, MAGICSCRIPTCORE_API);
+#endif
+
+namespace MagicScript
+{
+	/**
+	 * 스크립트 실행 구간을 Insights CPU 트랙에 남기는 RAII 스코프
+	 * - 채널이 꺼져 있으면 이름 문자열을 만들지 않음 (채널 플래그 검사 비용만 발생)
+	 * - 이름은 "MagicScript <단계> <스크립트/spell>" 형식
+	 */
+	class MAGICSCRIPTCORE_API FScriptTraceScope
+	{
+	public:
+		FScriptTraceScope(const TCHAR* Phase, const FString& Detail)
+		{
+#if MAGICSCRIPT_TRACE_ENABLED
+			if (IsChannelEnabled())
+			{
+				Begin(Phase, *Detail, nullptr);
+			}
+#endif
+		}
+
+		FScriptTraceScope(const TCHAR* Phase, const FString& Detail, const FString& SubDetail)
+		{
+#if MAGICSCRIPT_TRACE_ENABLED
+			if (IsChannelEnabled())
+			{
+				Begin(Phase, *Detail, *SubDetail);
+			}
+#endif
+		}
+
+		~FScriptTraceScope()
+		{
+#if MAGICSCRIPT_TRACE_ENABLED
+			if (bActive)
+			{
+				FCpuProfilerTrace::OutputEndEvent();
+			}
+#endif
+		}
+
+		FScriptTraceScope(const FScriptTraceScope&) = delete;
+		FScriptTraceScope& operator=(const FScriptTraceScope&) = delete;
+
+		static bool IsChannelEnabled()
+		{
+#if MAGICSCRIPT_TRACE_ENABLED
+			return UE_TRACE_CHANNELEXPR_IS_ENABLED(MagicScriptChannel) && UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel);
+#else
+			return false;
+#endif
+		}
+
+	private:
+		bool bActive = false;
+
+		void Begin(const TCHAR* Phase, const TCHAR* Detail, const TCHAR* SubDetail);
+	};
+}
+
+// 사용 예: MS_TRACE_SCOPE(TEXT("Parse"), RelativePath);
+#define MS_TRACE_SCOPE(Phase, ...) \
+	::MagicScript::FScriptTraceScope PREPROCESSOR_JOIN(MsTraceScope_, __LINE__)(Phase, __VA_ARGS__)
@@ -0,0 +1,17 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MagicScriptCore.h"
+
+#define LOCTEXT_NAMESPACE "FMagicScriptCoreModule"
+
+void FMagicScriptCoreModule::StartupModule()
+{
+}
+
+void FMagicScriptCoreModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FMagicScriptCoreModule, MagicScriptCore)
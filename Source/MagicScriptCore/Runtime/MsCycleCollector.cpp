@@ -0,0 +1,387 @@
+#include "MagicScriptCore/Runtime/MsCycleCollector.h"
+#include "MagicScriptCore/Core/MsEnvironment.h"
+#include "Misc/ScopeLock.h"
+
+namespace MagicScript
+{
+	namespace
+	{
+		// 값이 가리키는 힙 노드 (Map/Set 키는 원시 값만 허용되므로 값 쪽만 따라감)
+		template <typename VisitorType>
+		void VisitValueReferences(const FValue& Value, VisitorType& Visitor)
+		{
+			if (Value.Function.IsValid()) Visitor(Value.Function);
+			if (Value.Array.IsValid())    Visitor(Value.Array);
+			if (Value.Object.IsValid())   Visitor(Value.Object);
+			if (Value.Map.IsValid())      Visitor(Value.Map);
+			if (Value.Set.IsValid())      Visitor(Value.Set);
+		}
+
+		// 해제 중 노드가 먼저 소멸하지 않도록 붙잡아 두는 참조
+		struct FGarbagePins
+		{
+			TArray<TSharedPtr<FEnvironment>> Environments;
+			TArray<TSharedPtr<FFunctionValue>> Functions;
+			TArray<TSharedPtr<TArray<FValue>>> Arrays;
+			TArray<TSharedPtr<TMap<FString, FValue>>> Objects;
+			TArray<TSharedPtr<FValueMap>> Maps;
+			TArray<TSharedPtr<FValueSet>> Sets;
+
+			void Add(const TSharedPtr<FEnvironment>& Ptr) { Environments.Add(Ptr); }
+			void Add(const TSharedPtr<FFunctionValue>& Ptr) { Functions.Add(Ptr); }
+			void Add(const TSharedPtr<TArray<FValue>>& Ptr) { Arrays.Add(Ptr); }
+			void Add(const TSharedPtr<TMap<FString, FValue>>& Ptr) { Objects.Add(Ptr); }
+			void Add(const TSharedPtr<FValueMap>& Ptr) { Maps.Add(Ptr); }
+			void Add(const TSharedPtr<FValueSet>& Ptr) { Sets.Add(Ptr); }
+		};
+	}
+
+	// 노드가 직접 들고 있는 shared 참조를 하나씩 방문 (참조 하나 = 카운트 하나)
+	template <typename VisitorType>
+	void FScriptCycleCollector::ForEachReference(const void* Ptr, EScriptHeapCategory Category, VisitorType& Visitor)
+	{
+		switch (Category)
+		{
+		case EScriptHeapCategory::Environment:
+		{
+			const FEnvironment* Env = static_cast<const FEnvironment*>(Ptr);
+			if (Env->Parent.IsValid())
+			{
+				Visitor(Env->Parent);
+			}
+			for (const TPair<FString, FEnvironment::FEntry>& Pair : Env->Table)
+			{
+				VisitValueReferences(Pair.Value.Value, Visitor);
+			}
+			break;
+		}
+		case EScriptHeapCategory::Function:
+		{
+			const FFunctionValue* Func = static_cast<const FFunctionValue*>(Ptr);
+			if (Func->Closure.IsValid())
+			{
+				Visitor(Func->Closure);
+			}
+			break;
+		}
+		case EScriptHeapCategory::Array:
+			for (const FValue& Elem : *static_cast<const TArray<FValue>*>(Ptr))
+			{
+				VisitValueReferences(Elem, Visitor);
+			}
+			break;
+		case EScriptHeapCategory::Object:
+			for (const TPair<FString, FValue>& Pair : *static_cast<const TMap<FString, FValue>*>(Ptr))
+			{
+				VisitValueReferences(Pair.Value, Visitor);
+			}
+			break;
+		case EScriptHeapCategory::Map:
+			for (const TPair<FValue, FValue>& Pair : *static_cast<const FValueMap*>(Ptr))
+			{
+				VisitValueReferences(Pair.Value, Visitor);
+			}
+			break;
+		case EScriptHeapCategory::Set:
+			for (const FValue& Elem : *static_cast<const FValueSet*>(Ptr))
+			{
+				VisitValueReferences(Elem, Visitor);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	// 순환을 끊음 - 이후 마지막 참조가 사라지면 일반 소멸 경로로 해제
+	void FScriptCycleCollector::BreakReferences(const void* Ptr, EScriptHeapCategory Category)
+	{
+		void* Mutable = const_cast<void*>(Ptr);
+		switch (Category)
+		{
+		case EScriptHeapCategory::Environment:
+		{
+			FEnvironment* Env = static_cast<FEnvironment*>(Mutable);
+			Env->Table.Empty();
+			Env->Parent.Reset();
+			break;
+		}
+		case EScriptHeapCategory::Function:
+			static_cast<FFunctionValue*>(Mutable)->Closure.Reset();
+			break;
+		case EScriptHeapCategory::Array:
+			static_cast<TArray<FValue>*>(Mutable)->Empty();
+			break;
+		case EScriptHeapCategory::Object:
+			static_cast<TMap<FString, FValue>*>(Mutable)->Empty();
+			break;
+		case EScriptHeapCategory::Map:
+			static_cast<FValueMap*>(Mutable)->Empty();
+			break;
+		case EScriptHeapCategory::Set:
+			static_cast<FValueSet*>(Mutable)->Empty();
+			break;
+		default:
+			break;
+		}
+	}
+
+	FScriptCycleCollector::FScriptCycleCollector(FScriptHeap& InHeap)
+		: Heap(InHeap)
+	{
+	}
+
+	int32 FScriptCycleCollector::Collect()
+	{
+		if (Phase == EPhase::Idle)
+		{
+			Begin();
+		}
+
+		int32 Budget = MAX_int32;
+		Advance(Budget);
+		return Sweep();
+	}
+
+	bool FScriptCycleCollector::Step(int32 WorkBudget)
+	{
+		if (Phase == EPhase::Idle)
+		{
+			Begin();
+		}
+
+		int32 Budget = FMath::Max(1, WorkBudget);
+		if (!Advance(Budget))
+		{
+			return false;
+		}
+
+		Sweep();
+		return true;
+	}
+
+	void FScriptCycleCollector::Begin()
+	{
+		Reset();
+
+		FScopeLock Lock(&Heap.NodeLock);
+		Nodes.Reserve(Heap.NodeCount);
+		NodeIndex.Reserve(Heap.NodeCount);
+
+		for (const FScriptHeapNode* HeapNode = Heap.NodeHead; HeapNode; HeapNode = HeapNode->Next)
+		{
+			FNode& Node = Nodes.AddDefaulted_GetRef();
+			Node.Ptr = HeapNode->Object;
+			Node.Category = HeapNode->Category;
+		}
+		for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+		{
+			NodeIndex.Add(Nodes[Index].Ptr, Index);
+		}
+
+		// 이번 주기 동안 해제되는 노드를 기록해 스냅샷의 노드가 살아 있는지 확인
+		Heap.bRecordUnlinkedNodes = true;
+		Heap.UnlinkedNodes.Reset();
+
+		Phase = EPhase::Count;
+	}
+
+	bool FScriptCycleCollector::Advance(int32& Budget)
+	{
+		// 단계 사이에 다른 스레드에서 값이 해제될 수 있으므로 해제 여부를 확인하며 진행
+		FScopeLock Lock(&Heap.NodeLock);
+
+		if (Phase == EPhase::Count)
+		{
+			auto CountReference = [this, &Budget](const auto& Ref)
+			{
+				--Budget;
+				if (const int32* Target = NodeIndex.Find(Ref.Get()))
+				{
+					FNode& TargetNode = Nodes[*Target];
+					TargetNode.InternalRefs++;
+					TargetNode.SharedRefCount = Ref.GetSharedReferenceCount();
+				}
+			};
+
+			while (Cursor < Nodes.Num() && Budget > 0)
+			{
+				const FNode& Node = Nodes[Cursor++];
+				--Budget;
+				if (IsStillTracked(Node))
+				{
+					ForEachReference(Node.Ptr, Node.Category, CountReference);
+				}
+			}
+			if (Cursor < Nodes.Num())
+			{
+				return false;
+			}
+
+			// 내부 참조만으로 설명되지 않는 참조가 있으면 루트
+			for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+			{
+				FNode& Node = Nodes[Index];
+				if (Node.SharedRefCount == INDEX_NONE || Node.SharedRefCount > Node.InternalRefs)
+				{
+					Node.bMarked = true;
+					MarkStack.Add(Index);
+				}
+			}
+			Phase = EPhase::Mark;
+		}
+
+		if (Phase == EPhase::Mark)
+		{
+			auto MarkReference = [this, &Budget](const auto& Ref)
+			{
+				--Budget;
+				if (const int32* Target = NodeIndex.Find(Ref.Get()))
+				{
+					FNode& TargetNode = Nodes[*Target];
+					if (!TargetNode.bMarked)
+					{
+						TargetNode.bMarked = true;
+						MarkStack.Add(*Target);
+					}
+				}
+			};
+
+			while (MarkStack.Num() > 0 && Budget > 0)
+			{
+				const FNode& Node = Nodes[MarkStack.Pop()];
+				--Budget;
+				if (IsStillTracked(Node))
+				{
+					ForEachReference(Node.Ptr, Node.Category, MarkReference);
+				}
+			}
+			if (MarkStack.Num() > 0)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	int32 FScriptCycleCollector::Sweep()
+	{
+		FGarbagePins Pins;
+		TArray<int32> Garbage;
+		{
+			FScopeLock Lock(&Heap.NodeLock);
+
+			// 표시되지 않은 노드 중 아직 살아 있는 것만 후보
+			TArray<int32> Candidates;
+			TMap<const void*, int32> CandidateIndex;
+			for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+			{
+				if (!Nodes[Index].bMarked && IsStillTracked(Nodes[Index]))
+				{
+					CandidateIndex.Add(Nodes[Index].Ptr, Candidates.Add(Index));
+				}
+			}
+
+			// 후보끼리만 다시 시험 삭제 (이전 단계 이후 바뀐 참조를 현재 상태로 재확인)
+			TArray<int32> InternalRefs;
+			TArray<int32> SharedRefCounts;
+			InternalRefs.SetNumZeroed(Candidates.Num());
+			SharedRefCounts.Init(INDEX_NONE, Candidates.Num());
+			auto CountCandidateReference = [&CandidateIndex, &InternalRefs, &SharedRefCounts](const auto& Ref)
+			{
+				if (const int32* Target = CandidateIndex.Find(Ref.Get()))
+				{
+					InternalRefs[*Target]++;
+					SharedRefCounts[*Target] = Ref.GetSharedReferenceCount();
+				}
+			};
+			for (const int32 NodeIdx : Candidates)
+			{
+				ForEachReference(Nodes[NodeIdx].Ptr, Nodes[NodeIdx].Category, CountCandidateReference);
+			}
+
+			TArray<bool> bAlive;
+			bAlive.Init(false, Candidates.Num());
+			TArray<int32> AliveStack;
+			for (int32 Local = 0; Local < Candidates.Num(); ++Local)
+			{
+				if (SharedRefCounts[Local] == INDEX_NONE || SharedRefCounts[Local] > InternalRefs[Local])
+				{
+					bAlive[Local] = true;
+					AliveStack.Add(Local);
+				}
+			}
+
+			auto MarkCandidateAlive = [&CandidateIndex, &bAlive, &AliveStack](const auto& Ref)
+			{
+				if (const int32* Target = CandidateIndex.Find(Ref.Get()))
+				{
+					if (!bAlive[*Target])
+					{
+						bAlive[*Target] = true;
+						AliveStack.Add(*Target);
+					}
+				}
+			};
+			while (AliveStack.Num() > 0)
+			{
+				const FNode& Node = Nodes[Candidates[AliveStack.Pop()]];
+				ForEachReference(Node.Ptr, Node.Category, MarkCandidateAlive);
+			}
+
+			// 남은 후보는 서로만 참조하므로, 각 노드는 다른 수거 대상의 참조로 붙잡을 수 있음
+			auto PinReference = [&CandidateIndex, &bAlive, &Pins](const auto& Ref)
+			{
+				const int32* Target = CandidateIndex.Find(Ref.Get());
+				if (Target && !bAlive[*Target])
+				{
+					Pins.Add(Ref);
+				}
+			};
+			for (int32 Local = 0; Local < Candidates.Num(); ++Local)
+			{
+				if (!bAlive[Local])
+				{
+					const FNode& Node = Nodes[Candidates[Local]];
+					ForEachReference(Node.Ptr, Node.Category, PinReference);
+					Garbage.Add(Candidates[Local]);
+				}
+			}
+		}
+
+		// 잠금 밖에서 참조를 끊고 붙잡아 둔 참조를 놓아 실제 해제 (소멸자가 힙 등록 해제를 호출함)
+		for (const int32 NodeIdx : Garbage)
+		{
+			BreakReferences(Nodes[NodeIdx].Ptr, Nodes[NodeIdx].Category);
+		}
+		Pins = FGarbagePins();
+
+		Stats.CompletedCycles++;
+		Stats.ScannedNodes = Nodes.Num();
+		Stats.CollectedNodes = Garbage.Num();
+		Stats.TotalCollectedNodes += Garbage.Num();
+
+		Reset();
+		return Garbage.Num();
+	}
+
+	void FScriptCycleCollector::Reset()
+	{
+		Phase = EPhase::Idle;
+		Cursor = 0;
+		Nodes.Reset();
+		NodeIndex.Reset();
+		MarkStack.Reset();
+
+		FScopeLock Lock(&Heap.NodeLock);
+		Heap.bRecordUnlinkedNodes = false;
+		Heap.UnlinkedNodes.Reset();
+	}
+
+	bool FScriptCycleCollector::IsStillTracked(const FNode& Node) const
+	{
+		// 해제된 주소에 새 값이 생겨도 스냅샷 노드와 다른 값이므로 살아 있지 않은 것으로 봄
+		return !Heap.UnlinkedNodes.Contains(Node.Ptr);
+	}
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MagicScriptCore/Runtime/MsScriptHeap.h"
+
+namespace MagicScript
+{
+	/**
+	 * 스크립트 값 순환 참조 수집기
+	 * - 값은 TSharedPtr 참조 카운트로 관리되므로 spell의 Closure → 환경 → spell 같은 순환은 스스로 해제되지 않음
+	 * - 힙에 등록된 환경/컨테이너/함수 값 사이의 참조만 세어, 그 외(인터프리터 전역, 실행 중인 프레임,
+	 *   이벤트 루프 작업, 호스트가 들고 있는 값)에서 오는 참조가 있는 노드를 루트로 삼아 표시
+	 * - 표시되지 않은 노드는 해제 직전에 후보끼리만 다시 시험 삭제해서 확인한 뒤 참조를 끊어 해제
+	 *   (단계 사이에 스크립트나 호스트가 값을 바꿔도 살아 있는 값은 수거하지 않음)
+	 * - Step(WorkBudget)으로 노드/참조 방문 수 단위로 나눠서 진행 가능 (프레임 분할)
+	 * - 값을 옮기지 않으므로 수집 중에도 기존 포인터가 유효함
+	 */
+	class MAGICSCRIPTCORE_API FScriptCycleCollector
+	{
+	public:
+		struct FStats
+		{
+			int32 CompletedCycles = 0;
+			int32 ScannedNodes = 0;       // 마지막 주기에서 검사한 노드 수
+			int32 CollectedNodes = 0;     // 마지막 주기에서 수거한 노드 수
+			int64 TotalCollectedNodes = 0;
+		};
+
+		explicit FScriptCycleCollector(FScriptHeap& InHeap);
+
+		// 한 번에 전체 주기 수행, 수거한 노드 수 반환
+		int32 Collect();
+
+		// WorkBudget 만큼만 진행 (마지막 해제 단계는 수거 대상 크기에 비례해 한 번에 처리), 주기가 끝났으면 true
+		bool Step(int32 WorkBudget);
+
+		bool IsInProgress() const { return Phase != EPhase::Idle; }
+		const FStats& GetStats() const { return Stats; }
+
+	private:
+		enum class EPhase : uint8
+		{
+			Idle,
+			Count,  // 노드별 내부 참조 수 집계
+			Mark    // 외부 참조가 있는 노드에서 도달 가능한 노드 표시
+		};
+
+		struct FNode
+		{
+			const void* Ptr = nullptr;
+			EScriptHeapCategory Category = EScriptHeapCategory::Environment;
+			int32 SharedRefCount = INDEX_NONE;  // 내부 참조가 하나도 없으면 INDEX_NONE
+			int32 InternalRefs = 0;
+			bool bMarked = false;
+		};
+
+		// 힙 노드 리스트 스냅샷으로 새 주기 시작
+		void Begin();
+
+		// Budget을 소모하며 Count/Mark 진행, 표시가 끝나면 true
+		bool Advance(int32& Budget);
+
+		// 표시되지 않은 노드를 다시 확인하고 참조를 끊어 해제
+		int32 Sweep();
+
+		void Reset();
+
+		// 스냅샷 이후 노드가 해제되지 않았는지 (NodeLock을 잡은 상태에서 호출)
+		bool IsStillTracked(const FNode& Node) const;
+
+		// 노드가 직접 들고 있는 shared 참조를 하나씩 방문 (참조 하나 = 카운트 하나)
+		template <typename VisitorType>
+		static void ForEachReference(const void* Ptr, EScriptHeapCategory Category, VisitorType& Visitor);
+
+		// 노드가 들고 있는 참조를 모두 놓음
+		static void BreakReferences(const void* Ptr, EScriptHeapCategory Category);
+
+		FScriptHeap& Heap;
+		EPhase Phase = EPhase::Idle;
+		int32 Cursor = 0;
+		TArray<FNode> Nodes;
+		TMap<const void*, int32> NodeIndex;
+		TArray<int32> MarkStack;
+		FStats Stats;
+	};
+}
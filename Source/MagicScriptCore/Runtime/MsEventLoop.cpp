@@ -0,0 +1,94 @@
+#include "MagicScriptCore/Runtime/MsEventLoop.h"
+#include "MagicScriptCore/Runtime/MsInterpreter.h"
+#include "MagicScriptCore/Core/MsValue.h"
+#include "MagicScriptCore/Logging/MsTrace.h"
+
+namespace MagicScript
+{
+	FEventLoop::FEventLoop()
+	{
+	}
+
+	void FEventLoop::Tick(FInterpreter* Interpreter)
+	{
+		// 분할 실행이 멈춰 있으면 콜백 오류가 남긴 중단 상태가 그 실행까지 중단시키므로 끝날 때까지 대기
+		if (!Interpreter || Interpreter->HasPendingSlice())
+		{
+			return;
+		}
+
+		const double CurrentTime = FPlatformTime::Seconds();
+
+		// setTimeout 작업 처리
+		for (int32 i = Tasks.Num() - 1; i >= 0; --i)
+		{
+			if (CurrentTime < Tasks[i].ScheduledTime)
+			{
+				continue;
+			}
+
+			// 콜백 안에서 setTimeout으로 작업이 추가될 수 있으므로 먼저 꺼냄
+			const FAsyncTask Task = MoveTemp(Tasks[i]);
+			Tasks.RemoveAt(i);
+			if (Task.Callback.IsValid())
+			{
+				MS_TRACE_SCOPE(TEXT("Timeout"), Task.Callback->Name, Interpreter->GetScriptName());
+				Interpreter->CallFunction(Task.Callback, Task.Arguments, FScriptExecutionContext());
+			}
+		}
+	}
+
+	void FEventLoop::TickSliced(FInterpreter* Interpreter, const FScriptSliceBudget& Budget)
+	{
+		if (!Interpreter || Interpreter->HasPendingSlice())
+		{
+			return;
+		}
+
+		const double CurrentTime = FPlatformTime::Seconds();
+
+		for (int32 i = Tasks.Num() - 1; i >= 0; --i)
+		{
+			if (CurrentTime < Tasks[i].ScheduledTime)
+			{
+				continue;
+			}
+
+			// 콜백 안에서 setTimeout으로 작업이 추가될 수 있으므로 먼저 꺼냄
+			const FAsyncTask Task = MoveTemp(Tasks[i]);
+			Tasks.RemoveAt(i);
+			if (!Task.Callback.IsValid())
+			{
+				continue;
+			}
+
+			MS_TRACE_SCOPE(TEXT("Timeout"), Task.Callback->Name, Interpreter->GetScriptName());
+			if (Interpreter->BeginCallSlices(Task.Callback, Task.Arguments, FScriptExecutionContext())
+				&& Interpreter->ResumeSlice(Budget) == EScriptSliceState::Suspended)
+			{
+				// 남은 작업은 이 콜백이 끝난 뒤에 시작
+				return;
+			}
+		}
+	}
+
+	int32 FEventLoop::SetTimeout(TSharedPtr<FFunctionValue> Callback, double DelaySeconds, const TArray<FValue>& Args)
+	{
+		FAsyncTask Task;
+		Task.Type = EAsyncTaskType::SetTimeout;
+		Task.ScheduledTime = FPlatformTime::Seconds() + DelaySeconds;
+		Task.Callback = Callback;
+		Task.Arguments = Args;
+		Task.TaskId = NextTaskId++;
+
+		Tasks.Add(Task);
+		return Task.TaskId;
+	}
+
+	void FEventLoop::ClearAllTasks()
+	{
+		Tasks.Empty();
+		NextTaskId = 1;
+	}
+}
+
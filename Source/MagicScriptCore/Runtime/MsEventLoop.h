@@ -7,6 +7,7 @@ namespace MagicScript
 	class FInterpreter;
 	struct FValue;
 	struct FFunctionValue;
+	struct FScriptSliceBudget;
 
 	/** 비동기 작업 타입 */
 	enum class EAsyncTaskType : uint8
@@ -36,15 +37,22 @@ namespace MagicScript
 	 * - setTimeout 등의 비동기 작업 처리
 	 * - 언리얼의 Tick에서 호출되어야 함
 	 */
-	class FEventLoop
+	class MAGICSCRIPTCORE_API FEventLoop
 	{
 	public:
 		FEventLoop();
 		~FEventLoop() = default;
 
-		/** 이벤트 루프 업데이트 (언리얼 Tick에서 호출) */
+		/** 이벤트 루프 업데이트 (언리얼 Tick에서 호출, 분할 실행이 멈춰 있으면 끝날 때까지 대기) */
 		void Tick(FInterpreter* Interpreter);
 
+		/**
+		 * 콜백을 분할 실행으로 시작하는 업데이트
+		 * - 인터프리터에 멈춰 있는 분할 실행이 있으면 끝날 때까지 새 콜백을 시작하지 않음
+		 * - 예산 안에 끝나지 않은 콜백은 FInterpreter::ResumeSlice로 이어서 실행
+		 */
+		void TickSliced(FInterpreter* Interpreter, const FScriptSliceBudget& Budget);
+
 		/** setTimeout 등록 */
 		int32 SetTimeout(TSharedPtr<FFunctionValue> Callback, double DelaySeconds, const TArray<FValue>& Args = {});
 
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MagicScriptCore/Core/MsAst.h"
+#include "MagicScriptCore/Core/MsValue.h"
+
+namespace MagicScript
+{
+	class FEnvironment;
+
+	// 명시적 실행 스택 프레임 종류
+	enum class EFrameKind : uint8
+	{
+		Program,     // 최상위 문장 목록 (전역 return을 만나면 종료)
+		Block,       // 블록 문장 목록 (환경은 만든 쪽에서 지정)
+		Statement,
+		Expression,  // 끝나면 값 스택에 결과를 정확히 하나 올림
+		Call         // 스크립트 spell 본문 실행 (return 값을 받아 값 스택에 올림)
+	};
+
+	/**
+	 * 인터프리터 실행 스택의 프레임 하나
+	 * - C++ 재귀 대신 State로 재개 지점을 기록해 두므로 어느 프레임 경계에서든 멈췄다가 이어서 실행 가능
+	 * - AST 노드는 raw 포인터로 가리킴 (Program 또는 Call 프레임의 spell 값이 본문 AST를 붙잡고 있음)
+	 * - 중간 결과는 인터프리터의 값 스택에 쌓고, 노드별로 따로 들고 있어야 하는 값만 Temp에 둠
+	 */
+	struct FExecutionFrame
+	{
+		EFrameKind Kind = EFrameKind::Statement;
+		uint8 State = 0;         // 0이면 아직 시작 전 (실행 횟수/프로파일러 진입 처리)
+		bool bProfiled = false;  // 프로파일러에 진입했으므로 프레임을 내릴 때 빠져나와야 함
+		bool bMatched = false;   // switch: 앞선 case가 일치해 이후 case로 이어지는 중
+		bool bBackEdge = false;  // for: 첫 회차를 지나 다음 회차로 돌아오는 중 (실행 예산 확인용)
+
+		int32 Index = 0;         // 블록 문장 / 인자 / 원소 / case 순번
+		int32 SubIndex = 0;      // case 안의 문장 순번
+		int32 Iteration = 0;     // while 반복 횟수 (MAX_int32에서 멈춤)
+		int32 ValueBase = 0;     // 호출 인자 / spell 본문이 시작된 값 스택 위치
+
+		const TArray<FStatementPtr>* Statements = nullptr;  // Program/Block
+		const FStatement* Statement = nullptr;
+		const FExpression* Expression = nullptr;
+
+		TSharedPtr<FEnvironment> Env;            // 반복문은 시작할 때 루프 환경으로 교체
+		TSharedPtr<FFunctionValue> Function;     // Call: 실행 중인 spell / 호출식: 미리 찾은 함수
+		FString CalleeName;                      // 호출식: 타입명으로 바꾼 메서드 이름 (비어 있으면 원래 이름)
+		FValue Temp;                             // switch 값, 인덱스 할당 우변, 만드는 중인 배열/객체
+
+		// 슬롯을 다음 프레임에 재사용하기 위해 초기화 (붙잡고 있던 값은 놓고 문자열 버퍼는 유지)
+		void Reset()
+		{
+			State = 0;
+			bProfiled = false;
+			bMatched = false;
+			bBackEdge = false;
+			Index = 0;
+			SubIndex = 0;
+			Iteration = 0;
+			ValueBase = 0;
+			Statements = nullptr;
+			Statement = nullptr;
+			Expression = nullptr;
+			Env.Reset();
+			Function.Reset();
+			CalleeName.Reset();
+			Temp = FValue::Null();
+		}
+	};
+}
@@ -0,0 +1,2053 @@
+#include "MagicScriptCore/Runtime/MsInterpreter.h"
+#include "MagicScriptCore/Logging/MsLogging.h"
+#include "MagicScriptCore/Logging/MsLoggingEnum.h"
+#include "MagicScriptCore/Logging/MsTrace.h"
+#include "MagicScriptCore/Runtime/MsScriptHost.h"
+#include "HAL/PlatformTime.h"
+#include "Logging/LogMacros.h"
+
+namespace MagicScript
+{
+	namespace
+	{
+		// 과도한 while 루프 방지를 위한 안전 장치 (분할 실행 중이거나 실행 예산이 있으면 예산으로 끊으므로 적용하지 않음)
+		constexpr int32 MaxWhileIterations = 128;
+
+		// 분할 실행 시간 예산은 이 단계 수마다 한 번씩만 확인
+		constexpr int64 SliceClockCheckInterval = 64;
+
+		// 실행 예산의 마감 시각은 검사 지점 몇 번마다 한 번만 확인
+		constexpr int32 BudgetClockCheckInterval = 16;
+
+		bool IsTruthy(const FValue& Value)
+		{
+			return (Value.Type == EValueType::Bool) ? Value.Bool : false;
+		}
+
+		double GetNum(const FValue& Value)
+		{
+			return (Value.Type == EValueType::Number) ? Value.Number : 0.0;
+		}
+
+		FValue EvaluateLiteral(const FLiteralExpression& Lit)
+		{
+			const FToken& Tok = Lit.LiteralToken;
+			switch (Tok.Type)
+			{
+			case ETokenType::Number:
+				return FValue::FromNumber(FCString::Atod(*Tok.Lexeme));
+			case ETokenType::String:
+				return FValue::FromString(Tok.Lexeme);
+			case ETokenType::True:
+				return FValue::FromBool(true);
+			case ETokenType::False:
+				return FValue::FromBool(false);
+			default:
+				return FValue::Null();
+			}
+		}
+
+		FValue EvaluateBinary(const EBinaryOp Op, const FValue& L, const FValue& R)
+		{
+			// 한쪽이라도 문자열이면 문자열 연결 (로프 기반이라 반복 연결도 매번 전체 복사하지 않음)
+			if (Op == EBinaryOp::Add && (L.Type == EValueType::String || R.Type == EValueType::String))
+			{
+				return FValue::ConcatStrings(L, R);
+			}
+
+			switch (Op)
+			{
+			case EBinaryOp::Add:          return FValue::FromNumber(GetNum(L) + GetNum(R));
+			case EBinaryOp::Sub:          return FValue::FromNumber(GetNum(L) - GetNum(R));
+			case EBinaryOp::Mul:          return FValue::FromNumber(GetNum(L) * GetNum(R));
+			case EBinaryOp::Div:          return FValue::FromNumber(GetNum(L) / GetNum(R));
+			case EBinaryOp::Mod:          return FValue::FromNumber(FMath::Fmod(GetNum(L), GetNum(R)));
+			case EBinaryOp::Equal:        return FValue::FromBool(L.Type == R.Type && L.Number == R.Number && L.GetString() == R.GetString() && L.Bool == R.Bool);
+			case EBinaryOp::NotEqual:     return FValue::FromBool(!(L.Type == R.Type && L.Number == R.Number && L.GetString() == R.GetString() && L.Bool == R.Bool));
+			case EBinaryOp::Less:         return FValue::FromBool(GetNum(L) < GetNum(R));
+			case EBinaryOp::LessEqual:    return FValue::FromBool(GetNum(L) <= GetNum(R));
+			case EBinaryOp::Greater:      return FValue::FromBool(GetNum(L) > GetNum(R));
+			case EBinaryOp::GreaterEqual: return FValue::FromBool(GetNum(L) >= GetNum(R));
+			default:                      return FValue::Null();
+			}
+		}
+
+		// switch 값 비교 (타입과 값이 모두 같아야 함)
+		bool AreSwitchValuesEqual(const FValue& SwitchValue, const FValue& CaseValue)
+		{
+			if (SwitchValue.Type != CaseValue.Type)
+			{
+				return false;
+			}
+
+			bool bEqual = false;
+			switch (SwitchValue.Type)
+			{
+			case EValueType::Number:
+				bEqual = FMath::IsNearlyEqual(SwitchValue.Number, CaseValue.Number, 0.0001);
+				break;
+			case EValueType::String:
+				bEqual = SwitchValue.GetString() == CaseValue.GetString();
+				break;
+			case EValueType::Bool:
+				bEqual = SwitchValue.Bool == CaseValue.Bool;
+				break;
+			case EValueType::Null:
+				bEqual = true;
+				break;
+			case EValueType::Object:
+				bEqual = SwitchValue.Object == CaseValue.Object;
+			case EValueType::NativeObject:
+				bEqual = SwitchValue.NativeObjectPtr == CaseValue.NativeObjectPtr;
+				break;
+			case EValueType::Map:
+				bEqual = SwitchValue.Map == CaseValue.Map;
+				break;
+			case EValueType::Set:
+				bEqual = SwitchValue.Set == CaseValue.Set;
+				break;
+			default:
+				bEqual = false;
+				break;
+			}
+			return bEqual;
+		}
+
+		// 메서드 호출 대상이 배열/문자열/Map/Set이면 빌트인 타입명 (arr.push → Array.push)
+		const TCHAR* GetMethodTypePrefix(const EValueType Type)
+		{
+			switch (Type)
+			{
+			case EValueType::Array:  return TEXT("Array");
+			case EValueType::String: return TEXT("String");
+			case EValueType::Map:    return TEXT("Map");
+			case EValueType::Set:    return TEXT("Set");
+			default:                 return nullptr;
+			}
+		}
+
+		const FString& GetCalleeName(const FExecutionFrame& Frame, const FCallExpression& CallExpr)
+		{
+			return Frame.CalleeName.IsEmpty() ? CallExpr.CalleeName : Frame.CalleeName;
+		}
+	}
+
+	// 분할 실행 예산 측정 (단계 수 + 시간)
+	struct FInterpreter::FSliceClock
+	{
+		explicit FSliceClock(const FScriptSliceBudget& Budget)
+			: MaxInstructions(Budget.MaxInstructions)
+			, DeadlineCycles(Budget.MaxMilliseconds > 0.0
+				? FPlatformTime::Cycles64() + static_cast<uint64>(Budget.MaxMilliseconds / 1000.0 / FPlatformTime::GetSecondsPerCycle64())
+				: 0)
+		{
+		}
+
+		// 한 단계 실행 전에 호출, 예산을 다 썼으면 true (최소 한 단계는 진행)
+		bool ShouldYield()
+		{
+			if (Steps > 0)
+			{
+				if (MaxInstructions > 0 && Steps >= MaxInstructions)
+				{
+					return true;
+				}
+				if (DeadlineCycles > 0 && (Steps % SliceClockCheckInterval) == 0 && FPlatformTime::Cycles64() >= DeadlineCycles)
+				{
+					return true;
+				}
+			}
+			++Steps;
+			return false;
+		}
+
+		int32 MaxInstructions;
+		uint64 DeadlineCycles;
+		int64 Steps = 0;
+	};
+
+	FInterpreter::~FInterpreter()
+	{
+		// 멈춰 있는 분할 실행 프레임, 이벤트 루프 콜백과 전역 환경이 루트에서 빠지면
+		// spell ↔ Closure 순환만 남은 값은 수집기가 끊어야 해제됨
+		CancelSlice();
+		EventLoop.ClearAllTasks();
+		GlobalEnv.Reset();
+		CycleCollector.Collect();
+	}
+
+	void FInterpreter::ExecuteProgram(const TSharedPtr<FProgram>& Program, const FScriptExecutionContext& Context)
+	{
+		if (!Program.IsValid())
+		{
+			return;
+		}
+
+		// 멈춰 있는 분할 실행과 실행 통계/중단 상태가 섞이지 않도록 거부
+		if (SlicedRun.bActive)
+		{
+			AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Cannot execute program while a sliced execution is pending"));
+			return;
+		}
+
+		MS_TRACE_SCOPE(TEXT("Execute"), ScriptName);
+		FScriptHeap::FScope HeapScope(&Heap.Get());
+
+		// PreAnalysis 모드: 스냅샷 생성
+		TSharedPtr<FEnvironment> Snapshot = nullptr;
+		if (Context.Mode == EExecutionMode::PreAnalysis && GlobalEnv.IsValid())
+		{
+			Snapshot = GlobalEnv->Clone();
+		}
+
+		// 프로그램 실행 전 메모리 통계 초기화
+		ResetSpaceTracking();
+		bAbortExecution = false;
+
+		TGuardValue<FBudgetState> BudgetGuard(ActiveBudget, ActiveRunCount == 0 ? MakeBudgetState(Context) : ActiveBudget);
+
+		const int32 BaseDepth = FrameCount;
+		const int32 ValueBase = ValueStack.Num();
+		PushBlock(EFrameKind::Program, Program->Statements, GlobalEnv);
+		RunFrames(BaseDepth, Context, nullptr);
+		TruncateValues(ValueBase);
+
+		// PreAnalysis 모드: 스냅샷으로 복원
+		if (Context.Mode == EExecutionMode::PreAnalysis && Snapshot.IsValid())
+		{
+			GlobalEnv = Snapshot;
+		}
+	}
+
+	bool FInterpreter::RunFrames(const int32 BaseDepth, const FScriptExecutionContext& Context, FSliceClock* Clock)
+	{
+		// 네이티브 콜백으로 중첩된 실행은 끝까지 돌려야 하므로 멈출 수 있는지는 실행 루프 단위로 기록
+		TGuardValue<bool> SlicedGuard(bSlicedRunActive, Clock != nullptr);
+		TGuardValue<int32> RunGuard(ActiveRunCount, ActiveRunCount + 1);
+
+		while (FrameCount > BaseDepth)
+		{
+			// 런타임 에러: 이 루프가 맡은 프레임을 모두 내림 (바깥 루프도 같은 플래그를 보고 이어서 내림)
+			if (bAbortExecution)
+			{
+				UnwindFrames(BaseDepth);
+				bReturnPending = false;
+				PendingReturnValue = FValue::Null();
+				break;
+			}
+
+			// return: 가장 가까운 spell(전역이면 프로그램) 프레임까지 내림
+			if (bReturnPending)
+			{
+				while (FrameCount > BaseDepth
+					&& TopFrame().Kind != EFrameKind::Call
+					&& TopFrame().Kind != EFrameKind::Program)
+				{
+					PopFrame();
+				}
+				if (FrameCount <= BaseDepth)
+				{
+					bReturnPending = false;
+					PendingReturnValue = FValue::Null();
+					break;
+				}
+			}
+
+			if (Clock && Clock->ShouldYield())
+			{
+				return false;
+			}
+
+			StepFrame(Context);
+		}
+		return true;
+	}
+
+	void FInterpreter::StepFrame(const FScriptExecutionContext& Context)
+	{
+		switch (TopFrame().Kind)
+		{
+		case EFrameKind::Program:
+		case EFrameKind::Block:
+			StepBlock();
+			break;
+		case EFrameKind::Statement:
+			StepStatement();
+			break;
+		case EFrameKind::Expression:
+			StepExpression(Context);
+			break;
+		case EFrameKind::Call:
+			StepCall();
+			break;
+		}
+	}
+
+	void FInterpreter::StepBlock()
+	{
+		FExecutionFrame& Frame = TopFrame();
+
+		// 전역 레벨의 return 은 무시하고 프로그램 종료 (블록 프레임은 return 시 RunFrames에서 이미 내려감)
+		if (bReturnPending)
+		{
+			bReturnPending = false;
+			PendingReturnValue = FValue::Null();
+			PopFrame();
+			return;
+		}
+
+		if (Frame.Index >= Frame.Statements->Num())
+		{
+			PopFrame();
+			return;
+		}
+
+		const FStatementPtr& Stmt = (*Frame.Statements)[Frame.Index++];
+		PushStatement(Stmt, Frame.Env);
+	}
+
+	void FInterpreter::StepStatement()
+	{
+		FExecutionFrame& Frame = TopFrame();
+		const FStatement* Stmt = Frame.Statement;
+
+		if (Frame.State == 0)
+		{
+			ExecutionCount++;
+			if (Profiler.IsValid())
+			{
+				Profiler->EnterStatement(Stmt->Location.Line);
+				Frame.bProfiled = true;
+			}
+			Frame.State = 1;
+		}
+
+		switch (Stmt->Kind)
+		{
+		case EStatementKind::Import:
+			// import 문은 호스트 레벨(MagicScriptRunner)에서 처리하므로 여기서는 no-op
+			PopFrame();
+			return;
+
+		case EStatementKind::Block:
+			if (Frame.State == 1)
+			{
+				Frame.State = 2;
+				PushBlock(EFrameKind::Block, static_cast<const FBlockStatement*>(Stmt)->Statements, MakeShared<FEnvironment>(Frame.Env));
+				return;
+			}
+			PopFrame();
+			return;
+
+		case EStatementKind::VarDecl:
+		{
+			const FVarDeclStatement* Var = static_cast<const FVarDeclStatement*>(Stmt);
+			if (Frame.State == 1 && Var->Initializer.IsValid())
+			{
+				Frame.State = 2;
+				PushExpression(Var->Initializer, Frame.Env);
+				return;
+			}
+			const FValue InitValue = (Frame.State == 2) ? PopValue() : FValue::Null();
+			Frame.Env->Define(Var->Name, InitValue, Var->bIsConst);
+			PopFrame();
+			return;
+		}
+
+		case EStatementKind::FuncDecl:
+		{
+			const FFuncDeclStatement* FuncDecl = static_cast<const FFuncDeclStatement*>(Stmt);
+
+			TSharedPtr<FFunctionValue> FuncVal = MakeScriptFunction();
+			FuncVal->Name = FuncDecl->Name;
+			FuncVal->Parameters = FuncDecl->Parameters;
+			FuncVal->Body = FuncDecl->Body;
+			if (FuncDecl->Owner)
+			{
+				FuncVal->Program = FuncDecl->Owner->AsShared();
+			}
+			FuncVal->Closure = Frame.Env;
+
+			Frame.Env->Define(FuncDecl->Name, FValue::FromFunction(FuncVal), true);
+			PopFrame();
+			return;
+		}
+
+		case EStatementKind::If:
+		{
+			const FIfStatement* IfStmt = static_cast<const FIfStatement*>(Stmt);
+			switch (Frame.State)
+			{
+			case 1:
+				Frame.State = 2;
+				PushExpression(IfStmt->Condition, Frame.Env);
+				return;
+			case 2:
+				Frame.State = 3;
+				if (IsTruthy(PopValue()))
+				{
+					PushStatement(IfStmt->ThenBranch, Frame.Env);
+				}
+				else if (IfStmt->ElseBranch.IsValid())
+				{
+					PushStatement(IfStmt->ElseBranch, Frame.Env);
+				}
+				return;
+			default:
+				PopFrame();
+				return;
+			}
+		}
+
+		case EStatementKind::Switch:
+		{
+			const FSwitchStatement* SwitchStmt = static_cast<const FSwitchStatement*>(Stmt);
+			switch (Frame.State)
+			{
+			case 1:
+				Frame.State = 2;
+				PushExpression(SwitchStmt->Expression, Frame.Env);
+				return;
+			case 2:
+				Frame.Temp = PopValue();
+				Frame.State = 3;
+				return;
+			case 3:
+			{
+				// 다음 case 검사
+				if (!SwitchStmt->Cases.IsValidIndex(Frame.Index))
+				{
+					PopFrame();
+					return;
+				}
+
+				// default case는 앞에서 일치한 case가 없을 때만 실행하고 switch 종료
+				const FSwitchCase& Case = SwitchStmt->Cases[Frame.Index];
+				if (!Case.Value.IsValid())
+				{
+					if (Frame.bMatched)
+					{
+						PopFrame();
+						return;
+					}
+					Frame.SubIndex = 0;
+					Frame.State = 5;
+					return;
+				}
+
+				Frame.State = 4;
+				PushExpression(Case.Value, Frame.Env);
+				return;
+			}
+			case 4:
+			{
+				// case 값 비교, 앞 case가 일치했으면 이어서 실행 (fallthrough)
+				const FValue CaseValue = PopValue();
+				if (AreSwitchValuesEqual(Frame.Temp, CaseValue) || Frame.bMatched)
+				{
+					Frame.bMatched = true;
+					Frame.SubIndex = 0;
+					Frame.State = 5;
+				}
+				else
+				{
+					Frame.Index++;
+					Frame.State = 3;
+				}
+				return;
+			}
+			default:
+			{
+				// case 문장들 실행
+				const FSwitchCase& Case = SwitchStmt->Cases[Frame.Index];
+				if (Case.Statements.IsValidIndex(Frame.SubIndex))
+				{
+					PushStatement(Case.Statements[Frame.SubIndex++], Frame.Env);
+					return;
+				}
+				if (!Case.Value.IsValid())
+				{
+					PopFrame();
+					return;
+				}
+				Frame.Index++;
+				Frame.State = 3;
+				return;
+			}
+			}
+		}
+
+		case EStatementKind::While:
+		{
+			const FWhileStatement* WhileStmt = static_cast<const FWhileStatement*>(Stmt);
+			switch (Frame.State)
+			{
+			case 1:
+				// 이후 조건/본문은 루프 환경에서 실행
+				Frame.Env = MakeShared<FEnvironment>(Frame.Env);
+				Frame.State = 2;
+				return;
+			case 2:
+			{
+				// 다음 회차로 돌아올 때만 실행 예산 확인
+				if (Frame.Iteration > 0 && !CheckBudget(Stmt->Location))
+				{
+					return;
+				}
+
+				// 반복 횟수 체크 (조건 평가 전에 먼저 체크, 분할 실행 중이거나 실행 예산이 있으면 예산이 대신 끊어 줌)
+				if (!bSlicedRunActive && !ActiveBudget.BoundsExecution() && Frame.Iteration >= MaxWhileIterations)
+				{
+					FString ErrorMsg = FString::Printf(
+						TEXT("MagicScript Runtime Error: while loop exceeded maximum iterations (%d). Loop execution stopped to prevent infinite loop. "
+							 "Current iteration: %d. Please check your loop condition."),
+						MaxWhileIterations, Frame.Iteration
+					);
+					AddScriptLog(EScriptLogType::Error, ErrorMsg, Stmt->Location.Line, Stmt->Location.Column);
+					UE_LOG(LogMagicScript, Error, TEXT("%s"), *ErrorMsg);
+					SignalRuntimeError();
+					return;
+				}
+
+				// 조건이 없으면 무한 루프가 되므로 즉시 중단
+				if (!WhileStmt->Condition.IsValid())
+				{
+					PopFrame();
+					return;
+				}
+
+				Frame.State = 3;
+				PushExpression(WhileStmt->Condition, Frame.Env);
+				return;
+			}
+			case 3:
+				if (!IsTruthy(PopValue()))
+				{
+					PopFrame();
+					return;
+				}
+				Frame.State = 4;
+				PushStatement(WhileStmt->Body, Frame.Env);
+				return;
+			default:
+				// 반복 제한 없이 예산만으로 도는 긴 루프에서도 넘치지 않도록 포화
+				if (Frame.Iteration < MAX_int32)
+				{
+					++Frame.Iteration;
+				}
+				Frame.State = 2;
+				return;
+			}
+		}
+
+		case EStatementKind::For:
+		{
+			const FForStatement* ForStmt = static_cast<const FForStatement*>(Stmt);
+			switch (Frame.State)
+			{
+			case 1:
+				// init
+				Frame.Env = MakeShared<FEnvironment>(Frame.Env);
+				Frame.State = 2;
+				PushStatement(ForStmt->Init, Frame.Env);
+				return;
+			case 2:
+				// 다음 회차로 돌아올 때만 실행 예산 확인 (for는 반복 횟수 제한이 없으므로 예산이 유일한 제한)
+				if (Frame.bBackEdge && !CheckBudget(Stmt->Location))
+				{
+					return;
+				}
+				Frame.bBackEdge = true;
+
+				// condition (없으면 true)
+				if (ForStmt->Condition.IsValid())
+				{
+					Frame.State = 3;
+					PushExpression(ForStmt->Condition, Frame.Env);
+					return;
+				}
+				Frame.State = 4;
+				return;
+			case 3:
+				if (!IsTruthy(PopValue()))
+				{
+					PopFrame();
+					return;
+				}
+				Frame.State = 4;
+				return;
+			case 4:
+				// body
+				Frame.State = 5;
+				PushStatement(ForStmt->Body, Frame.Env);
+				return;
+			case 5:
+				// increment
+				if (ForStmt->Increment.IsValid())
+				{
+					Frame.State = 6;
+					PushExpression(ForStmt->Increment, Frame.Env);
+					return;
+				}
+				Frame.State = 2;
+				return;
+			default:
+				PopValue();
+				Frame.State = 2;
+				return;
+			}
+		}
+
+		case EStatementKind::Return:
+		{
+			const FReturnStatement* RetStmt = static_cast<const FReturnStatement*>(Stmt);
+			if (Frame.State == 1 && RetStmt->Value.IsValid())
+			{
+				Frame.State = 2;
+				PushExpression(RetStmt->Value, Frame.Env);
+				return;
+			}
+
+			// 다음 루프에서 가장 가까운 spell 프레임까지 내려가며 값을 전달
+			PendingReturnValue = (Frame.State == 2) ? PopValue() : FValue::Null();
+			bReturnPending = true;
+			return;
+		}
+
+		case EStatementKind::Expr:
+		{
+			const FExpressionStatement* ExprStmt = static_cast<const FExpressionStatement*>(Stmt);
+			if (Frame.State == 1)
+			{
+				Frame.State = 2;
+				PushExpression(ExprStmt->Expr, Frame.Env);
+				return;
+			}
+			PopValue();
+			PopFrame();
+			return;
+		}
+
+		default:
+			PopFrame();
+			return;
+		}
+	}
+
+	void FInterpreter::StepExpression(const FScriptExecutionContext& Context)
+	{
+		FExecutionFrame& Frame = TopFrame();
+		const FExpression* Expr = Frame.Expression;
+
+		if (Frame.State == 0)
+		{
+			ExpressionEvaluationCount++;
+			Frame.State = 1;
+		}
+
+		switch (Expr->Kind)
+		{
+		case EExpressionKind::Binary:
+		{
+			const FBinaryExpression* Bin = static_cast<const FBinaryExpression*>(Expr);
+			switch (Frame.State)
+			{
+			case 1:
+				Frame.State = 2;
+				PushExpression(Bin->Left, Frame.Env);
+				return;
+			case 2:
+				// 단락 평가
+				if (Bin->Op == EBinaryOp::And || Bin->Op == EBinaryOp::Or)
+				{
+					const bool LB = IsTruthy(PopValue());
+					if (Bin->Op == EBinaryOp::And ? !LB : LB)
+					{
+						FinishExpression(FValue::FromBool(LB));
+						return;
+					}
+					Frame.State = 4;
+				}
+				else
+				{
+					// 왼쪽 값은 값 스택에 남겨 둠
+					Frame.State = 3;
+				}
+				PushExpression(Bin->Right, Frame.Env);
+				return;
+			case 3:
+			{
+				const FValue R = PopValue();
+				const FValue L = PopValue();
+				FinishExpression(EvaluateBinary(Bin->Op, L, R));
+				return;
+			}
+			default:
+				FinishExpression(FValue::FromBool(IsTruthy(PopValue())));
+				return;
+			}
+		}
+
+		case EExpressionKind::Unary:
+		{
+			// 전위 증감은 TryEvaluateImmediate에서 처리
+			const FUnaryExpression* Un = static_cast<const FUnaryExpression*>(Expr);
+			if (Frame.State == 1)
+			{
+				Frame.State = 2;
+				PushExpression(Un->Operand, Frame.Env);
+				return;
+			}
+
+			const FValue V = PopValue();
+			if (Un->Op == EUnaryOp::Negate)
+			{
+				FinishExpression(FValue::FromNumber(V.Type == EValueType::Number ? -V.Number : 0.0));
+				return;
+			}
+			FinishExpression(FValue::FromBool(!IsTruthy(V)));
+			return;
+		}
+
+		case EExpressionKind::Assignment:
+		{
+			const FAssignmentExpression* Asg = static_cast<const FAssignmentExpression*>(Expr);
+			switch (Frame.State)
+			{
+			case 1:
+				Frame.State = 2;
+				PushExpression(Asg->Value, Frame.Env);
+				return;
+			case 2:
+			{
+				FValue RightValue = PopValue();
+
+				// 배열/객체 인덱싱 할당: 대상 변수를 먼저 확인한 뒤 인덱스 평가
+				if (Asg->MemberName.IsEmpty() && Asg->Index.IsValid())
+				{
+					if (!Frame.Env->Lookup(Asg->TargetName))
+					{
+						AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Undefined variable '%s'"), *Asg->TargetName));
+						SignalRuntimeError();
+						FinishExpression(FValue::Null());
+						return;
+					}
+					Frame.Temp = MoveTemp(RightValue);
+					Frame.State = 3;
+					PushExpression(Asg->Index, Frame.Env);
+					return;
+				}
+
+				FinishExpression(AssignValue(*Asg, Frame.Env, RightValue));
+				return;
+			}
+			default:
+			{
+				const FValue IndexValue = PopValue();
+				FinishExpression(AssignIndexed(*Asg, Frame.Env, IndexValue, Frame.Temp));
+				return;
+			}
+			}
+		}
+
+		case EExpressionKind::Call:
+		{
+			// 멤버 메서드 호출인지 확인 (arr.push_back(value) 또는 console.log(value))
+			const FCallExpression* CallExpr = static_cast<const FCallExpression*>(Expr);
+			switch (Frame.State)
+			{
+			case 1:
+			{
+				Frame.ValueBase = ValueStack.Num();
+
+				// 먼저 원래 CalleeName으로 함수를 찾아봄 (console.log 같은 경우)
+				FEnvironment::FEntry* Entry = Frame.Env->Lookup(CallExpr->CalleeName);
+				if (Entry && Entry->Value.Type == EValueType::Function)
+				{
+					Frame.Function = Entry->Value.Function;
+				}
+				// 함수를 찾지 못했고 ThisValue가 있는 경우, 배열 메서드일 수 있으므로 ThisValue를 평가하여 타입 확인
+				else if (CallExpr->ThisValue.IsValid())
+				{
+					Frame.State = 2;
+					PushExpression(CallExpr->ThisValue, Frame.Env);
+					return;
+				}
+				Frame.State = 3;
+				return;
+			}
+			case 2:
+			{
+				// 배열/문자열/Map/Set인 경우 타입명.memberName으로 변환하고 대상 값을 첫 번째 인자로 남김
+				if (const TCHAR* TypePrefix = GetMethodTypePrefix(ValueStack.Last().Type))
+				{
+					int32 DotIndex;
+					if (CallExpr->CalleeName.FindChar(TEXT('.'), DotIndex))
+					{
+						Frame.CalleeName = FString::Printf(TEXT("%s.%s"), TypePrefix, *CallExpr->CalleeName.Mid(DotIndex + 1));
+					}
+
+					FEnvironment::FEntry* Entry = Frame.Env->Lookup(GetCalleeName(Frame, *CallExpr));
+					if (Entry && Entry->Value.Type == EValueType::Function)
+					{
+						Frame.Function = Entry->Value.Function;
+					}
+				}
+				else
+				{
+					// 컬렉션이 아닌 경우, ThisValue를 인자로 추가하지 않음
+					PopValue();
+				}
+				Frame.State = 3;
+				return;
+			}
+			default:
+			{
+				// 나머지 인자들 평가
+				if (CallExpr->Arguments.IsValidIndex(Frame.Index))
+				{
+					PushExpression(CallExpr->Arguments[Frame.Index++], Frame.Env);
+					return;
+				}
+
+				// 인자는 값 스택에 둔 채로 넘김 (스크립트 spell은 매개변수로 바로 옮기므로 인자 배열을 만들지 않음)
+				const int32 ArgBase = Frame.ValueBase;
+
+				// 최종 함수 찾기 (위에서 찾지 못한 경우)
+				TSharedPtr<FFunctionValue> Function = MoveTemp(Frame.Function);
+				if (!Function.IsValid())
+				{
+					Function = ResolveCallee(GetCalleeName(Frame, *CallExpr), Frame.Env);
+					if (!Function.IsValid())
+					{
+						TruncateValues(ArgBase);
+						FinishExpression(FValue::Null());
+						return;
+					}
+				}
+
+				if (!CheckBudget(CallExpr->Location))
+				{
+					TruncateValues(ArgBase);
+					FinishExpression(FValue::Null());
+					return;
+				}
+
+				// 호출식 프레임은 여기서 끝나고, 호출 결과가 그대로 이 식의 값이 됨
+				CurrentCallLocation = CallExpr->Location;
+				PopFrame();
+				BeginCall(Function, ArgBase, Context);
+				return;
+			}
+			}
+		}
+
+		case EExpressionKind::MemberAccess:
+		{
+			// 객체 멤버 접근: obj.property
+			const FMemberAccessExpression* MemberAccess = static_cast<const FMemberAccessExpression*>(Expr);
+			if (Frame.State == 1)
+			{
+				Frame.State = 2;
+				PushExpression(MemberAccess->Target, Frame.Env);
+				return;
+			}
+			const FValue TargetValue = PopValue();
+			FinishExpression(EvaluateMemberAccess(*MemberAccess, TargetValue));
+			return;
+		}
+
+		case EExpressionKind::Grouping:
+		{
+			// 괄호는 안쪽 식으로 프레임을 바꿔 끼움
+			TSharedPtr<FEnvironment> Env = MoveTemp(Frame.Env);
+			const FExpressionPtr& Inner = static_cast<const FGroupingExpression*>(Expr)->Inner;
+			PopFrame();
+			PushExpression(Inner, MoveTemp(Env));
+			return;
+		}
+
+		case EExpressionKind::ArrayLiteral:
+		{
+			const FArrayLiteralExpression* ArrayLit = static_cast<const FArrayLiteralExpression*>(Expr);
+			if (Frame.State == 1)
+			{
+				Frame.Temp = FValue::FromArray(MakeScriptArray());
+				Frame.State = 2;
+			}
+			else
+			{
+				// 직전에 평가한 원소 추가
+				FValue ElemValue = PopValue();
+				const int64 PayloadDelta = GetValuePayloadBytes(ElemValue);
+				Frame.Temp.Array->Add(MoveTemp(ElemValue));
+				NotifyContainerChanged(Frame.Temp.Array, PayloadDelta);
+			}
+
+			if (ArrayLit->Elements.IsValidIndex(Frame.Index))
+			{
+				PushExpression(ArrayLit->Elements[Frame.Index++], Frame.Env);
+				return;
+			}
+			FinishExpression(MoveTemp(Frame.Temp));
+			return;
+		}
+
+		case EExpressionKind::ObjectLiteral:
+		{
+			const FObjectLiteralExpression* ObjectLit = static_cast<const FObjectLiteralExpression*>(Expr);
+			if (Frame.State == 1)
+			{
+				Frame.Temp = FValue::FromObject(MakeScriptObject());
+				Frame.State = 2;
+			}
+			else
+			{
+				// 직전에 평가한 속성 추가
+				const FObjectProperty& Prop = ObjectLit->Properties[Frame.Index - 1];
+				const FValue PropValue = PopValue();
+				const int64 PayloadDelta = GetAssignPayloadDelta(*Frame.Temp.Object, Prop.Key, PropValue);
+				Frame.Temp.Object->Add(Prop.Key, PropValue);
+				NotifyContainerChanged(Frame.Temp.Object, PayloadDelta);
+			}
+
+			if (ObjectLit->Properties.IsValidIndex(Frame.Index))
+			{
+				PushExpression(ObjectLit->Properties[Frame.Index++].Value, Frame.Env);
+				return;
+			}
+			FinishExpression(MoveTemp(Frame.Temp));
+			return;
+		}
+
+		case EExpressionKind::Index:
+		{
+			const FIndexExpression* IndexExpr = static_cast<const FIndexExpression*>(Expr);
+			switch (Frame.State)
+			{
+			case 1:
+				Frame.State = 2;
+				PushExpression(IndexExpr->Target, Frame.Env);
+				return;
+			case 2:
+				Frame.State = 3;
+				PushExpression(IndexExpr->Index, Frame.Env);
+				return;
+			default:
+			{
+				const FValue IndexValue = PopValue();
+				const FValue TargetValue = PopValue();
+				FinishExpression(EvaluateIndex(TargetValue, IndexValue));
+				return;
+			}
+			}
+		}
+
+		default:
+			FinishExpression(FValue::Null());
+			return;
+		}
+	}
+
+	void FInterpreter::StepCall()
+	{
+		// 본문 블록이 끝났거나 return으로 되돌아온 경우
+		FExecutionFrame& Frame = TopFrame();
+
+		FValue RetValue = FValue::Null();
+		if (bReturnPending)
+		{
+			RetValue = MoveTemp(PendingReturnValue);
+			PendingReturnValue = FValue::Null();
+			bReturnPending = false;
+		}
+
+		TruncateValues(Frame.ValueBase);
+		PopFrame();
+		ValueStack.Add(MoveTemp(RetValue));
+	}
+
+	FExecutionFrame& FInterpreter::PushFrame(const EFrameKind Kind, TSharedPtr<FEnvironment> Env)
+	{
+		// 이전 호출에서 쓰던 슬롯이 남아 있으면 그대로 재사용
+		if (FrameCount == Frames.Num())
+		{
+			Frames.AddDefaulted();
+		}
+
+		FExecutionFrame& Frame = Frames[FrameCount++];
+		Frame.Kind = Kind;
+		Frame.Env = MoveTemp(Env);
+		return Frame;
+	}
+
+	void FInterpreter::PushBlock(const EFrameKind Kind, const TArray<FStatementPtr>& Statements, TSharedPtr<FEnvironment> Env)
+	{
+		FExecutionFrame& Frame = PushFrame(Kind, MoveTemp(Env));
+		Frame.Statements = &Statements;
+	}
+
+	void FInterpreter::PushStatement(const FStatementPtr& Stmt, TSharedPtr<FEnvironment> Env)
+	{
+		if (!Stmt.IsValid())
+		{
+			return;
+		}
+
+		FExecutionFrame& Frame = PushFrame(EFrameKind::Statement, MoveTemp(Env));
+		Frame.Statement = Stmt.Get();
+	}
+
+	void FInterpreter::PushExpression(const FExpressionPtr& Expr, TSharedPtr<FEnvironment> Env)
+	{
+		if (!Expr.IsValid())
+		{
+			ValueStack.Add(FValue::Null());
+			return;
+		}
+
+		FValue Immediate;
+		if (TryEvaluateImmediate(*Expr, Env, Immediate))
+		{
+			ExpressionEvaluationCount++;
+			ValueStack.Add(MoveTemp(Immediate));
+			return;
+		}
+
+		FExecutionFrame& Frame = PushFrame(EFrameKind::Expression, MoveTemp(Env));
+		Frame.Expression = Expr.Get();
+	}
+
+	void FInterpreter::PopFrame()
+	{
+		FExecutionFrame& Frame = TopFrame();
+		if (Frame.Kind == EFrameKind::Call)
+		{
+			if (Frame.bProfiled && Profiler.IsValid())
+			{
+				Profiler->ExitFunction();
+			}
+			if (Frame.Function->SpaceCostBytes > 0)
+			{
+				AddSpaceBytes(-Frame.Function->SpaceCostBytes);
+			}
+			CallStackDepth--;
+		}
+		else if (Frame.bProfiled && Profiler.IsValid())
+		{
+			Profiler->ExitStatement();
+		}
+
+		// 슬롯은 남겨 두고 참조만 놓음 (환경/값을 바로 해제해야 수명이 재귀 방식과 같음)
+		Frame.Reset();
+		--FrameCount;
+	}
+
+	void FInterpreter::UnwindFrames(const int32 BaseDepth)
+	{
+		while (FrameCount > BaseDepth)
+		{
+			PopFrame();
+		}
+	}
+
+	void FInterpreter::FinishExpression(FValue Value)
+	{
+		PopFrame();
+		ValueStack.Add(MoveTemp(Value));
+	}
+
+	FValue FInterpreter::PopValue()
+	{
+		return ValueStack.Pop(EAllowShrinking::No);
+	}
+
+	void FInterpreter::TruncateValues(const int32 NewNum)
+	{
+		ValueStack.SetNum(NewNum, EAllowShrinking::No);
+	}
+
+	void FInterpreter::BeginCall(const TSharedPtr<FFunctionValue>& FuncValue, const int32 ArgBase, const FScriptExecutionContext& Context)
+	{
+		if (!FuncValue.IsValid())
+		{
+			AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Invalid function value"));
+			TruncateValues(ArgBase);
+			ValueStack.Add(FValue::Null());
+			return;
+		}
+
+		// 호출 스택 깊이 체크 (무한 재귀 방지)
+		if (CallStackDepth >= MaxCallDepth)
+		{
+			FString ErrorMsg = FString::Printf(
+				TEXT("MagicScript Runtime Error: Call stack overflow! Maximum call stack depth (%d) exceeded in function '%s'. "
+				     "Current depth: %d. This usually indicates infinite recursion. Please check your function calls."),
+				MaxCallDepth, *FuncValue->Name, CallStackDepth
+			);
+			AddScriptLog(EScriptLogType::Error, ErrorMsg);
+			UE_LOG(LogMagicScript, Error, TEXT("%s"), *ErrorMsg);
+			SignalRuntimeError();
+			TruncateValues(ArgBase);
+			ValueStack.Add(FValue::Null());
+			return;
+		}
+
+		CallStackDepth++;
+
+		// 네이티브 함수가 선언한 호출 중 임시 메모리를 추가 (반환 시 차감)
+		if (FuncValue->SpaceCostBytes > 0)
+		{
+			AddSpaceBytes(FuncValue->SpaceCostBytes);
+		}
+
+		FunctionCallCount++;
+
+		// 네이티브 함수라면 NativeImpl 호출 (스크립트 콜백을 부르면 그 안에서 실행 루프가 중첩됨)
+		if (FuncValue->bIsNative && FuncValue->NativeImpl)
+		{
+			// 인자 배열은 중첩 깊이별로 재사용 (콜백이 다시 네이티브를 부르면 다음 배열을 씀)
+			if (NativeArgumentDepth == NativeArgumentPool.Num())
+			{
+				NativeArgumentPool.Add(MakeUnique<TArray<FValue>>());
+			}
+			TArray<FValue>& Args = *NativeArgumentPool[NativeArgumentDepth++];
+			for (int32 ArgIndex = ArgBase; ArgIndex < ValueStack.Num(); ++ArgIndex)
+			{
+				Args.Add(MoveTemp(ValueStack[ArgIndex]));
+			}
+			TruncateValues(ArgBase);
+
+			FValue Ret;
+			{
+				FScriptProfiler::FFunctionScope ProfileScope(Profiler.Get(), FuncValue->Name,
+					FuncValue->Body.IsValid() ? FuncValue->Body->Location.Line : 0);
+				Ret = FuncValue->NativeImpl(Args, Context);
+			}
+			Args.Reset();
+			--NativeArgumentDepth;
+
+			if (FuncValue->SpaceCostBytes > 0)
+			{
+				AddSpaceBytes(-FuncValue->SpaceCostBytes);
+			}
+
+			CallStackDepth--;
+			ValueStack.Add(MoveTemp(Ret));
+			return;
+		}
+
+		// 본문은 블록 문장이어야 함
+		if (!FuncValue->Body.IsValid() || FuncValue->Body->Kind != EStatementKind::Block)
+		{
+			FString ErrorMsg = FuncValue->Body.IsValid()
+				? FString::Printf(TEXT("MagicScript Runtime Error: Function '%s' body is not a block statement. This is an internal error - function body must be a block."), *FuncValue->Name)
+				: FString::Printf(TEXT("MagicScript Runtime Error: Function '%s' has no body"), *FuncValue->Name);
+			AddScriptLog(EScriptLogType::Error, ErrorMsg);
+			if (FuncValue->SpaceCostBytes > 0)
+			{
+				AddSpaceBytes(-FuncValue->SpaceCostBytes);
+			}
+			CallStackDepth--;
+			if (FuncValue->Body.IsValid())
+			{
+				UE_LOG(LogMagicScript, Error, TEXT("%s"), *ErrorMsg);
+				SignalRuntimeError();
+			}
+			TruncateValues(ArgBase);
+			ValueStack.Add(FValue::Null());
+			return;
+		}
+
+		TSharedPtr<FEnvironment> FuncEnv = MakeShared<FEnvironment>(FuncValue->Closure);
+
+		const int32 ParamCount = FuncValue->Parameters.Num();
+		const int32 ArgCount = ValueStack.Num() - ArgBase;
+		for (int32 Index = 0; Index < ParamCount; ++Index)
+		{
+			const FString& ParamName = FuncValue->Parameters[Index];
+			FValue ArgValue = (Index < ArgCount) ? MoveTemp(ValueStack[ArgBase + Index]) : FValue::Null();
+			FuncEnv->Define(ParamName, ArgValue, false);
+		}
+		TruncateValues(ArgBase);
+
+		// Call 프레임은 본문 블록이 끝나거나 return이 도착하면 반환값을 값 스택에 올림
+		FExecutionFrame& CallFrame = PushFrame(EFrameKind::Call, FuncEnv);
+		CallFrame.Function = FuncValue;
+		CallFrame.ValueBase = ValueStack.Num();
+		if (Profiler.IsValid())
+		{
+			Profiler->EnterFunction(FuncValue->Name, FuncValue->Body->Location.Line);
+			CallFrame.bProfiled = true;
+		}
+
+		PushBlock(EFrameKind::Block, static_cast<const FBlockStatement*>(FuncValue->Body.Get())->Statements, MoveTemp(FuncEnv));
+	}
+
+	bool FInterpreter::TryEvaluateImmediate(const FExpression& Expr, const TSharedPtr<FEnvironment>& Env, FValue& OutValue)
+	{
+		switch (Expr.Kind)
+		{
+		case EExpressionKind::Literal:
+			OutValue = EvaluateLiteral(static_cast<const FLiteralExpression&>(Expr));
+			return true;
+
+		case EExpressionKind::Identifier:
+		{
+			const FIdentifierExpression& Ident = static_cast<const FIdentifierExpression&>(Expr);
+			if (FEnvironment::FEntry* Entry = Env->Lookup(Ident.Name))
+			{
+				OutValue = Entry->Value;
+				return true;
+			}
+			// 정의되지 않은 변수는 런타임 에러로 처리하고 실행 중단
+			AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Undefined identifier '%s'"), *Ident.Name));
+			SignalRuntimeError();
+			return true;
+		}
+
+		case EExpressionKind::Unary:
+		{
+			const FUnaryExpression& Un = static_cast<const FUnaryExpression&>(Expr);
+			if (Un.Op != EUnaryOp::PreIncrement && Un.Op != EUnaryOp::PreDecrement)
+			{
+				return false;
+			}
+
+			// 전위 증가/감소: ++x 또는 --x
+			// 먼저 증가/감소하고 그 값을 반환
+			if (Un.Operand->Kind != EExpressionKind::Identifier)
+			{
+				AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Pre-increment/decrement can only be applied to identifiers"));
+				SignalRuntimeError();
+				return true;
+			}
+
+			const FIdentifierExpression& Ident = static_cast<const FIdentifierExpression&>(*Un.Operand);
+			FEnvironment::FEntry* Entry = Env->Lookup(Ident.Name);
+			if (!Entry)
+			{
+				AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Undefined variable '%s'"), *Ident.Name));
+				SignalRuntimeError();
+				return true;
+			}
+
+			if (Entry->Value.Type != EValueType::Number)
+			{
+				AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Pre-increment/decrement can only be applied to numbers")));
+				SignalRuntimeError();
+				return true;
+			}
+
+			const double NewValue = (Un.Op == EUnaryOp::PreIncrement)
+				? Entry->Value.Number + 1.0
+				: Entry->Value.Number - 1.0;
+
+			OutValue = FValue::FromNumber(NewValue);
+			Env->Assign(Ident.Name, OutValue);
+			return true;
+		}
+
+		case EExpressionKind::ArrowFunction:
+		{
+			const FArrowFunctionExpression& ArrowFunc = static_cast<const FArrowFunctionExpression&>(Expr);
+
+			// Arrow 함수를 FFunctionValue로 변환
+			TSharedPtr<FFunctionValue> FuncVal = MakeScriptFunction();
+			FuncVal->Name = TEXT("<anonymous>");
+			FuncVal->Parameters = ArrowFunc.Parameters;
+			FuncVal->Closure = Env;
+			FuncVal->bIsNative = false;
+			if (ArrowFunc.Owner)
+			{
+				FuncVal->Program = ArrowFunc.Owner->AsShared();
+			}
+
+			// 블록: (x) => { return x + 1; }
+			// 단일 표현식 (x) => x + 1 도 파서가 return 블록으로 감싸 둠
+			if (ArrowFunc.BodyBlock.IsValid())
+			{
+				FuncVal->Body = ArrowFunc.BodyBlock;
+			}
+			else
+			{
+				FString ErrorMsg = TEXT("MagicScript Runtime Error: Arrow function has no body (neither expression nor block)");
+				AddScriptLog(EScriptLogType::Error, ErrorMsg);
+				UE_LOG(LogMagicScript, Error, TEXT("%s"), *ErrorMsg);
+				SignalRuntimeError();
+				return true;
+			}
+
+			OutValue = FValue::FromFunction(FuncVal);
+			return true;
+		}
+
+		case EExpressionKind::PostfixIncrement:
+		case EExpressionKind::PostfixDecrement:
+		{
+			// 후위 증가/감소: x++ 또는 x--
+			// 먼저 현재 값을 반환하고 나중에 증가/감소
+			const FPostfixExpression& Postfix = static_cast<const FPostfixExpression&>(Expr);
+
+			if (Postfix.Operand->Kind != EExpressionKind::Identifier)
+			{
+				AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Post-increment/decrement can only be applied to identifiers"));
+				SignalRuntimeError();
+				return true;
+			}
+
+			const FIdentifierExpression& Ident = static_cast<const FIdentifierExpression&>(*Postfix.Operand);
+			FEnvironment::FEntry* Entry = Env->Lookup(Ident.Name);
+			if (!Entry)
+			{
+				AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Undefined variable '%s'"), *Ident.Name));
+				SignalRuntimeError();
+				return true;
+			}
+
+			if (Entry->Value.Type != EValueType::Number)
+			{
+				AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Post-increment/decrement can only be applied to numbers")));
+				SignalRuntimeError();
+				return true;
+			}
+
+			// 현재 값을 반환하고 증가/감소 수행
+			OutValue = Entry->Value;
+			const double NewValue = Postfix.bIsIncrement
+				? Entry->Value.Number + 1.0
+				: Entry->Value.Number - 1.0;
+			Env->Assign(Ident.Name, FValue::FromNumber(NewValue));
+			return true;
+		}
+
+		default:
+			return false;
+		}
+	}
+
+	FValue FInterpreter::AssignValue(const FAssignmentExpression& Asg, const TSharedPtr<FEnvironment>& Env, const FValue& RightValue)
+	{
+		// 객체 멤버 할당 처리: obj.property = value
+		if (!Asg.MemberName.IsEmpty())
+		{
+			FEnvironment::FEntry* Entry = Env->Lookup(Asg.TargetName);
+			if (!Entry)
+			{
+				AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Undefined variable '%s'"), *Asg.TargetName));
+				SignalRuntimeError();
+				return FValue::Null();
+			}
+
+			if (Entry->Value.Type != EValueType::Object || !Entry->Value.Object.IsValid())
+			{
+				AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Cannot assign to member of non-object variable '%s'"), *Asg.TargetName));
+				SignalRuntimeError();
+				return FValue::Null();
+			}
+
+			const int64 PayloadDelta = GetAssignPayloadDelta(*Entry->Value.Object, Asg.MemberName, RightValue);
+			Entry->Value.Object->Add(Asg.MemberName, RightValue);
+			NotifyContainerChanged(Entry->Value.Object, PayloadDelta);
+			return RightValue;
+		}
+
+		// 복합 할당 연산자의 경우 현재 변수 값을 가져와서 연산 수행
+		if (Asg.Op != EAssignmentOp::Assign)
+		{
+			FEnvironment::FEntry* Entry = Env->Lookup(Asg.TargetName);
+			if (!Entry)
+			{
+				AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Undefined variable '%s'"), *Asg.TargetName));
+				SignalRuntimeError();
+				return FValue::Null();
+			}
+
+			const FValue LeftValue = Entry->Value;
+			FValue Result;
+
+			// 숫자 연산만 지원 (현재)
+			switch (Asg.Op)
+			{
+			case EAssignmentOp::AddAssign:
+				// 문자열 += 는 로프 연결
+				if (LeftValue.Type == EValueType::String || RightValue.Type == EValueType::String)
+				{
+					Result = FValue::ConcatStrings(LeftValue, RightValue);
+					break;
+				}
+				Result = FValue::FromNumber(GetNum(LeftValue) + GetNum(RightValue));
+				break;
+			case EAssignmentOp::SubAssign:
+				Result = FValue::FromNumber(GetNum(LeftValue) - GetNum(RightValue));
+				break;
+			case EAssignmentOp::MulAssign:
+				Result = FValue::FromNumber(GetNum(LeftValue) * GetNum(RightValue));
+				break;
+			case EAssignmentOp::DivAssign:
+				{
+					const double RightNum = GetNum(RightValue);
+					if (FMath::IsNearlyZero(RightNum))
+					{
+						AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Division by zero"));
+						SignalRuntimeError();
+						return FValue::Null();
+					}
+					Result = FValue::FromNumber(GetNum(LeftValue) / RightNum);
+				}
+				break;
+			case EAssignmentOp::ModAssign:
+				Result = FValue::FromNumber(FMath::Fmod(GetNum(LeftValue), GetNum(RightValue)));
+				break;
+			default:
+				Result = RightValue;
+				break;
+			}
+
+			Env->Assign(Asg.TargetName, Result);
+			return Result;
+		}
+
+		// 일반 할당
+		Env->Assign(Asg.TargetName, RightValue);
+		return RightValue;
+	}
+
+	FValue FInterpreter::AssignIndexed(const FAssignmentExpression& Asg, const TSharedPtr<FEnvironment>& Env, const FValue& IndexValue, const FValue& RightValue)
+	{
+		FEnvironment::FEntry* Entry = Env->Lookup(Asg.TargetName);
+		if (!Entry)
+		{
+			AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Undefined variable '%s'"), *Asg.TargetName));
+			SignalRuntimeError();
+			return FValue::Null();
+		}
+
+		// 배열 인덱싱 할당
+		if (Entry->Value.Type == EValueType::Array && Entry->Value.Array.IsValid())
+		{
+			if (IndexValue.Type != EValueType::Number)
+			{
+				AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Array index must be a number"));
+				SignalRuntimeError();
+				return FValue::Null();
+			}
+
+			const int32 Index = static_cast<int32>(IndexValue.Number);
+			if (Index < 0 || Index >= Entry->Value.Array->Num())
+			{
+				AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Array index out of bounds (index: %d, size: %d)"), Index, Entry->Value.Array->Num()));
+				SignalRuntimeError();
+				return FValue::Null();
+			}
+
+			const int64 PayloadDelta = GetValuePayloadBytes(RightValue) - GetValuePayloadBytes((*Entry->Value.Array)[Index]);
+			Entry->Value.Array->operator[](Index) = RightValue;
+			NotifyContainerChanged(Entry->Value.Array, PayloadDelta);
+			return RightValue;
+		}
+
+		// 객체 인덱싱 할당 (문자열 키로 접근)
+		if (Entry->Value.Type == EValueType::Object && Entry->Value.Object.IsValid())
+		{
+			if (IndexValue.Type != EValueType::String)
+			{
+				AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Object index must be a string"));
+				SignalRuntimeError();
+				return FValue::Null();
+			}
+
+			const FString Key = IndexValue.GetString();
+			const int64 PayloadDelta = GetAssignPayloadDelta(*Entry->Value.Object, Key, RightValue);
+			Entry->Value.Object->Add(Key, RightValue);
+			NotifyContainerChanged(Entry->Value.Object, PayloadDelta);
+			return RightValue;
+		}
+
+		// Map 인덱싱 할당 (원시 값 키)
+		if (Entry->Value.Type == EValueType::Map && Entry->Value.Map.IsValid())
+		{
+			if (!IndexValue.IsHashableKey())
+			{
+				AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Map key must be a number, string or bool"));
+				SignalRuntimeError();
+				return FValue::Null();
+			}
+
+			const int64 PayloadDelta = GetAssignPayloadDelta(*Entry->Value.Map, IndexValue, RightValue);
+			Entry->Value.Map->Add(IndexValue, RightValue);
+			NotifyContainerChanged(Entry->Value.Map, PayloadDelta);
+			return RightValue;
+		}
+
+		AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Cannot index non-array and non-object variable '%s'"), *Asg.TargetName));
+		SignalRuntimeError();
+		return FValue::Null();
+	}
+
+	FValue FInterpreter::EvaluateMemberAccess(const FMemberAccessExpression& MemberAccess, const FValue& TargetValue)
+	{
+		// 객체인 경우 속성 접근
+		if (TargetValue.Type == EValueType::Object && TargetValue.Object.IsValid())
+		{
+			if (const FValue* PropValue = TargetValue.Object->Find(MemberAccess.MemberName))
+			{
+				return *PropValue;
+			}
+			// 속성이 없으면 null 반환 (또는 에러)
+			AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Property '%s' not found in object"), *MemberAccess.MemberName));
+			SignalRuntimeError();
+			return FValue::Null();
+		}
+
+		// 배열이나 다른 타입의 경우 기존 로직 유지 (함수 호출과 함께 사용)
+		// 여기서는 단순 멤버 접근만 처리하므로 에러 반환
+		AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Member access without function call or invalid target type"));
+		SignalRuntimeError();
+		return FValue::Null();
+	}
+
+	FValue FInterpreter::EvaluateIndex(const FValue& TargetValue, const FValue& IndexValue)
+	{
+		// 배열 인덱싱
+		if (TargetValue.Type == EValueType::Array && TargetValue.Array.IsValid())
+		{
+			if (IndexValue.Type != EValueType::Number)
+			{
+				AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Array index must be a number"));
+				SignalRuntimeError();
+				return FValue::Null();
+			}
+
+			const int32 Index = static_cast<int32>(IndexValue.Number);
+			if (Index < 0 || Index >= TargetValue.Array->Num())
+			{
+				AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Array index out of bounds (index: %d, size: %d)"), Index, TargetValue.Array->Num()));
+				SignalRuntimeError();
+				return FValue::Null();
+			}
+
+			return TargetValue.Array->operator[](Index);
+		}
+
+		// 객체 인덱싱 (문자열 키로 접근)
+		if (TargetValue.Type == EValueType::Object && TargetValue.Object.IsValid())
+		{
+			if (IndexValue.Type != EValueType::String)
+			{
+				AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Object index must be a string"));
+				SignalRuntimeError();
+				return FValue::Null();
+			}
+
+			if (const FValue* PropValue = TargetValue.Object->Find(IndexValue.GetString()))
+			{
+				return *PropValue;
+			}
+			// 속성이 없으면 null 반환
+			AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: Property '%s' not found in object"), *IndexValue.GetString()));
+			SignalRuntimeError();
+			return FValue::Null();
+		}
+
+		// Map 인덱싱 (원시 값 키로 접근, 없으면 null)
+		if (TargetValue.Type == EValueType::Map && TargetValue.Map.IsValid())
+		{
+			if (!IndexValue.IsHashableKey())
+			{
+				AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Map key must be a number, string or bool"));
+				SignalRuntimeError();
+				return FValue::Null();
+			}
+
+			const FValue* Found = TargetValue.Map->Find(IndexValue);
+			return Found ? *Found : FValue::Null();
+		}
+
+		AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Cannot index non-array and non-object value"));
+		SignalRuntimeError();
+		return FValue::Null();
+	}
+
+	TSharedPtr<FFunctionValue> FInterpreter::ResolveCallee(const FString& CalleeName, const TSharedPtr<FEnvironment>& Env)
+	{
+		FEnvironment::FEntry* Entry = Env->Lookup(CalleeName);
+		if (!Entry)
+		{
+			FString ErrorMsg = FString::Printf(
+				TEXT("MagicScript Runtime Error: Undefined function '%s'. "
+				     "Make sure the function is defined before calling it, or check for typos in the function name."),
+				*CalleeName
+			);
+			AddScriptLog(EScriptLogType::Error, ErrorMsg);
+			UE_LOG(LogMagicScript, Error, TEXT("%s"), *ErrorMsg);
+			SignalRuntimeError();
+			return nullptr;
+		}
+
+		if (Entry->Value.Type != EValueType::Function || !Entry->Value.Function.IsValid())
+		{
+			FString TypeName;
+			switch (Entry->Value.Type)
+			{
+				case EValueType::Number: TypeName = TEXT("Number"); break;
+				case EValueType::String: TypeName = TEXT("String"); break;
+				case EValueType::Bool: TypeName = TEXT("Bool"); break;
+				case EValueType::Null: TypeName = TEXT("Null"); break;
+				case EValueType::Array: TypeName = TEXT("Array"); break;
+				case EValueType::Function: TypeName = TEXT("Function (invalid)"); break;
+				case EValueType::Object: TypeName = TEXT("Object (invalid)"); break;
+				case EValueType::Map: TypeName = TEXT("Map"); break;
+				case EValueType::Set: TypeName = TEXT("Set"); break;
+				default: TypeName = TEXT("unknown (invalid)"); break;
+			}
+
+			FString ErrorMsg = FString::Printf(
+				TEXT("MagicScript Runtime Error: '%s' is not a function, it is a %s (type: %d). "
+				     "You cannot call a non-function value as a function."),
+				*CalleeName, *TypeName, static_cast<int32>(Entry->Value.Type)
+			);
+			AddScriptLog(EScriptLogType::Error, ErrorMsg);
+			UE_LOG(LogMagicScript, Error, TEXT("%s"), *ErrorMsg);
+			SignalRuntimeError();
+			return nullptr;
+		}
+
+		return Entry->Value.Function;
+	}
+
+	FValue FInterpreter::CallFunction(const TSharedPtr<FFunctionValue>& FuncValue, const TArrayView<const FValue> Args, const FScriptExecutionContext& Context)
+	{
+		FScriptHeap::FScope HeapScope(&Heap.Get());
+
+		// 현재 스택 위에 올려서 끝날 때까지 실행 (분할 실행 중 네이티브가 부른 콜백도 여기서는 멈추지 않음)
+		// 네이티브 콜백이 스크립트를 부를 때마다 네이티브 스택이 깊어지므로 호출 깊이와 별도로 제한
+		if (ActiveRunCount >= MAX_NESTED_RUN_DEPTH)
+		{
+			const FString ErrorMsg = FString::Printf(
+				TEXT("MagicScript Runtime Error: Native callback nesting too deep (%d) while calling '%s'"),
+				MAX_NESTED_RUN_DEPTH, FuncValue.IsValid() ? *FuncValue->Name : TEXT("<invalid>"));
+			AddScriptLog(EScriptLogType::Error, ErrorMsg);
+			UE_LOG(LogMagicScript, Error, TEXT("%s"), *ErrorMsg);
+			SignalRuntimeError();
+			return FValue::Null();
+		}
+
+		TGuardValue<FBudgetState> BudgetGuard(ActiveBudget, ActiveRunCount == 0 ? MakeBudgetState(Context) : ActiveBudget);
+
+		const int32 BaseDepth = FrameCount;
+		const int32 ValueBase = ValueStack.Num();
+		ValueStack.Append(Args.GetData(), Args.Num());
+		BeginCall(FuncValue, ValueBase, Context);
+		RunFrames(BaseDepth, Context, nullptr);
+
+		FValue Result = (!bAbortExecution && ValueStack.Num() > ValueBase) ? MoveTemp(ValueStack[ValueBase]) : FValue::Null();
+		TruncateValues(ValueBase);
+		return Result;
+	}
+
+	FValue FInterpreter::CallFunctionByName(const FString& Name, const TArray<FValue>& Args, const FScriptExecutionContext& Context)
+	{
+		MS_TRACE_SCOPE(TEXT("Call"), Name, ScriptName);
+		FScriptHeap::FScope HeapScope(&Heap.Get());
+
+		if (!GlobalEnv.IsValid())
+		{
+			AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Global environment is invalid"));
+			UE_LOG(LogMagicScript, Error, TEXT("MagicScript Runtime Error: Global environment is invalid"));
+			return FValue::Null();
+		}
+
+		// PreAnalysis 모드: 스냅샷 생성
+		TSharedPtr<FEnvironment> Snapshot = nullptr;
+		if (Context.Mode == EExecutionMode::PreAnalysis)
+		{
+			Snapshot = GlobalEnv->Clone();
+		}
+
+		FEnvironment::FEntry* Entry = GlobalEnv->Lookup(Name);
+		if (!Entry)
+		{
+			const FString ErrorMsg = FString::Printf(TEXT("MagicScript Runtime Error: Function '%s' is not defined"), *Name);
+			AddScriptLog(EScriptLogType::Error, ErrorMsg);
+			UE_LOG(LogMagicScript, Error, TEXT("%s"), *ErrorMsg);
+			
+			// PreAnalysis 모드: 스냅샷으로 복원
+			if (Context.Mode == EExecutionMode::PreAnalysis && Snapshot.IsValid())
+			{
+				GlobalEnv = Snapshot;
+			}
+			return FValue::Null();
+		}
+
+		if (Entry->Value.Type != EValueType::Function || !Entry->Value.Function.IsValid())
+		{
+			const FString ErrorMsg = FString::Printf(TEXT("MagicScript Runtime Error: '%s' is not a function (type: %d)"), *Name, static_cast<int32>(Entry->Value.Type));
+			AddScriptLog(EScriptLogType::Error, ErrorMsg);
+			UE_LOG(LogMagicScript, Error, TEXT("%s"), *ErrorMsg);
+			
+			// PreAnalysis 모드: 스냅샷으로 복원
+			if (Context.Mode == EExecutionMode::PreAnalysis && Snapshot.IsValid())
+			{
+				GlobalEnv = Snapshot;
+			}
+			return FValue::Null();
+		}
+
+		FValue Result = CallFunction(Entry->Value.Function, Args, Context);
+
+		// PreAnalysis 모드: 스냅샷으로 복원
+		if (Context.Mode == EExecutionMode::PreAnalysis && Snapshot.IsValid())
+		{
+			GlobalEnv = Snapshot;
+		}
+
+		return Result;
+	}
+
+	FValue FInterpreter::InvokeFunction(const TSharedPtr<FFunctionValue>& FuncValue, const TArrayView<const FValue> Args, const FScriptExecutionContext& Context)
+	{
+		if (!FuncValue.IsValid())
+		{
+			AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Invalid function value"));
+			return FValue::Null();
+		}
+
+		MS_TRACE_SCOPE(TEXT("Call"), FuncValue->Name, ScriptName);
+		FScriptHeap::FScope HeapScope(&Heap.Get());
+
+		// 네이티브 콜백 안에서 부른 경우는 바깥 실행의 일부이므로 상태를 건드리지 않음
+		if (ActiveRunCount == 0)
+		{
+			if (SlicedRun.bActive)
+			{
+				AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Cannot invoke a spell while a sliced execution is pending"));
+				return FValue::Null();
+			}
+
+			ResetSpaceTracking();
+			bAbortExecution = false;
+		}
+
+		// PreAnalysis 모드: 스냅샷 생성
+		TSharedPtr<FEnvironment> Snapshot = nullptr;
+		if (Context.Mode == EExecutionMode::PreAnalysis && GlobalEnv.IsValid())
+		{
+			Snapshot = GlobalEnv->Clone();
+		}
+
+		FValue Result = CallFunction(FuncValue, Args, Context);
+
+		// PreAnalysis 모드: 스냅샷으로 복원
+		if (Context.Mode == EExecutionMode::PreAnalysis && Snapshot.IsValid())
+		{
+			GlobalEnv = Snapshot;
+		}
+
+		return Result;
+	}
+
+	bool FInterpreter::BeginProgramSlices(const TSharedPtr<FProgram>& Program, const FScriptExecutionContext& Context)
+	{
+		if (!Program.IsValid() || !CanBeginSlices())
+		{
+			return false;
+		}
+
+		FScriptHeap::FScope HeapScope(&Heap.Get());
+
+		SlicedRun = FSlicedRun();
+		SlicedRun.bActive = true;
+		SlicedRun.Context = Context;
+		SlicedRun.Program = Program;
+
+		// PreAnalysis 모드: 스냅샷 생성
+		if (Context.Mode == EExecutionMode::PreAnalysis && GlobalEnv.IsValid())
+		{
+			SlicedRun.Snapshot = GlobalEnv->Clone();
+		}
+
+		// 프로그램 실행 전 메모리 통계 초기화
+		ResetSpaceTracking();
+		bAbortExecution = false;
+
+		SlicedRun.Budget = MakeBudgetState(Context);
+		SlicedRun.SuspendedCycles = FPlatformTime::Cycles64();
+
+		PushBlock(EFrameKind::Program, Program->Statements, GlobalEnv);
+		return true;
+	}
+
+	bool FInterpreter::BeginCallSlices(const FString& Name, const TArray<FValue>& Args, const FScriptExecutionContext& Context, const bool bContinueRun)
+	{
+		FEnvironment::FEntry* Entry = GlobalEnv.IsValid() ? GlobalEnv->Lookup(Name) : nullptr;
+		if (!Entry)
+		{
+			const FString ErrorMsg = FString::Printf(TEXT("MagicScript Runtime Error: Function '%s' is not defined"), *Name);
+			AddScriptLog(EScriptLogType::Error, ErrorMsg);
+			UE_LOG(LogMagicScript, Error, TEXT("%s"), *ErrorMsg);
+			return false;
+		}
+
+		if (Entry->Value.Type != EValueType::Function || !Entry->Value.Function.IsValid())
+		{
+			const FString ErrorMsg = FString::Printf(TEXT("MagicScript Runtime Error: '%s' is not a function (type: %d)"), *Name, static_cast<int32>(Entry->Value.Type));
+			AddScriptLog(EScriptLogType::Error, ErrorMsg);
+			UE_LOG(LogMagicScript, Error, TEXT("%s"), *ErrorMsg);
+			return false;
+		}
+
+		return BeginCallSlices(Entry->Value.Function, Args, Context, bContinueRun);
+	}
+
+	bool FInterpreter::BeginCallSlices(const TSharedPtr<FFunctionValue>& FuncValue, const TArray<FValue>& Args, const FScriptExecutionContext& Context, const bool bContinueRun)
+	{
+		if (!CanBeginSlices())
+		{
+			return false;
+		}
+
+		FScriptHeap::FScope HeapScope(&Heap.Get());
+
+		SlicedRun = FSlicedRun();
+		SlicedRun.bActive = true;
+		SlicedRun.Context = Context;
+
+		// PreAnalysis 모드: 스냅샷 생성
+		if (Context.Mode == EExecutionMode::PreAnalysis && GlobalEnv.IsValid())
+		{
+			SlicedRun.Snapshot = GlobalEnv->Clone();
+		}
+
+		// 이전 콜백이 남긴 런타임 에러 상태가 새 실행을 바로 중단시키지 않도록 리셋
+		if (!bContinueRun)
+		{
+			ResetSpaceTracking();
+		}
+		bAbortExecution = false;
+
+		SlicedRun.Budget = MakeBudgetState(Context);
+		SlicedRun.SuspendedCycles = FPlatformTime::Cycles64();
+
+		// 네이티브 함수면 여기서 바로 끝나고 다음 ResumeSlice에서 완료로 보고됨
+		ValueStack.Append(Args);
+		BeginCall(FuncValue, 0, SlicedRun.Context);
+		return true;
+	}
+
+	EScriptSliceState FInterpreter::ResumeSlice(const FScriptSliceBudget& Budget)
+	{
+		if (!SlicedRun.bActive)
+		{
+			return EScriptSliceState::Idle;
+		}
+
+		// 네이티브 콜백 안에서 다시 들어오면 스택 아래쪽 프레임을 건드리게 되므로 그대로 둠
+		if (ActiveRunCount > 0)
+		{
+			return EScriptSliceState::Suspended;
+		}
+
+		MS_TRACE_SCOPE(TEXT("Slice"), ScriptName);
+		FScriptHeap::FScope HeapScope(&Heap.Get());
+
+		// 멈춰 있던 시간은 실행 예산의 마감 시각에서 제외
+		FBudgetState ResumedBudget = SlicedRun.Budget;
+		if (ResumedBudget.DeadlineCycles > 0)
+		{
+			ResumedBudget.DeadlineCycles += FPlatformTime::Cycles64() - SlicedRun.SuspendedCycles;
+		}
+		TGuardValue<FBudgetState> BudgetGuard(ActiveBudget, ResumedBudget);
+
+		FSliceClock Clock(Budget);
+		if (!RunFrames(0, SlicedRun.Context, &Clock))
+		{
+			SlicedRun.Budget = ActiveBudget;
+			SlicedRun.SuspendedCycles = FPlatformTime::Cycles64();
+			return EScriptSliceState::Suspended;
+		}
+
+		const bool bAborted = bAbortExecution;
+		SlicedRun.Result = (!bAborted && ValueStack.Num() > 0) ? MoveTemp(ValueStack[0]) : FValue::Null();
+		FinishSlicedRun();
+		return bAborted ? EScriptSliceState::Aborted : EScriptSliceState::Completed;
+	}
+
+	void FInterpreter::CancelSlice()
+	{
+		if (!SlicedRun.bActive || ActiveRunCount > 0)
+		{
+			return;
+		}
+
+		FScriptHeap::FScope HeapScope(&Heap.Get());
+		UnwindFrames(0);
+		bReturnPending = false;
+		PendingReturnValue = FValue::Null();
+		SlicedRun.Result = FValue::Null();
+		FinishSlicedRun();
+	}
+
+	bool FInterpreter::CanBeginSlices() const
+	{
+		// 분할 실행은 실행 스택 맨 아래에서만 멈출 수 있으므로 다른 실행이 없을 때만 시작
+		if (SlicedRun.bActive || FrameCount > 0)
+		{
+			AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Cannot begin sliced execution while another execution is in progress"));
+			return false;
+		}
+		return true;
+	}
+
+	void FInterpreter::FinishSlicedRun()
+	{
+		ValueStack.Reset();
+
+		// PreAnalysis 모드: 스냅샷으로 복원
+		if (SlicedRun.Context.Mode == EExecutionMode::PreAnalysis && SlicedRun.Snapshot.IsValid())
+		{
+			GlobalEnv = SlicedRun.Snapshot;
+		}
+
+		// 컨텍스트의 인터프리터 참조를 놓아야 인터프리터가 스스로를 붙잡지 않음
+		SlicedRun.bActive = false;
+		SlicedRun.Context = FScriptExecutionContext();
+		SlicedRun.Program.Reset();
+		SlicedRun.Snapshot.Reset();
+	}
+
+	int32 FInterpreter::CollectGarbage()
+	{
+		if (Heap->IsExecuting())
+		{
+			return 0;
+		}
+
+		MS_TRACE_SCOPE(TEXT("Collect"), ScriptName);
+		return CycleCollector.Collect();
+	}
+
+	bool FInterpreter::StepGarbageCollection(int32 WorkBudget)
+	{
+		if (Heap->IsExecuting())
+		{
+			return false;
+		}
+
+		MS_TRACE_SCOPE(TEXT("Collect"), ScriptName);
+		return CycleCollector.Step(WorkBudget);
+	}
+
+	void FInterpreter::ResetSpaceTracking()
+	{
+		// 리셋 시점에 살아 있는 값(빌트인, 이전 실행의 전역 등)은 기준선으로 빼고 측정
+		SpaceBaselineBytes = Heap->GetLiveBytes();
+		Heap->ResetPeak();
+		ExecutionCount = 0;
+		ExpressionEvaluationCount = 0;
+		FunctionCallCount = 0;
+	}
+
+	void FInterpreter::AddSpaceBytes(int64 Delta)
+	{
+		if (Delta > 0)
+		{
+			Heap->Allocate(EScriptHeapCategory::Native, Delta);
+		}
+		else if (Delta < 0)
+		{
+			Heap->Release(EScriptHeapCategory::Native, -Delta);
+		}
+	}
+
+	FInterpreter::FBudgetState FInterpreter::MakeBudgetState(const FScriptExecutionContext& Context) const
+	{
+		const FScriptExecutionBudget& Budget = Context.Budget.HasLimit() ? Context.Budget : DefaultExecutionBudget;
+
+		FBudgetState State;
+		State.bActive = Budget.HasLimit();
+		if (Budget.MaxInstructions > 0)
+		{
+			State.InstructionLimit = ExecutionCount + ExpressionEvaluationCount + Budget.MaxInstructions;
+		}
+		State.MaxMemoryBytes = FMath::Max<int64>(0, Budget.MaxMemoryBytes);
+		if (State.MaxMemoryBytes > 0)
+		{
+			// 타이머 콜백처럼 ResetSpaceTracking 없이 시작한 실행도 이전 실행의 사용량을 물려받지 않도록 기준선을 잡음
+			State.MemoryBaselineBytes = Heap->GetLiveBytes();
+			State.PeakBaselineBytes = Heap->GetPeakBytes();
+		}
+		if (Budget.MaxSeconds > 0.0)
+		{
+			State.DeadlineCycles = FPlatformTime::Cycles64() + static_cast<uint64>(Budget.MaxSeconds / FPlatformTime::GetSecondsPerCycle64());
+		}
+		return State;
+	}
+
+	int64 FInterpreter::GetBudgetMemoryBytes() const
+	{
+		// 힙 최대값이 기준선보다 올라갔으면 이번 실행에서 생긴 최대값, 아니면 이전 최대값 아래이므로 현재 사용량으로 판단
+		const int64 PeakBytes = Heap->GetPeakBytes();
+		const int64 RunPeakBytes = PeakBytes > ActiveBudget.PeakBaselineBytes ? PeakBytes : Heap->GetLiveBytes();
+		return FMath::Max<int64>(0, RunPeakBytes - ActiveBudget.MemoryBaselineBytes);
+	}
+
+	bool FInterpreter::CheckBudget(const FSourceLocation& Location)
+	{
+		if (!ActiveBudget.bActive)
+		{
+			return true;
+		}
+
+		FString ErrorMsg;
+		const int64 Instructions = ExecutionCount + ExpressionEvaluationCount;
+		if (ActiveBudget.InstructionLimit > 0 && Instructions > ActiveBudget.InstructionLimit)
+		{
+			ErrorMsg = FString::Printf(TEXT("MagicScript Runtime Error: Instruction budget exceeded at line %d, column %d (%lld instructions executed). Execution stopped."),
+				Location.Line, Location.Column, Instructions);
+		}
+		else if (ActiveBudget.MaxMemoryBytes > 0 && GetBudgetMemoryBytes() > ActiveBudget.MaxMemoryBytes)
+		{
+			ErrorMsg = FString::Printf(TEXT("MagicScript Runtime Error: Memory budget exceeded at line %d, column %d (peak %lld bytes, limit %lld bytes). Execution stopped."),
+				Location.Line, Location.Column, GetBudgetMemoryBytes(), ActiveBudget.MaxMemoryBytes);
+		}
+		else if (ActiveBudget.DeadlineCycles > 0 && --ActiveBudget.ClockCountdown <= 0)
+		{
+			ActiveBudget.ClockCountdown = BudgetClockCheckInterval;
+			if (FPlatformTime::Cycles64() >= ActiveBudget.DeadlineCycles)
+			{
+				ErrorMsg = FString::Printf(TEXT("MagicScript Runtime Error: Time budget exceeded at line %d, column %d. Execution stopped."),
+					Location.Line, Location.Column);
+			}
+		}
+
+		if (ErrorMsg.IsEmpty())
+		{
+			return true;
+		}
+
+		// 중단되는 동안 다시 보고하지 않도록 이번 실행의 예산은 끔
+		ActiveBudget.bActive = false;
+		AddScriptLog(EScriptLogType::Error, ErrorMsg, Location.Line, Location.Column);
+		UE_LOG(LogMagicScript, Error, TEXT("%s"), *ErrorMsg);
+		SignalRuntimeError();
+		return false;
+	}
+
+	void FInterpreter::SignalRuntimeError()
+	{
+		bAbortExecution = true;
+	}
+
+	void FInterpreter::AddScriptLog(const EScriptLogType ScriptLogType, const FString& ScriptLogMessage, const int32 Line, const int32 Column) const
+	{
+		if (Host)
+		{
+			Host->AddScriptLog(ScriptLogType, ScriptLogMessage, ScriptName.IsEmpty() ? NAME_None : FName(*ScriptName), Line, Column);
+			return;
+		}
+		MagicScript::AddScriptLog(ScriptLogType, ScriptLogMessage, Line, Column);
+	}
+
+}
+
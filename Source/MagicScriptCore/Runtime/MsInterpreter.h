@@ -0,0 +1,320 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MagicScriptCore/Core/MsAst.h"
+#include "MagicScriptCore/Core/MsValue.h"
+#include "MagicScriptCore/Core/MsEnvironment.h"
+#include "MagicScriptCore/Runtime/MsEventLoop.h"
+#include "MagicScriptCore/Runtime/MsExecutionFrame.h"
+#include "MagicScriptCore/Runtime/MsProfiler.h"
+#include "MagicScriptCore/Runtime/MsScriptHeap.h"
+#include "MagicScriptCore/Runtime/MsCycleCollector.h"
+
+enum class EScriptLogType : uint8;
+
+namespace MagicScript
+{
+	class IScriptHost;
+
+	// 실행 모드 
+	enum class EExecutionMode : uint8
+	{
+		Normal,      // 정상 실행
+		PreAnalysis  // 사전 계산 모드
+	};
+
+	// 실행 한 번(전역 코드 또는 spell 호출)에 적용할 예산 (0이면 해당 제한 없음)
+	// - 반복문이 다음 회차로 돌아갈 때와 spell을 호출할 때만 검사하므로 직선 코드에는 검사 비용이 없음
+	// - 넘으면 해당 위치를 담은 런타임 에러로 실행 중단
+	struct MAGICSCRIPTCORE_API FScriptExecutionBudget
+	{
+		int64 MaxInstructions = 0;   // 문장 실행 + 식 평가 횟수
+		int64 MaxMemoryBytes = 0;    // 실행 중 늘어난 스크립트 힙 최대 사용량 (시작 시점에 살아 있던 값 제외)
+		double MaxSeconds = 0.0;     // 실제 실행 시간 (분할 실행이 멈춰 있던 시간은 제외)
+
+		bool HasLimit() const { return MaxInstructions > 0 || MaxMemoryBytes > 0 || MaxSeconds > 0.0; }
+	};
+
+	// 실행 컨텍스트
+	struct MAGICSCRIPTCORE_API FScriptExecutionContext
+	{
+		EExecutionMode Mode = EExecutionMode::Normal;
+
+		// 비어 있으면 인터프리터의 기본 예산 사용 (SetDefaultExecutionBudget)
+		FScriptExecutionBudget Budget;
+		
+		// PreAnalysis 모드에서 롤백을 위한 Environment 스냅샷
+		TSharedPtr<FEnvironment> Snapshot;
+		
+		// 네이티브 함수에서 스크립트 함수를 호출하기 위한 Interpreter 포인터
+		TSharedPtr<FInterpreter> Interpreter = nullptr;
+		
+		FScriptExecutionContext() = default;
+		explicit FScriptExecutionContext(const EExecutionMode InMode) : Mode(InMode) {}
+	};
+
+	// 분할 실행 한 번에 쓸 예산 (둘 다 0 이하면 제한 없음, 최소 한 단계는 진행)
+	struct MAGICSCRIPTCORE_API FScriptSliceBudget
+	{
+		int32 MaxInstructions = 0;     // 실행 스택 단계 수 (문장/식 진행 한 번 = 1)
+		double MaxMilliseconds = 0.0;
+
+		FScriptSliceBudget() = default;
+		FScriptSliceBudget(const int32 InMaxInstructions, const double InMaxMilliseconds)
+			: MaxInstructions(InMaxInstructions)
+			, MaxMilliseconds(InMaxMilliseconds)
+		{
+		}
+	};
+
+	// 분할 실행 상태
+	enum class EScriptSliceState : uint8
+	{
+		Idle,       // 진행 중인 분할 실행 없음
+		Suspended,  // 예산을 다 써서 멈춤 (다음 ResumeSlice에서 멈춘 지점부터 이어서 실행)
+		Completed,
+		Aborted     // 런타임 에러 또는 CancelSlice
+	};
+
+	/**
+	 * AST 인터프리터
+	 * - Program 실행
+	 * - 전역 환경에서 함수 등록/호출
+	 * - C++ 재귀 대신 명시적 프레임 스택으로 실행하므로 예산 단위로 멈췄다가 다음 틱에 이어서 실행 가능
+	 */
+	
+	class MAGICSCRIPTCORE_API FInterpreter
+	{
+	public:
+		FInterpreter() = default;
+
+		// 전역 환경을 놓은 뒤 남은 순환 참조까지 수거
+		~FInterpreter();
+
+		// 프로그램 전체 실행 (전역 코드 + 함수 정의 등)
+		void ExecuteProgram(const TSharedPtr<FProgram>& Program, const FScriptExecutionContext& Context = FScriptExecutionContext());
+
+		// 전역 환경에 접근
+		TSharedPtr<FEnvironment> GetGlobalEnv() const { return GlobalEnv; }
+
+		// 트레이스/진단 표시용 스크립트 이름 (보통 상대 경로)
+		void SetScriptName(const FString& InScriptName) { ScriptName = InScriptName; }
+		const FString& GetScriptName() const { return ScriptName; }
+
+		// 마지막으로 실행한 호출식 위치 (네이티브 함수가 자신을 부른 코드 위치를 로그에 남길 때 사용)
+		const FSourceLocation& GetCurrentCallLocation() const { return CurrentCallLocation; }
+
+		// 런타임 에러 로그를 받을 호스트 (null이면 기본 호스트 사용)
+		void SetHost(IScriptHost* InHost) { Host = InHost; }
+		IScriptHost* GetHost() const { return Host; }
+
+		// 전역에서 이름으로 함수를 찾아 호출
+		FValue CallFunctionByName(const FString& Name, const TArray<FValue>& Args, const FScriptExecutionContext& Context = FScriptExecutionContext());
+
+		// 마지막 ResetSpaceTracking 이후 스크립트 힙 최대 사용량 (byte 단위, 리셋 시점에 살아 있던 값 제외)
+		int64 GetPeakSpaceBytes() const { return FMath::Max<int64>(0, Heap->GetPeakBytes() - SpaceBaselineBytes); }
+
+		// 마지막 ResetSpaceTracking 이후 늘어난 현재 사용량
+		int64 GetLiveSpaceBytes() const { return FMath::Max<int64>(0, Heap->GetLiveBytes() - SpaceBaselineBytes); }
+
+		// 분류별 사용량 등 세부 통계
+		const FScriptHeap& GetHeap() const { return *Heap; }
+
+		// 순환 참조로 남은 값을 한 번에 수거 (실행 중이면 아무것도 하지 않음), 수거한 노드 수 반환
+		int32 CollectGarbage();
+
+		// 작업 예산(노드/참조 방문 수)만큼만 수거 진행 (틱마다 나눠 호출), 한 주기가 끝났으면 true
+		bool StepGarbageCollection(int32 WorkBudget);
+
+		const FScriptCycleCollector& GetCycleCollector() const { return CycleCollector; }
+
+		// 메모리 사용 통계 리셋
+		void ResetSpaceTracking();
+
+		// 동적 실행 카운트 가져오기
+		int64 GetExecutionCount() const { return ExecutionCount; }
+		int64 GetExpressionEvaluationCount() const { return ExpressionEvaluationCount; }
+		int32 GetFunctionCallCount() const { return FunctionCallCount; }
+
+		// 런타임 에러로 실행이 중단되었는지 (네이티브 함수에서 콜백 반복 중단용)
+		bool IsExecutionAborted() const { return bAbortExecution; }
+
+		// 이벤트 루프 접근
+		FEventLoop& GetEventLoop() { return EventLoop; }
+
+		// 프로파일러 연결 (null이면 프로파일링 끔)
+		void SetProfiler(const TSharedPtr<FScriptProfiler>& InProfiler) { Profiler = InProfiler; }
+		TSharedPtr<FScriptProfiler> GetProfiler() const { return Profiler; }
+
+		// 예산이 없는 컨텍스트(이벤트 루프 콜백 등)로 시작한 실행에 적용할 예산
+		void SetDefaultExecutionBudget(const FScriptExecutionBudget& InBudget) { DefaultExecutionBudget = InBudget; }
+		const FScriptExecutionBudget& GetDefaultExecutionBudget() const { return DefaultExecutionBudget; }
+
+		// spell 호출 깊이 제한 (무한 재귀 방지), 프레임은 힙에 있는 실행 스택에 쌓이므로 수천 단계까지 가능
+		static constexpr int32 DEFAULT_MAX_CALL_DEPTH = 4096;
+		void SetMaxCallDepth(const int32 InMaxCallDepth) { MaxCallDepth = FMath::Max(1, InMaxCallDepth); }
+		int32 GetMaxCallDepth() const { return MaxCallDepth; }
+
+		// 내부 함수 호출 (네이티브 콜백/이벤트 루프용, 끝날 때까지 실행)
+		FValue CallFunction(const TSharedPtr<FFunctionValue>& FuncValue, TArrayView<const FValue> Args, const FScriptExecutionContext& Context = FScriptExecutionContext());
+
+		// 미리 찾아 둔 spell을 새 실행으로 호출 (전역 코드를 다시 실행하지 않음)
+		// 바깥 실행이 없으면 이전 실행의 중단 상태와 메모리 통계를 리셋, 분할 실행이 멈춰 있으면 거부
+		FValue InvokeFunction(const TSharedPtr<FFunctionValue>& FuncValue, TArrayView<const FValue> Args, const FScriptExecutionContext& Context = FScriptExecutionContext());
+
+		// === 분할 실행 ===
+		// 실행을 준비만 하고 ResumeSlice로 예산만큼씩 진행 (다른 실행이 진행 중이면 false)
+		bool BeginProgramSlices(const TSharedPtr<FProgram>& Program, const FScriptExecutionContext& Context = FScriptExecutionContext());
+		// spell 분할 실행은 이전 실행의 중단 상태와 메모리 통계를 리셋
+		// bContinueRun이면 방금 끝난 전역 코드 분할 실행에 이어지는 호출이므로 통계를 이어서 셈
+		bool BeginCallSlices(const FString& Name, const TArray<FValue>& Args, const FScriptExecutionContext& Context = FScriptExecutionContext(), bool bContinueRun = false);
+		bool BeginCallSlices(const TSharedPtr<FFunctionValue>& FuncValue, const TArray<FValue>& Args, const FScriptExecutionContext& Context = FScriptExecutionContext(), bool bContinueRun = false);
+
+		// 예산만큼 실행, 끝나면 Completed/Aborted를 한 번 반환하고 Idle로 돌아감
+		// 네이티브 함수가 부른 콜백(Array.map 등)은 중간에 멈추지 않고 끝까지 실행됨
+		EScriptSliceState ResumeSlice(const FScriptSliceBudget& Budget);
+
+		// 멈춰 있는 분할 실행을 버림 (스크립트 실행 중에는 무시)
+		void CancelSlice();
+
+		bool HasPendingSlice() const { return SlicedRun.bActive; }
+
+		// 마지막으로 끝난 분할 실행의 반환값
+		const FValue& GetSliceResult() const { return SlicedRun.Result; }
+
+	private:
+		// 이 인터프리터가 만든 값의 메모리 계측 (GlobalEnv보다 먼저 생성되어야 함)
+		TSharedRef<FScriptHeap, ESPMode::ThreadSafe> Heap = MakeShared<FScriptHeap, ESPMode::ThreadSafe>();
+		TSharedPtr<FEnvironment> GlobalEnv = MakeShared<FEnvironment>(nullptr, &Heap.Get());
+		FScriptCycleCollector CycleCollector{ Heap.Get() };
+		FString ScriptName;
+		IScriptHost* Host = nullptr;
+
+		// 메모리 사용 추적용 (리셋 시점의 힙 사용량)
+		int64 SpaceBaselineBytes = 0;
+
+		// 시간 복잡도 추적용 (동적 분석)
+		int64 ExecutionCount = 0;              // 문장 실행 횟수
+		int64 ExpressionEvaluationCount = 0;  // 표현식 평가 횟수
+		int32 FunctionCallCount = 0;           // 함수 호출 횟수
+		FSourceLocation CurrentCallLocation;
+
+		// 함수 호출 스택 깊이 제한 (무한 재귀 방지)
+		int32 MaxCallDepth = DEFAULT_MAX_CALL_DEPTH;
+		int32 CallStackDepth = 0;
+
+		// 네이티브 함수가 스크립트 콜백을 부를 때마다 실행 루프가 네이티브 스택에 중첩되므로 따로 제한
+		static constexpr int32 MAX_NESTED_RUN_DEPTH = 64;
+
+		// 가장 바깥 실행에 적용 중인 예산 (네이티브 콜백으로 중첩된 실행은 바깥 예산을 그대로 씀)
+		struct FBudgetState
+		{
+			bool bActive = false;
+			int64 InstructionLimit = 0;   // ExecutionCount + ExpressionEvaluationCount 상한
+			int64 MaxMemoryBytes = 0;
+			int64 MemoryBaselineBytes = 0; // 시작 시점의 힙 현재 사용량 (늘어난 양만 예산에 반영)
+			int64 PeakBaselineBytes = 0;   // 시작 시점의 힙 최대 사용량 (이전 실행이 남긴 최대값과 구분)
+			uint64 DeadlineCycles = 0;
+			int32 ClockCountdown = 0;     // 시계는 검사 지점 몇 번마다 한 번만 읽음
+
+			// 예산이 실행 길이를 끊어 주는지 (while 반복 횟수 고정 제한 대신 사용)
+			bool BoundsExecution() const { return bActive && (InstructionLimit > 0 || DeadlineCycles > 0); }
+		};
+		FScriptExecutionBudget DefaultExecutionBudget;
+		FBudgetState ActiveBudget;
+
+		FBudgetState MakeBudgetState(const FScriptExecutionContext& Context) const;
+
+		// 반복문 회차/spell 호출 지점에서 호출, 예산을 넘었으면 에러를 남기고 중단시킨 뒤 false
+		bool CheckBudget(const FSourceLocation& Location);
+
+		// 현재 예산 실행이 시작된 뒤 늘어난 힙 최대 사용량
+		int64 GetBudgetMemoryBytes() const;
+
+		// 런타임 에러 발생 시 이후 실행 중단 
+		bool bAbortExecution = false;
+
+		void AddSpaceBytes(int64 Delta);
+		void SignalRuntimeError();
+
+		// 호스트로 로그 전달 (스크립트 이름을 ScriptId로 사용)
+		void AddScriptLog(const EScriptLogType ScriptLogType, const FString& ScriptLogMessage, const int32 Line = 0, const int32 Column = 0) const;
+
+		// === 명시적 실행 스택 ===
+		// 프레임 슬롯과 값 스택 용량은 줄이지 않고 다음 호출에서 재사용 (FrameCount 위의 슬롯은 비어 있음)
+		TArray<FExecutionFrame> Frames;
+		int32 FrameCount = 0;
+		TArray<FValue> ValueStack;           // 식 중간 결과 / 호출 인자
+
+		// 네이티브 함수에 넘길 인자 배열 (네이티브 호출 중첩 깊이별로 재사용, 콜백 중 풀이 커져도 주소 유지)
+		TArray<TUniquePtr<TArray<FValue>>> NativeArgumentPool;
+		int32 NativeArgumentDepth = 0;
+
+		// return 문이 가장 가까운 spell 프레임까지 프레임을 내리는 중
+		bool bReturnPending = false;
+		FValue PendingReturnValue;
+
+		int32 ActiveRunCount = 0;        // 진행 중인 실행 루프 수 (네이티브 콜백이 스크립트를 부르면 중첩)
+		bool bSlicedRunActive = false;   // 지금 도는 실행 루프가 멈출 수 있는 분할 실행인지
+
+		// 멈춰 있는 분할 실행 (실행 스택 맨 아래에 프레임이 남아 있음)
+		struct FSlicedRun
+		{
+			bool bActive = false;
+			FScriptExecutionContext Context;
+			TSharedPtr<FProgram> Program;        // 멈춰 있는 동안 AST 유지
+			TSharedPtr<FEnvironment> Snapshot;   // PreAnalysis 모드 복원용
+			FValue Result;
+			FBudgetState Budget;                 // 멈춰 있는 동안의 예산 (재개할 때 마감 시각을 멈춘 시간만큼 미룸)
+			uint64 SuspendedCycles = 0;
+		};
+		FSlicedRun SlicedRun;
+
+		struct FSliceClock;
+
+		// BaseDepth 위의 프레임이 모두 끝나면 true, Clock 예산을 다 써서 멈추면 false
+		bool RunFrames(int32 BaseDepth, const FScriptExecutionContext& Context, FSliceClock* Clock);
+		void StepFrame(const FScriptExecutionContext& Context);
+		void StepBlock();
+		void StepStatement();
+		void StepExpression(const FScriptExecutionContext& Context);
+		void StepCall();
+
+		FExecutionFrame& TopFrame() { return Frames[FrameCount - 1]; }
+
+		// 인자로 받는 환경은 값으로 복사 (프레임 배열이 커지면서 기존 프레임 참조가 무효화될 수 있음)
+		FExecutionFrame& PushFrame(EFrameKind Kind, TSharedPtr<FEnvironment> Env);
+		void PushBlock(EFrameKind Kind, const TArray<FStatementPtr>& Statements, TSharedPtr<FEnvironment> Env);
+		void PushStatement(const FStatementPtr& Stmt, TSharedPtr<FEnvironment> Env);
+		void PushExpression(const FExpressionPtr& Expr, TSharedPtr<FEnvironment> Env);
+
+		// 값 스택의 ArgBase부터를 인자로 소비해 네이티브 함수는 바로 호출하고, 스크립트 spell은 Call 프레임을 올림
+		// (어느 쪽이든 결과 값 하나가 ArgBase 위치에 올라감)
+		void BeginCall(const TSharedPtr<FFunctionValue>& FuncValue, int32 ArgBase, const FScriptExecutionContext& Context);
+
+		void PopFrame();
+		void UnwindFrames(int32 BaseDepth);
+		void FinishExpression(FValue Value);
+		FValue PopValue();
+		void TruncateValues(int32 NewNum);
+
+		bool CanBeginSlices() const;
+		void FinishSlicedRun();
+
+		// 하위 식이 없는 노드(리터럴, 식별자, 화살표 함수, 증감)는 프레임 없이 바로 평가
+		bool TryEvaluateImmediate(const FExpression& Expr, const TSharedPtr<FEnvironment>& Env, FValue& OutValue);
+
+		FValue AssignValue(const FAssignmentExpression& Asg, const TSharedPtr<FEnvironment>& Env, const FValue& RightValue);
+		FValue AssignIndexed(const FAssignmentExpression& Asg, const TSharedPtr<FEnvironment>& Env, const FValue& IndexValue, const FValue& RightValue);
+		FValue EvaluateMemberAccess(const FMemberAccessExpression& MemberAccess, const FValue& TargetValue);
+		FValue EvaluateIndex(const FValue& TargetValue, const FValue& IndexValue);
+		TSharedPtr<FFunctionValue> ResolveCallee(const FString& CalleeName, const TSharedPtr<FEnvironment>& Env);
+
+		// 이벤트 루프
+		FEventLoop EventLoop;
+
+		// 프로파일러 (연결된 경우에만 spell/라인 단위 시간 측정)
+		TSharedPtr<FScriptProfiler> Profiler;
+	};
+}
+
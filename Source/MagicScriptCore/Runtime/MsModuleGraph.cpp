@@ -0,0 +1,216 @@
+#include "MagicScriptCore/Runtime/MsModuleGraph.h"
+#include "MagicScriptCore/Core/MsAst.h"
+#include "MagicScriptCore/Core/MsEnvironment.h"
+#include "MagicScriptCore/Logging/MsLogging.h"
+#include "MagicScriptCore/Logging/MsLoggingEnum.h"
+#include "MagicScriptCore/Logging/MsTrace.h"
+#include "MagicScriptCore/Runtime/MsScriptHost.h"
+
+namespace MagicScript
+{
+	namespace
+	{
+		void LogToHost(IScriptHost* Host, const EScriptLogType Type, const FString& Message, const FString& ScriptName)
+		{
+			if (Host)
+			{
+				Host->AddScriptLog(Type, Message, FName(*ScriptName));
+				return;
+			}
+			AddScriptLog(Type, Message);
+		}
+	}
+
+	FModuleGraph::FModuleGraph(IScriptHost* InHost, FCompileModule InCompileModule, FCreateInterpreter InCreateInterpreter)
+		: Host(InHost)
+		, CompileModule(MoveTemp(InCompileModule))
+		, CreateInterpreter(MoveTemp(InCreateInterpreter))
+	{
+	}
+
+	void FModuleGraph::CollectImports(const FProgram& Program, TArray<FString>& OutPaths)
+	{
+		for (const FStatementPtr& Stmt : Program.Statements)
+		{
+			if (Stmt.IsValid() && Stmt->Kind == EStatementKind::Import)
+			{
+				OutPaths.AddUnique(static_cast<const FImportStatement*>(Stmt.Get())->Path);
+			}
+		}
+	}
+
+	bool FModuleGraph::Resolve(const TSharedPtr<FProgram>& Program, const FScriptExecutionContext& Context)
+	{
+		if (!Program.IsValid())
+		{
+			return false;
+		}
+
+		TArray<FString> Imports;
+		CollectImports(*Program, Imports);
+		if (Imports.Num() == 0)
+		{
+			return true;
+		}
+
+		// 1) 그래프 구성 + 순환 검사 (처음 보는 모듈은 여기서 컴파일)
+		TSet<FString> Visiting;
+		TSet<FString> Visited;
+		TArray<FString> Order;
+		for (const FString& Path : Imports)
+		{
+			if (!Visit(Path, Visiting, Visited, Order))
+			{
+				return false;
+			}
+		}
+
+		// 2) 의존하는 모듈이 먼저 오도록 후위 순서로 평가 (이미 평가한 모듈은 건너뜀)
+		for (const FString& Path : Order)
+		{
+			const TSharedPtr<FScriptModule> Module = Modules.FindRef(Path);
+			if (Module.IsValid() && !Module->bEvaluated && !Evaluate(*Module, Context))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool FModuleGraph::Visit(const FString& Path, TSet<FString>& Visiting, TSet<FString>& Visited, TArray<FString>& Order)
+	{
+		if (Visited.Contains(Path))
+		{
+			// 다른 경로로 이미 방문한 모듈 (다이아몬드 import)
+			return true;
+		}
+		if (Visiting.Contains(Path))
+		{
+			LogToHost(Host, EScriptLogType::Error, FString::Printf(TEXT("MagicScript: Cyclic import detected: %s"), *Path), Path);
+			return false;
+		}
+
+		TSharedPtr<FScriptModule> Module = Modules.FindRef(Path);
+		if (!Module.IsValid())
+		{
+			MS_TRACE_SCOPE(TEXT("Import"), Path);
+			const TSharedPtr<FProgram> ModuleProgram = CompileModule ? CompileModule(Path) : nullptr;
+			if (!ModuleProgram.IsValid())
+			{
+				return false;
+			}
+
+			Module = MakeShared<FScriptModule>();
+			Module->Path = Path;
+			Module->Program = ModuleProgram;
+			CollectImports(*ModuleProgram, Module->Imports);
+			Modules.Add(Path, Module);
+		}
+
+		Visiting.Add(Path);
+		for (const FString& Dependency : Module->Imports)
+		{
+			if (!Visit(Dependency, Visiting, Visited, Order))
+			{
+				return false;
+			}
+		}
+		Visiting.Remove(Path);
+
+		Visited.Add(Path);
+		Order.Add(Path);
+		return true;
+	}
+
+	bool FModuleGraph::Evaluate(FScriptModule& Module, const FScriptExecutionContext& Context)
+	{
+		MS_TRACE_SCOPE(TEXT("Import"), Module.Path);
+
+		const TSharedPtr<FInterpreter> Interpreter = CreateInterpreter ? CreateInterpreter(Module.Path) : nullptr;
+		if (!Interpreter.IsValid())
+		{
+			return false;
+		}
+
+		// 의존 모듈은 후위 순서상 이미 평가됨
+		Link(Module.Program, Interpreter->GetGlobalEnv());
+
+		FScriptExecutionContext ModuleContext = Context;
+		ModuleContext.Interpreter = Interpreter;
+		Interpreter->ExecuteProgram(Module.Program, ModuleContext);
+		if (Interpreter->IsExecutionAborted())
+		{
+			// 런타임 에러는 인터프리터가 위치와 함께 이미 남김 (다음 Resolve에서 다시 평가)
+			LogToHost(Host, EScriptLogType::Error,
+				FString::Printf(TEXT("MagicScript Runtime Error: Failed to initialize module: %s"), *Module.Path), Module.Path);
+			return false;
+		}
+
+		// 최상위 선언만 export (빌트인과 모듈이 import한 이름은 제외)
+		const TSharedPtr<FEnvironment> Env = Interpreter->GetGlobalEnv();
+		for (const FStatementPtr& Stmt : Module.Program->Statements)
+		{
+			FString Name;
+			if (Stmt.IsValid() && Stmt->Kind == EStatementKind::VarDecl)
+			{
+				Name = static_cast<const FVarDeclStatement*>(Stmt.Get())->Name;
+			}
+			else if (Stmt.IsValid() && Stmt->Kind == EStatementKind::FuncDecl)
+			{
+				Name = static_cast<const FFuncDeclStatement*>(Stmt.Get())->Name;
+			}
+
+			if (const FEnvironment::FEntry* Entry = Name.IsEmpty() ? nullptr : Env->Lookup(Name))
+			{
+				Module.Exports.Add(Name, Entry->Value);
+			}
+		}
+
+		Module.Interpreter = Interpreter;
+		Module.bEvaluated = true;
+		return true;
+	}
+
+	void FModuleGraph::ForEachModuleInterpreter(TFunctionRef<void(const TSharedPtr<FInterpreter>&)> Visitor) const
+	{
+		TArray<TSharedPtr<FInterpreter>> Interpreters;
+		Interpreters.Reserve(Modules.Num());
+		for (const TPair<FString, TSharedPtr<FScriptModule>>& Pair : Modules)
+		{
+			if (Pair.Value.IsValid() && Pair.Value->Interpreter.IsValid())
+			{
+				Interpreters.Add(Pair.Value->Interpreter);
+			}
+		}
+
+		for (const TSharedPtr<FInterpreter>& Interpreter : Interpreters)
+		{
+			Visitor(Interpreter);
+		}
+	}
+
+	void FModuleGraph::Link(const TSharedPtr<FProgram>& Program, const TSharedPtr<FEnvironment>& Env) const
+	{
+		if (!Program.IsValid() || !Env.IsValid())
+		{
+			return;
+		}
+
+		TArray<FString> Imports;
+		CollectImports(*Program, Imports);
+		for (const FString& Path : Imports)
+		{
+			const TSharedPtr<FScriptModule> Module = Modules.FindRef(Path);
+			if (!Module.IsValid() || !Module->bEvaluated)
+			{
+				continue;
+			}
+
+			for (const TPair<FString, FValue>& Export : Module->Exports)
+			{
+				// 이미 같은 이름이 있으면 (빌트인, 먼저 import한 모듈) 먼저 것을 유지
+				Env->Define(Export.Key, Export.Value, true);
+			}
+		}
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MagicScriptCore/Core/MsValue.h"
+#include "MagicScriptCore/Runtime/MsInterpreter.h"
+
+namespace MagicScript
+{
+	class IScriptHost;
+	class FEnvironment;
+	struct FProgram;
+
+	// import한 스크립트 인스턴스 (전역 코드는 한 번만 실행)
+	struct MAGICSCRIPTCORE_API FScriptModule
+	{
+		FString Path;
+		TSharedPtr<FProgram> Program;
+
+		// export한 spell의 클로저(모듈 전역 환경)를 살려 둠
+		TSharedPtr<FInterpreter> Interpreter;
+
+		// 직접 import한 모듈 경로 (선언 순서)
+		TArray<FString> Imports;
+
+		// 최상위 let/const/spell 이름 → 값 (평가 직후 고정, 이후 바꾸지 않음)
+		TMap<FString, FValue> Exports;
+
+		bool bEvaluated = false;
+	};
+
+	/**
+	 * import 그래프와 모듈 인스턴스
+	 * - 모듈마다 인터프리터 하나에서 전역 코드를 한 번만 실행하고 export 표를 고정
+	 * - import하는 쪽은 export 값을 전역 환경에 상수로 바인딩 (배열/객체/spell은 같은 값을 참조)
+	 * - Resolve는 그래프를 깊이 우선으로 따라가 의존 순서(위상 순서)대로 아직 평가하지 않은 모듈만 평가
+	 */
+	class MAGICSCRIPTCORE_API FModuleGraph
+	{
+	public:
+		// 모듈 소스 로딩 + 컴파일 (실패 시 null, 에러 로그는 콜백이 남김)
+		using FCompileModule = TFunction<TSharedPtr<FProgram>(const FString& Path)>;
+
+		// 빌트인을 등록한 모듈용 인터프리터 생성
+		using FCreateInterpreter = TFunction<TSharedPtr<FInterpreter>(const FString& Path)>;
+
+		FModuleGraph(IScriptHost* InHost, FCompileModule InCompileModule, FCreateInterpreter InCreateInterpreter);
+
+		// Program이 (간접적으로) import하는 모듈을 모두 준비
+		// 순환 import, 로딩/컴파일 실패, 모듈 전역 코드의 런타임 에러면 false
+		bool Resolve(const TSharedPtr<FProgram>& Program, const FScriptExecutionContext& Context);
+
+		// Program의 import 문이 가리키는 모듈 export를 Env에 상수로 바인딩 (Resolve 이후 호출)
+		void Link(const TSharedPtr<FProgram>& Program, const TSharedPtr<FEnvironment>& Env) const;
+
+		// 모듈 인스턴스를 버림 (다음 Resolve에서 다시 컴파일/평가)
+		void Invalidate(const FString& Path) { Modules.Remove(Path); }
+		void Reset() { Modules.Reset(); }
+
+		TSharedPtr<const FScriptModule> FindModule(const FString& Path) const { return Modules.FindRef(Path); }
+
+		// 평가된 모듈의 인터프리터를 모두 방문 (호스트가 이벤트 루프/예산/수집을 스크립트 인터프리터와 같이 관리)
+		// 방문 중 import로 모듈이 추가/제거될 수 있으므로 목록을 먼저 복사한 뒤 호출
+		void ForEachModuleInterpreter(TFunctionRef<void(const TSharedPtr<FInterpreter>&)> Visitor) const;
+
+		// 프로그램의 import 경로 (선언 순서, 중복 제외)
+		static void CollectImports(const FProgram& Program, TArray<FString>& OutPaths);
+
+	private:
+		IScriptHost* Host = nullptr;
+		FCompileModule CompileModule;
+		FCreateInterpreter CreateInterpreter;
+		TMap<FString, TSharedPtr<FScriptModule>> Modules;
+
+		// 깊이 우선 방문, 후위 순서로 Order에 추가 (Visiting에 있는 경로를 다시 만나면 순환)
+		bool Visit(const FString& Path, TSet<FString>& Visiting, TSet<FString>& Visited, TArray<FString>& Order);
+
+		bool Evaluate(FScriptModule& Module, const FScriptExecutionContext& Context);
+	};
+}
@@ -0,0 +1,227 @@
+#include "MagicScriptCore/Runtime/MsProfiler.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+
+namespace MagicScript
+{
+	FScriptProfiler::FScriptProfiler(const FString& InScriptName)
+		: ScriptName(InScriptName)
+	{
+		Reset();
+	}
+
+	void FScriptProfiler::Reset()
+	{
+		BaseCycles = FPlatformTime::Cycles64();
+		Functions.Reset();
+		FunctionIndexByKey.Reset();
+		Lines.Reset();
+		CallTree.Reset();
+		CallTreeChildLookup.Reset();
+		FunctionStack.Reset();
+		StatementStack.Reset();
+		TraceEvents.Reset();
+		bTraceTruncated = false;
+	}
+
+	void FScriptProfiler::EnterFunction(const FString& Name, int32 DefinitionLine)
+	{
+		const TPair<FString, int32> FunctionKey(Name, DefinitionLine);
+		int32 FunctionIndex = INDEX_NONE;
+		if (const int32* Found = FunctionIndexByKey.Find(FunctionKey))
+		{
+			FunctionIndex = *Found;
+		}
+		else
+		{
+			FunctionIndex = Functions.AddDefaulted();
+			Functions[FunctionIndex].Name = Name;
+			Functions[FunctionIndex].DefinitionLine = DefinitionLine;
+			FunctionIndexByKey.Add(FunctionKey, FunctionIndex);
+		}
+
+		const int32 ParentNode = FunctionStack.Num() > 0 ? FunctionStack.Last().NodeIndex : INDEX_NONE;
+		const TPair<int32, int32> NodeKey(ParentNode, FunctionIndex);
+		int32 NodeIndex = INDEX_NONE;
+		if (const int32* FoundNode = CallTreeChildLookup.Find(NodeKey))
+		{
+			NodeIndex = *FoundNode;
+		}
+		else
+		{
+			NodeIndex = CallTree.AddDefaulted();
+			CallTree[NodeIndex].Parent = ParentNode;
+			CallTree[NodeIndex].FunctionIndex = FunctionIndex;
+			CallTreeChildLookup.Add(NodeKey, NodeIndex);
+		}
+
+		FFunctionStats& Stats = Functions[FunctionIndex];
+		Stats.HitCount++;
+		Stats.ActiveDepth++;
+		CallTree[NodeIndex].HitCount++;
+
+		FFunctionFrame& Frame = FunctionStack.AddDefaulted_GetRef();
+		Frame.NodeIndex = NodeIndex;
+		Frame.FunctionIndex = FunctionIndex;
+		Frame.StartCycles = FPlatformTime::Cycles64();
+	}
+
+	void FScriptProfiler::ExitFunction()
+	{
+		if (FunctionStack.Num() == 0)
+		{
+			return;
+		}
+
+		const uint64 EndCycles = FPlatformTime::Cycles64();
+		const FFunctionFrame Frame = FunctionStack.Pop();
+		const uint64 Elapsed = EndCycles - Frame.StartCycles;
+		const uint64 Exclusive = Elapsed > Frame.ChildCycles ? Elapsed - Frame.ChildCycles : 0;
+
+		FFunctionStats& Stats = Functions[Frame.FunctionIndex];
+		Stats.ExclusiveCycles += Exclusive;
+		if (--Stats.ActiveDepth == 0)
+		{
+			Stats.InclusiveCycles += Elapsed;
+		}
+		CallTree[Frame.NodeIndex].ExclusiveCycles += Exclusive;
+
+		if (FunctionStack.Num() > 0)
+		{
+			FunctionStack.Last().ChildCycles += Elapsed;
+		}
+
+		if (TraceEvents.Num() < MaxTraceEvents)
+		{
+			FTraceEvent& Event = TraceEvents.AddDefaulted_GetRef();
+			Event.FunctionIndex = Frame.FunctionIndex;
+			Event.StartCycles = Frame.StartCycles;
+			Event.DurationCycles = Elapsed;
+			Event.Depth = FunctionStack.Num();
+		}
+		else
+		{
+			bTraceTruncated = true;
+		}
+	}
+
+	void FScriptProfiler::EnterStatement(int32 Line)
+	{
+		FLineStats& Stats = Lines.FindOrAdd(Line);
+		Stats.Line = Line;
+		Stats.HitCount++;
+		Stats.ActiveDepth++;
+
+		FStatementFrame& Frame = StatementStack.AddDefaulted_GetRef();
+		Frame.Line = Line;
+		Frame.StartCycles = FPlatformTime::Cycles64();
+	}
+
+	void FScriptProfiler::ExitStatement()
+	{
+		if (StatementStack.Num() == 0)
+		{
+			return;
+		}
+
+		const uint64 EndCycles = FPlatformTime::Cycles64();
+		const FStatementFrame Frame = StatementStack.Pop();
+		const uint64 Elapsed = EndCycles - Frame.StartCycles;
+
+		// 중첩 문장(블록 내부, 호출된 spell의 본문 포함)의 시간은 exclusive에서 제외
+		FLineStats& Stats = Lines.FindChecked(Frame.Line);
+		Stats.ExclusiveCycles += Elapsed > Frame.ChildCycles ? Elapsed - Frame.ChildCycles : 0;
+		if (--Stats.ActiveDepth == 0)
+		{
+			Stats.InclusiveCycles += Elapsed;
+		}
+
+		if (StatementStack.Num() > 0)
+		{
+			StatementStack.Last().ChildCycles += Elapsed;
+		}
+	}
+
+	TArray<FScriptProfiler::FLineStats> FScriptProfiler::GetLineStats() const
+	{
+		TArray<FLineStats> Result;
+		Lines.GenerateValueArray(Result);
+		Result.Sort([](const FLineStats& A, const FLineStats& B) { return A.Line < B.Line; });
+		return Result;
+	}
+
+	double FScriptProfiler::CyclesToMilliseconds(uint64 Cycles)
+	{
+		return FPlatformTime::ToMilliseconds64(Cycles);
+	}
+
+	FString FScriptProfiler::BuildStackPath(int32 NodeIndex) const
+	{
+		TArray<int32, TInlineAllocator<32>> Path;
+		for (int32 Node = NodeIndex; Node != INDEX_NONE; Node = CallTree[Node].Parent)
+		{
+			Path.Add(CallTree[Node].FunctionIndex);
+		}
+
+		TStringBuilder<256> Builder;
+		Builder.Append(ScriptName);
+		for (int32 i = Path.Num() - 1; i >= 0; --i)
+		{
+			Builder.AppendChar(TEXT(';'));
+			Builder.Append(GetFrameLabel(Path[i]));
+		}
+		return FString(Builder.ToString());
+	}
+
+	FString FScriptProfiler::GetFrameLabel(int32 FunctionIndex) const
+	{
+		// 스크립트 spell은 "이름:정의 라인", 네이티브 spell은 이름만
+		const FFunctionStats& Stats = Functions[FunctionIndex];
+		return Stats.DefinitionLine > 0 ? FString::Printf(TEXT("%s:%d"), *Stats.Name, Stats.DefinitionLine) : Stats.Name;
+	}
+
+	FString FScriptProfiler::ExportCollapsedStacks() const
+	{
+		// 스크립트명;spell;spell ... exclusive 마이크로초
+		FString Result;
+		for (int32 NodeIndex = 0; NodeIndex < CallTree.Num(); ++NodeIndex)
+		{
+			const uint64 Micros = static_cast<uint64>(CyclesToMilliseconds(CallTree[NodeIndex].ExclusiveCycles) * 1000.0);
+			if (Micros == 0)
+			{
+				continue;
+			}
+			Result += FString::Printf(TEXT("%s %llu\n"), *BuildStackPath(NodeIndex), Micros);
+		}
+		return Result;
+	}
+
+	FString FScriptProfiler::ExportChromeTrace() const
+	{
+		// Trace Event Format: Complete event("X"), 시간 단위는 마이크로초
+		FString Result = TEXT("{\"traceEvents\":[\n");
+		const FString EscapedScript = ScriptName.ReplaceCharWithEscapedChar();
+		for (int32 i = 0; i < TraceEvents.Num(); ++i)
+		{
+			const FTraceEvent& Event = TraceEvents[i];
+			const FFunctionStats& Stats = Functions[Event.FunctionIndex];
+			const double StartMicros = CyclesToMilliseconds(Event.StartCycles - BaseCycles) * 1000.0;
+			const double DurationMicros = CyclesToMilliseconds(Event.DurationCycles) * 1000.0;
+
+			Result += FString::Printf(
+				TEXT("%s{\"name\":\"%s\",\"cat\":\"MagicScript\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":0,\"args\":{\"script\":\"%s\",\"line\":%d,\"depth\":%d}}"),
+				i > 0 ? TEXT(",\n") : TEXT(""),
+				*GetFrameLabel(Event.FunctionIndex).ReplaceCharWithEscapedChar(), StartMicros, DurationMicros,
+				*EscapedScript, Stats.DefinitionLine, Event.Depth);
+		}
+		Result += FString::Printf(TEXT("\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"script\":\"%s\",\"truncated\":%s}}\n"),
+			*EscapedScript, bTraceTruncated ? TEXT("true") : TEXT("false"));
+		return Result;
+	}
+
+	bool FScriptProfiler::SaveToFile(const FString& FilePath, EScriptProfileFormat Format) const
+	{
+		const FString Content = (Format == EScriptProfileFormat::ChromeTrace) ? ExportChromeTrace() : ExportCollapsedStacks();
+		return FFileHelper::SaveStringToFile(Content, *FilePath);
+	}
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace MagicScript
+{
+	// 프로파일 내보내기 형식
+	enum class EScriptProfileFormat : uint8
+	{
+		CollapsedStacks,  // flame graph 도구용 "a;b;c 123" 형식 (마이크로초)
+		ChromeTrace       // chrome://tracing / Perfetto 용 JSON
+	};
+
+	/**
+	 * 스크립트 프로파일러
+	 * - 인터프리터에 연결되어 있을 때만 동작 (연결되지 않으면 포인터 검사 비용만 발생)
+	 * - spell 별 호출 횟수, inclusive/exclusive 시간
+	 * - 소스 라인 별 실행 횟수, inclusive/exclusive 시간
+	 * - 호출 트리(collapsed stacks)와 호출 이벤트(Chrome trace)로 내보내기
+	 */
+	class MAGICSCRIPTCORE_API FScriptProfiler
+	{
+	public:
+		struct FFunctionStats
+		{
+			FString Name;
+			int32 DefinitionLine = 0;
+			int64 HitCount = 0;
+			uint64 InclusiveCycles = 0;
+			uint64 ExclusiveCycles = 0;
+			int32 ActiveDepth = 0;  // 재귀 중 inclusive 시간 중복 집계 방지
+		};
+
+		struct FLineStats
+		{
+			int32 Line = 0;
+			int64 HitCount = 0;
+			uint64 InclusiveCycles = 0;
+			uint64 ExclusiveCycles = 0;
+			int32 ActiveDepth = 0;
+		};
+
+		// RAII: spell 호출 구간 (Profiler가 null이면 아무것도 하지 않음)
+		struct FFunctionScope
+		{
+			FFunctionScope(FScriptProfiler* InProfiler, const FString& Name, int32 DefinitionLine)
+				: Profiler(InProfiler)
+			{
+				if (Profiler)
+				{
+					Profiler->EnterFunction(Name, DefinitionLine);
+				}
+			}
+			~FFunctionScope()
+			{
+				if (Profiler)
+				{
+					Profiler->ExitFunction();
+				}
+			}
+			FScriptProfiler* Profiler;
+		};
+
+		// RAII: 문장 실행 구간
+		struct FStatementScope
+		{
+			FStatementScope(FScriptProfiler* InProfiler, int32 Line)
+				: Profiler(InProfiler)
+			{
+				if (Profiler)
+				{
+					Profiler->EnterStatement(Line);
+				}
+			}
+			~FStatementScope()
+			{
+				if (Profiler)
+				{
+					Profiler->ExitStatement();
+				}
+			}
+			FScriptProfiler* Profiler;
+		};
+
+		explicit FScriptProfiler(const FString& InScriptName);
+
+		void Reset();
+
+		void EnterFunction(const FString& Name, int32 DefinitionLine);
+		void ExitFunction();
+		void EnterStatement(int32 Line);
+		void ExitStatement();
+
+		const FString& GetScriptName() const { return ScriptName; }
+		const TArray<FFunctionStats>& GetFunctionStats() const { return Functions; }
+
+		// 라인 번호 순으로 정렬된 라인 통계
+		TArray<FLineStats> GetLineStats() const;
+
+		static double CyclesToMilliseconds(uint64 Cycles);
+
+		FString ExportCollapsedStacks() const;
+		FString ExportChromeTrace() const;
+		bool SaveToFile(const FString& FilePath, EScriptProfileFormat Format) const;
+
+	private:
+		// 호출 트리 노드 (같은 부모 아래 같은 spell은 하나의 노드로 합침)
+		struct FCallTreeNode
+		{
+			int32 Parent = INDEX_NONE;
+			int32 FunctionIndex = INDEX_NONE;
+			int64 HitCount = 0;
+			uint64 ExclusiveCycles = 0;
+		};
+
+		struct FFunctionFrame
+		{
+			int32 NodeIndex = INDEX_NONE;
+			int32 FunctionIndex = INDEX_NONE;
+			uint64 StartCycles = 0;
+			uint64 ChildCycles = 0;
+		};
+
+		struct FStatementFrame
+		{
+			int32 Line = 0;
+			uint64 StartCycles = 0;
+			uint64 ChildCycles = 0;
+		};
+
+		// Chrome trace 용 호출 이벤트 (개수 제한)
+		struct FTraceEvent
+		{
+			int32 FunctionIndex = INDEX_NONE;
+			uint64 StartCycles = 0;
+			uint64 DurationCycles = 0;
+			int32 Depth = 0;
+		};
+
+		static constexpr int32 MaxTraceEvents = 200000;
+
+		FString ScriptName;
+		uint64 BaseCycles = 0;
+
+		TArray<FFunctionStats> Functions;
+		TMap<TPair<FString, int32>, int32> FunctionIndexByKey;  // (이름, 정의 라인) → spell (익명 spell 구분용)
+		TMap<int32, FLineStats> Lines;
+
+		TArray<FCallTreeNode> CallTree;
+		TMap<TPair<int32, int32>, int32> CallTreeChildLookup;  // (부모 노드, spell) → 노드
+
+		TArray<FFunctionFrame> FunctionStack;
+		TArray<FStatementFrame> StatementStack;
+
+		TArray<FTraceEvent> TraceEvents;
+		bool bTraceTruncated = false;
+
+		FString BuildStackPath(int32 NodeIndex) const;
+		FString GetFrameLabel(int32 FunctionIndex) const;
+	};
+}
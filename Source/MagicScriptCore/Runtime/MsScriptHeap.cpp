@@ -0,0 +1,282 @@
+#include "MagicScriptCore/Runtime/MsScriptHeap.h"
+#include "Misc/ScopeLock.h"
+
+namespace MagicScript
+{
+	namespace
+	{
+		thread_local FScriptHeap* GCurrentScriptHeap = nullptr;
+
+		// 노드 헤더와 값을 한 블록에 만들고 현재 힙에 등록, 마지막 참조가 사라질 때 등록을 해제하는 shared 포인터 생성
+		template <typename T>
+		TSharedPtr<T> MakeTracked(EScriptHeapCategory Category)
+		{
+			constexpr SIZE_T NodeOffset = GetScriptHeapNodeOffset<T>();
+			uint8* Block = static_cast<uint8*>(FMemory::Malloc(NodeOffset + sizeof(T), FMath::Max(alignof(T), alignof(FScriptHeapNode))));
+			FScriptHeapNode* Node = new (Block) FScriptHeapNode();
+			T* Raw = new (Block + NodeOffset) T();
+			Node->Object = Raw;
+			Node->Category = Category;
+
+			// 값이 인터프리터보다 오래 살아도 안전하도록 힙을 참조로 붙잡아 둔다
+			TSharedPtr<FScriptHeap, ESPMode::ThreadSafe> HeapRef;
+			if (FScriptHeap* Heap = FScriptHeap::GetCurrent())
+			{
+				HeapRef = Heap->AsShared();
+				Heap->LinkNode(*Node, static_cast<int64>(sizeof(T)));
+			}
+
+			return MakeShareable(Raw, [HeapRef, Node](T* Ptr)
+			{
+				if (HeapRef.IsValid())
+				{
+					HeapRef->UnlinkNode(*Node);
+				}
+				Ptr->~T();
+				Node->~FScriptHeapNode();
+				FMemory::Free(Node);
+			});
+		}
+
+		template <typename T>
+		TSharedPtr<T> AdoptTracked(const TSharedPtr<T>& Container, TSharedPtr<T> (*MakeContainer)())
+		{
+			if (!Container.IsValid() || IsScriptHeapContainer(Container.Get()))
+			{
+				return Container;
+			}
+
+			TSharedPtr<T> Adopted = MakeContainer();
+			*Adopted = *Container;
+			NotifyContainerRebuilt(Adopted);
+			return Adopted;
+		}
+	}
+
+	const TCHAR* LexToString(EScriptHeapCategory Category)
+	{
+		switch (Category)
+		{
+		case EScriptHeapCategory::String:      return TEXT("String");
+		case EScriptHeapCategory::Array:       return TEXT("Array");
+		case EScriptHeapCategory::Object:      return TEXT("Object");
+		case EScriptHeapCategory::Map:         return TEXT("Map");
+		case EScriptHeapCategory::Set:         return TEXT("Set");
+		case EScriptHeapCategory::Function:    return TEXT("Function");
+		case EScriptHeapCategory::Environment: return TEXT("Environment");
+		case EScriptHeapCategory::Native:      return TEXT("Native");
+		default:                               return TEXT("Unknown");
+		}
+	}
+
+	FScriptHeap::FScriptHeap()
+	{
+		for (std::atomic<int64>& Bytes : CategoryBytes)
+		{
+			Bytes.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	FScriptHeap* FScriptHeap::GetCurrent()
+	{
+		return GCurrentScriptHeap;
+	}
+
+	FScriptHeap::FScope::FScope(FScriptHeap* InHeap)
+		: Heap(InHeap)
+		, Previous(GCurrentScriptHeap)
+	{
+		GCurrentScriptHeap = InHeap;
+		if (Heap)
+		{
+			Heap->ActiveScopeCount.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	FScriptHeap::FScope::~FScope()
+	{
+		if (Heap)
+		{
+			Heap->ActiveScopeCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+		GCurrentScriptHeap = Previous;
+	}
+
+	void FScriptHeap::Allocate(EScriptHeapCategory Category, int64 Bytes)
+	{
+		AllocationCount.fetch_add(1, std::memory_order_relaxed);
+		Resize(Category, 0, Bytes);
+	}
+
+	void FScriptHeap::Release(EScriptHeapCategory Category, int64 Bytes)
+	{
+		Resize(Category, Bytes, 0);
+	}
+
+	void FScriptHeap::Resize(EScriptHeapCategory Category, int64 OldBytes, int64 NewBytes)
+	{
+		const int64 Delta = NewBytes - OldBytes;
+		if (Delta == 0)
+		{
+			return;
+		}
+
+		CategoryBytes[static_cast<int32>(Category)].fetch_add(Delta, std::memory_order_relaxed);
+		const int64 NewLive = LiveBytes.fetch_add(Delta, std::memory_order_relaxed) + Delta;
+		if (Delta < 0)
+		{
+			return;
+		}
+
+		int64 Peak = PeakBytes.load(std::memory_order_relaxed);
+		while (NewLive > Peak && !PeakBytes.compare_exchange_weak(Peak, NewLive, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	void FScriptHeap::ResetPeak()
+	{
+		PeakBytes.store(LiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+
+	void FScriptHeap::LinkNode(FScriptHeapNode& Node, int64 StorageBytes)
+	{
+		Node.Heap = this;
+		Node.StorageBytes = StorageBytes;
+		Node.PayloadBytes = 0;
+		{
+			FScopeLock Lock(&NodeLock);
+			Node.Prev = nullptr;
+			Node.Next = NodeHead;
+			if (NodeHead)
+			{
+				NodeHead->Prev = &Node;
+			}
+			NodeHead = &Node;
+			++NodeCount;
+		}
+		Allocate(Node.Category, StorageBytes);
+	}
+
+	void FScriptHeap::UnlinkNode(FScriptHeapNode& Node)
+	{
+		{
+			FScopeLock Lock(&NodeLock);
+			if (Node.Prev)
+			{
+				Node.Prev->Next = Node.Next;
+			}
+			else
+			{
+				NodeHead = Node.Next;
+			}
+			if (Node.Next)
+			{
+				Node.Next->Prev = Node.Prev;
+			}
+			Node.Prev = nullptr;
+			Node.Next = nullptr;
+			--NodeCount;
+
+			if (bRecordUnlinkedNodes)
+			{
+				UnlinkedNodes.Add(Node.Object);
+			}
+		}
+		Release(Node.Category, Node.StorageBytes + Node.PayloadBytes);
+		Node.Heap = nullptr;
+	}
+
+	void FScriptHeap::ResizeNode(FScriptHeapNode& Node, int64 StorageBytes, int64 PayloadBytes)
+	{
+		// 노드 크기는 값을 변경하는 스레드만 쓰고, 소멸은 마지막 참조가 사라진 뒤라 겹치지 않음
+		Resize(Node.Category, Node.StorageBytes + Node.PayloadBytes, StorageBytes + PayloadBytes);
+		Node.StorageBytes = StorageBytes;
+		Node.PayloadBytes = PayloadBytes;
+	}
+
+	int64 GetContainerPayloadBytes(const TArray<FValue>& Container)
+	{
+		int64 Total = 0;
+		for (const FValue& Elem : Container)
+		{
+			Total += GetValuePayloadBytes(Elem);
+		}
+		return Total;
+	}
+
+	int64 GetContainerPayloadBytes(const TMap<FString, FValue>& Container)
+	{
+		int64 Total = 0;
+		for (const TPair<FString, FValue>& Pair : Container)
+		{
+			Total += Pair.Key.GetAllocatedSize() + GetValuePayloadBytes(Pair.Value);
+		}
+		return Total;
+	}
+
+	int64 GetContainerPayloadBytes(const FValueMap& Container)
+	{
+		int64 Total = 0;
+		for (const TPair<FValue, FValue>& Pair : Container)
+		{
+			Total += GetValuePayloadBytes(Pair.Key) + GetValuePayloadBytes(Pair.Value);
+		}
+		return Total;
+	}
+
+	int64 GetContainerPayloadBytes(const FValueSet& Container)
+	{
+		int64 Total = 0;
+		for (const FValue& Elem : Container)
+		{
+			Total += GetValuePayloadBytes(Elem);
+		}
+		return Total;
+	}
+
+	TSharedPtr<TArray<FValue>> MakeScriptArray()
+	{
+		return MakeTracked<TArray<FValue>>(EScriptHeapCategory::Array);
+	}
+
+	TSharedPtr<TMap<FString, FValue>> MakeScriptObject()
+	{
+		return MakeTracked<TMap<FString, FValue>>(EScriptHeapCategory::Object);
+	}
+
+	TSharedPtr<FValueMap> MakeScriptMap()
+	{
+		return MakeTracked<FValueMap>(EScriptHeapCategory::Map);
+	}
+
+	TSharedPtr<FValueSet> MakeScriptSet()
+	{
+		return MakeTracked<FValueSet>(EScriptHeapCategory::Set);
+	}
+
+	TSharedPtr<FFunctionValue> MakeScriptFunction()
+	{
+		return MakeTracked<FFunctionValue>(EScriptHeapCategory::Function);
+	}
+
+	TSharedPtr<TArray<FValue>> AdoptScriptContainer(const TSharedPtr<TArray<FValue>>& Container)
+	{
+		return AdoptTracked(Container, &MakeScriptArray);
+	}
+
+	TSharedPtr<TMap<FString, FValue>> AdoptScriptContainer(const TSharedPtr<TMap<FString, FValue>>& Container)
+	{
+		return AdoptTracked(Container, &MakeScriptObject);
+	}
+
+	TSharedPtr<FValueMap> AdoptScriptContainer(const TSharedPtr<FValueMap>& Container)
+	{
+		return AdoptTracked(Container, &MakeScriptMap);
+	}
+
+	TSharedPtr<FValueSet> AdoptScriptContainer(const TSharedPtr<FValueSet>& Container)
+	{
+		return AdoptTracked(Container, &MakeScriptSet);
+	}
+}
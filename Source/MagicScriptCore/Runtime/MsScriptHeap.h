@@ -0,0 +1,234 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "MagicScriptCore/Core/MsValue.h"
+#include <atomic>
+
+namespace MagicScript
+{
+	class FScriptCycleCollector;
+
+	// 스크립트 힙 메모리 분류
+	enum class EScriptHeapCategory : uint8
+	{
+		String,       // 로프 노드 (연결된 문자열)
+		Array,
+		Object,
+		Map,
+		Set,
+		Function,     // spell / 화살표 함수 값
+		Environment,  // 스코프 변수 테이블
+		Native,       // 네이티브 함수가 선언한 임시 비용 (SpaceCostBytes)
+		Count
+	};
+
+	MAGICSCRIPTCORE_API const TCHAR* LexToString(EScriptHeapCategory Category);
+
+	class FScriptHeap;
+
+	/**
+	 * 힙에 등록된 컨테이너/환경의 노드 헤더
+	 * - 컨테이너는 MakeScript*가 같은 메모리 블록 앞쪽에, 환경은 멤버로 들고 있음
+	 * - 크기 기록을 노드에 직접 두어 원소 변경 시 테이블 조회나 잠금 없이 갱신
+	 * - 힙의 침입형(intrusive) 리스트로 연결되어 순환 수집기가 전체 노드를 순회
+	 * - Magic으로 헤더가 없는 컨테이너(호스트가 MakeShared로 만든 것)를 구분
+	 */
+	struct FScriptHeapNode
+	{
+		static constexpr uint32 ValidMagic = 0x4D534850;  // 'MSHP'
+
+		FScriptHeapNode() = default;
+		~FScriptHeapNode() { Magic = 0; }
+		UE_NONCOPYABLE(FScriptHeapNode);
+
+		uint32 Magic = ValidMagic;
+		const void* Object = nullptr;
+		FScriptHeap* Heap = nullptr;  // 추적하지 않는 노드면 null
+		EScriptHeapCategory Category = EScriptHeapCategory::Array;
+		int64 StorageBytes = 0;
+		int64 PayloadBytes = 0;
+		FScriptHeapNode* Prev = nullptr;
+		FScriptHeapNode* Next = nullptr;
+	};
+
+	/**
+	 * 인터프리터 단위 스크립트 힙 계측기
+	 * - 스크립트가 만든 컨테이너/환경/로프 노드의 실제 할당 크기(GetAllocatedSize)를 생성/변경/소멸 시점에 반영
+	 * - 크기 갱신은 노드 헤더와 원자 연산만 사용 (잠금/테이블 조회 없음)
+	 * - 노드 등록/해제는 생성/소멸 시 한 번, 짧은 잠금 아래 O(1) 리스트 연결/분리
+	 * - 현재/최대 사용량과 분류별 사용량을 바로 읽을 수 있음
+	 * - 스코프가 끝나 값이 해제되면 소멸자에서 차감되므로 현재 사용량이 정확히 돌아옴
+	 * - 실행 중인 힙은 스레드 로컬(FScope)로 전달되어 빌트인도 인자 없이 추적 컨테이너를 만들 수 있음
+	 */
+	class MAGICSCRIPTCORE_API FScriptHeap : public TSharedFromThis<FScriptHeap, ESPMode::ThreadSafe>
+	{
+	public:
+		static constexpr int32 NumCategories = static_cast<int32>(EScriptHeapCategory::Count);
+
+		FScriptHeap();
+
+		// 현재 스레드에서 실행 중인 힙 (없으면 null, 이때 만들어진 값은 추적하지 않음)
+		static FScriptHeap* GetCurrent();
+
+		// 스코프 동안 현재 힙을 교체 (인터프리터 진입점에서 사용)
+		class MAGICSCRIPTCORE_API FScope
+		{
+		public:
+			explicit FScope(FScriptHeap* InHeap);
+			~FScope();
+
+		private:
+			FScriptHeap* Heap;
+			FScriptHeap* Previous;
+		};
+
+		// 이 힙으로 스크립트가 실행 중인지 (수집기는 실행 중에 돌지 않음)
+		bool IsExecuting() const { return ActiveScopeCount.load(std::memory_order_relaxed) > 0; }
+
+		void Allocate(EScriptHeapCategory Category, int64 Bytes);
+		void Release(EScriptHeapCategory Category, int64 Bytes);
+		void Resize(EScriptHeapCategory Category, int64 OldBytes, int64 NewBytes);
+
+		int64 GetLiveBytes() const { return LiveBytes.load(std::memory_order_relaxed); }
+		int64 GetLiveBytes(EScriptHeapCategory Category) const { return CategoryBytes[static_cast<int32>(Category)].load(std::memory_order_relaxed); }
+		int64 GetPeakBytes() const { return PeakBytes.load(std::memory_order_relaxed); }
+		int64 GetAllocationCount() const { return AllocationCount.load(std::memory_order_relaxed); }
+
+		// 최대 사용량을 현재 사용량으로 되돌림 (실행 단위 측정 시작)
+		void ResetPeak();
+
+		// 노드 등록/해제 (Object, Category를 채운 노드를 생성 시 등록, 소멸 시 해제하면서 기록된 크기를 차감)
+		void LinkNode(FScriptHeapNode& Node, int64 StorageBytes);
+		void UnlinkNode(FScriptHeapNode& Node);
+
+		// 노드 크기 갱신 (StorageBytes = 컨테이너 자체 + 버퍼, PayloadBytes = 원소 문자열 본문)
+		void ResizeNode(FScriptHeapNode& Node, int64 StorageBytes, int64 PayloadBytes);
+
+	private:
+		friend class FScriptCycleCollector;
+
+		std::atomic<int64> LiveBytes{0};
+		std::atomic<int64> PeakBytes{0};
+		std::atomic<int64> AllocationCount{0};
+		std::atomic<int64> CategoryBytes[NumCategories];
+		std::atomic<int32> ActiveScopeCount{0};
+
+		// 값이 다른 스레드에서 해제될 수 있으므로 노드 리스트 연결은 잠금으로 보호
+		FCriticalSection NodeLock;
+		FScriptHeapNode* NodeHead = nullptr;
+		int32 NodeCount = 0;
+
+		// 순환 수집 주기 동안 해제된 노드 (수집기가 스냅샷의 노드가 아직 살아 있는지 확인)
+		bool bRecordUnlinkedNodes = false;
+		TSet<const void*> UnlinkedNodes;
+	};
+
+	// 값이 컨테이너 밖에 따로 들고 있는 문자열 본문 크기 (로프는 노드가 직접 추적)
+	inline int64 GetValuePayloadBytes(const FValue& Value)
+	{
+		return Value.String.GetAllocatedSize();
+	}
+
+	inline int64 GetKeyPayloadBytes(const FString& Key) { return Key.GetAllocatedSize(); }
+	inline int64 GetKeyPayloadBytes(const FValue& Key) { return GetValuePayloadBytes(Key); }
+
+	// 키에 값을 넣기 전에 호출 - 넣은 뒤 늘어날 문자열 본문 크기 (기존 키면 값 차이만)
+	template <typename MapType, typename KeyType>
+	int64 GetAssignPayloadDelta(const MapType& Map, const KeyType& Key, const FValue& NewValue)
+	{
+		if (const FValue* Existing = Map.Find(Key))
+		{
+			return GetValuePayloadBytes(NewValue) - GetValuePayloadBytes(*Existing);
+		}
+		return GetKeyPayloadBytes(Key) + GetValuePayloadBytes(NewValue);
+	}
+
+	// 컨테이너 자체 + 원소 버퍼/해시 크기
+	template <typename ContainerType>
+	int64 GetContainerStorageBytes(const ContainerType& Container)
+	{
+		return static_cast<int64>(sizeof(ContainerType)) + static_cast<int64>(Container.GetAllocatedSize());
+	}
+
+	// 원소 문자열 본문 합계 (O(n), 새로 채운 컨테이너에만 사용)
+	MAGICSCRIPTCORE_API int64 GetContainerPayloadBytes(const TArray<FValue>& Container);
+	MAGICSCRIPTCORE_API int64 GetContainerPayloadBytes(const TMap<FString, FValue>& Container);
+	MAGICSCRIPTCORE_API int64 GetContainerPayloadBytes(const FValueMap& Container);
+	MAGICSCRIPTCORE_API int64 GetContainerPayloadBytes(const FValueSet& Container);
+
+	// 노드 헤더가 붙은 스크립트 값 생성 (현재 힙이 없으면 헤더만 있고 추적하지 않음)
+	MAGICSCRIPTCORE_API TSharedPtr<TArray<FValue>> MakeScriptArray();
+	MAGICSCRIPTCORE_API TSharedPtr<TMap<FString, FValue>> MakeScriptObject();
+	MAGICSCRIPTCORE_API TSharedPtr<FValueMap> MakeScriptMap();
+	MAGICSCRIPTCORE_API TSharedPtr<FValueSet> MakeScriptSet();
+	MAGICSCRIPTCORE_API TSharedPtr<FFunctionValue> MakeScriptFunction();
+
+	// 헤더가 없는 컨테이너는 MakeScript* 컨테이너로 복사해서 반환, 이미 스크립트 컨테이너면 그대로 (FValue::From*에서 사용)
+	MAGICSCRIPTCORE_API TSharedPtr<TArray<FValue>> AdoptScriptContainer(const TSharedPtr<TArray<FValue>>& Container);
+	MAGICSCRIPTCORE_API TSharedPtr<TMap<FString, FValue>> AdoptScriptContainer(const TSharedPtr<TMap<FString, FValue>>& Container);
+	MAGICSCRIPTCORE_API TSharedPtr<FValueMap> AdoptScriptContainer(const TSharedPtr<FValueMap>& Container);
+	MAGICSCRIPTCORE_API TSharedPtr<FValueSet> AdoptScriptContainer(const TSharedPtr<FValueSet>& Container);
+
+	// MakeScript*로 만든 컨테이너 앞쪽의 노드 헤더 위치
+	template <typename ContainerType>
+	constexpr SIZE_T GetScriptHeapNodeOffset()
+	{
+		return Align(sizeof(FScriptHeapNode), alignof(ContainerType));
+	}
+
+	// MakeScript*로 만든 컨테이너인지 (헤더 자리의 Magic과 역참조 포인터가 모두 맞아야 함)
+	// MakeShared로 만든 컨테이너 앞쪽은 같은 할당의 참조 컨트롤러라 읽어도 안전
+	template <typename ContainerType>
+	bool IsScriptHeapContainer(const ContainerType* Container)
+	{
+		if (!Container)
+		{
+			return false;
+		}
+		const FScriptHeapNode* Node = reinterpret_cast<const FScriptHeapNode*>(
+			reinterpret_cast<const uint8*>(Container) - GetScriptHeapNodeOffset<ContainerType>());
+		return Node->Magic == FScriptHeapNode::ValidMagic && Node->Object == Container;
+	}
+
+	// 컨테이너 포인터로 같은 블록의 노드 헤더를 찾음 (헤더가 없는 컨테이너에 쓰면 메모리를 망가뜨리므로 항상 확인)
+	template <typename ContainerType>
+	FScriptHeapNode& GetScriptHeapNode(const ContainerType* Container)
+	{
+		check(IsScriptHeapContainer(Container));
+		return *reinterpret_cast<FScriptHeapNode*>(
+			reinterpret_cast<uint8*>(const_cast<ContainerType*>(Container)) - GetScriptHeapNodeOffset<ContainerType>());
+	}
+
+	// 원소 추가/삭제/교체 후 호출 - 버퍼 크기를 다시 읽고 문자열 본문 변화량을 더함 (O(1), 잠금 없음)
+	template <typename ContainerType>
+	void NotifyContainerChanged(const TSharedPtr<ContainerType>& Container, int64 PayloadDelta = 0)
+	{
+		if (!Container.IsValid())
+		{
+			return;
+		}
+
+		FScriptHeapNode& Node = GetScriptHeapNode(Container.Get());
+		if (Node.Heap)
+		{
+			Node.Heap->ResizeNode(Node, GetContainerStorageBytes(*Container), FMath::Max<int64>(0, Node.PayloadBytes + PayloadDelta));
+		}
+	}
+
+	// 한꺼번에 채우거나 비운 뒤 호출 - 원소 전체를 다시 집계 (O(n))
+	template <typename ContainerType>
+	void NotifyContainerRebuilt(const TSharedPtr<ContainerType>& Container)
+	{
+		if (!Container.IsValid())
+		{
+			return;
+		}
+
+		FScriptHeapNode& Node = GetScriptHeapNode(Container.Get());
+		if (Node.Heap)
+		{
+			Node.Heap->ResizeNode(Node, GetContainerStorageBytes(*Container), GetContainerPayloadBytes(*Container));
+		}
+	}
+}
@@ -0,0 +1,80 @@
+#include "MagicScriptCore/Runtime/MsScriptHost.h"
+#include "MagicScriptCore/Logging/MsLogging.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace MagicScript
+{
+	FBufferedScriptHost::FBufferedScriptHost(const FString& InRootDir, bool bInEchoToLog)
+		: RootDir(InRootDir)
+		, bEchoToLog(bInEchoToLog)
+	{
+	}
+
+	void FBufferedScriptHost::AddScriptLog(const EScriptLogType ScriptLogType, const FString& ScriptLogMessage,
+		const FName ScriptId, const int32 Line, const int32 Column)
+	{
+		if (!ShouldCaptureScriptLog(ScriptLogType))
+		{
+			return;
+		}
+
+		if (bEchoToLog)
+		{
+			const FString Location = ScriptId.IsNone() ? FString() : FString::Printf(TEXT("%s(%d:%d) "), *ScriptId.ToString(), Line, Column);
+			switch (ScriptLogType)
+			{
+			case EScriptLogType::Error:   UE_LOG(LogMagicScript, Error, TEXT("%s%s"), *Location, *ScriptLogMessage); break;
+			case EScriptLogType::Warning: UE_LOG(LogMagicScript, Warning, TEXT("%s%s"), *Location, *ScriptLogMessage); break;
+			default:                      UE_LOG(LogMagicScript, Display, TEXT("%s%s"), *Location, *ScriptLogMessage); break;
+			}
+		}
+
+		FScriptLog Log;
+		Log.LogType = ScriptLogType;
+		Log.LogMessage = ScriptLogMessage;
+		Log.ScriptId = ScriptId;
+		Log.Line = Line;
+		Log.Column = Column;
+
+		FScopeLock Lock(&LogLock);
+		ScriptLogs.Add(MoveTemp(Log));
+		LogCounts[static_cast<uint8>(ScriptLogType)]++;
+	}
+
+	bool FBufferedScriptHost::ShouldCaptureScriptLog(const EScriptLogType ScriptLogType) const
+	{
+		return static_cast<uint8>(ScriptLogType) >= static_cast<uint8>(MinScriptLogType);
+	}
+
+	bool FBufferedScriptHost::LoadScriptSource(const FString& ScriptPath, FString& OutSource)
+	{
+		const FString FullPath = FPaths::IsRelative(ScriptPath) ? FPaths::Combine(RootDir, ScriptPath) : ScriptPath;
+		if (!FFileHelper::LoadFileToString(OutSource, *FullPath))
+		{
+			AddScriptLog(EScriptLogType::Warning, FString::Printf(TEXT("MagicScript: File not found: %s"), *FullPath));
+			return false;
+		}
+		return true;
+	}
+
+	TArray<FScriptLog> FBufferedScriptHost::GetScriptLogs() const
+	{
+		FScopeLock Lock(&LogLock);
+		return ScriptLogs;
+	}
+
+	int32 FBufferedScriptHost::GetLogCount(EScriptLogType ScriptLogType) const
+	{
+		FScopeLock Lock(&LogLock);
+		return LogCounts[static_cast<uint8>(ScriptLogType)];
+	}
+
+	void FBufferedScriptHost::ClearScriptLogs()
+	{
+		FScopeLock Lock(&LogLock);
+		ScriptLogs.Reset();
+		FMemory::Memzero(LogCounts);
+	}
+}
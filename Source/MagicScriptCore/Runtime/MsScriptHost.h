@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MagicScriptCore/Logging/MsLoggingEnum.h"
+
+namespace MagicScript
+{
+	/**
+	 * 스크립트 실행 호스트 인터페이스
+	 * - 파서/인터프리터/빌트인이 남기는 로그와 import 소스 로딩을 호스트에 위임
+	 * - 게임에서는 UMagicScriptInterpreterSubsystem, 헤드리스 실행에서는 FBufferedScriptHost가 구현
+	 */
+	class MAGICSCRIPTCORE_API IScriptHost
+	{
+	public:
+		virtual ~IScriptHost() = default;
+
+		// 어느 스레드에서든 호출될 수 있음
+		virtual void AddScriptLog(const EScriptLogType ScriptLogType, const FString& ScriptLogMessage,
+			const FName ScriptId = NAME_None, const int32 Line = 0, const int32 Column = 0) = 0;
+
+		// 로그가 버려질 경우 메시지 포맷을 생략하기 위한 사전 검사
+		virtual bool ShouldCaptureScriptLog(const EScriptLogType ScriptLogType) const { return true; }
+
+		// import 경로의 소스 로딩 (지원하지 않으면 false)
+		virtual bool LoadScriptSource(const FString& ScriptPath, FString& OutSource) { return false; }
+	};
+
+	/**
+	 * 로그를 메모리에 모으는 헤드리스 호스트 (월드/GameInstance 불필요)
+	 * - import는 RootDir 기준 상대 경로로 로딩
+	 * - bEchoToLog이면 LogMagicScript로도 출력
+	 */
+	class MAGICSCRIPTCORE_API FBufferedScriptHost : public IScriptHost
+	{
+	public:
+		explicit FBufferedScriptHost(const FString& InRootDir = FString(), bool bInEchoToLog = true);
+
+		virtual void AddScriptLog(const EScriptLogType ScriptLogType, const FString& ScriptLogMessage,
+			const FName ScriptId = NAME_None, const int32 Line = 0, const int32 Column = 0) override;
+		virtual bool ShouldCaptureScriptLog(const EScriptLogType ScriptLogType) const override;
+		virtual bool LoadScriptSource(const FString& ScriptPath, FString& OutSource) override;
+
+		// 이 타입 미만의 로그는 버림 (기본: 모두 기록)
+		void SetMinScriptLogType(EScriptLogType InMinType) { MinScriptLogType = InMinType; }
+
+		TArray<FScriptLog> GetScriptLogs() const;
+		int32 GetLogCount(EScriptLogType ScriptLogType) const;
+		void ClearScriptLogs();
+
+		const FString& GetRootDir() const { return RootDir; }
+
+	private:
+		FString RootDir;
+		bool bEchoToLog = true;
+		EScriptLogType MinScriptLogType = EScriptLogType::Default;
+
+		mutable FCriticalSection LogLock;
+		TArray<FScriptLog> ScriptLogs;
+		int32 LogCounts[3] = { 0, 0, 0 };
+	};
+}
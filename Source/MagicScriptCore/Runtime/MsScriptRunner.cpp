@@ -0,0 +1,151 @@
+#include "MagicScriptCore/Runtime/MsScriptRunner.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "MagicScriptCore/Core/MsAst.h"
+#include "MagicScriptCore/Core/MsEnvironment.h"
+#include "MagicScriptCore/Core/MsLexer.h"
+#include "MagicScriptCore/Core/MsParser.h"
+#include "MagicScriptCore/Logging/MsLogging.h"
+#include "MagicScriptCore/Logging/MsLoggingEnum.h"
+#include "MagicScriptCore/Logging/MsTrace.h"
+#include "MagicScriptCore/Runtime/MsInterpreter.h"
+#include "MagicScriptCore/Runtime/MsScriptHost.h"
+#include "MagicScriptCore/Util/MsArrayBuiltins.h"
+#include "MagicScriptCore/Util/MsCollectionBuiltins.h"
+#include "MagicScriptCore/Util/MsConsoleBuiltins.h"
+#include "MagicScriptCore/Util/MsMathBuiltins.h"
+#include "MagicScriptCore/Util/MsStringBuiltins.h"
+
+namespace MagicScript
+{
+	namespace
+	{
+		void LogToHost(IScriptHost* Host, const EScriptLogType Type, const FString& Message, const FString& ScriptName, int32 Line = 0, int32 Column = 0)
+		{
+			if (Host)
+			{
+				Host->AddScriptLog(Type, Message, FName(*ScriptName), Line, Column);
+				return;
+			}
+			AddScriptLog(Type, Message, Line, Column);
+		}
+	}
+
+	FScriptRunner::FScriptRunner(IScriptHost* InHost)
+		: Host(InHost)
+		, Modules(InHost,
+			[this](const FString& Path) -> TSharedPtr<FProgram>
+			{
+				FString Source;
+				if (!Host || !Host->LoadScriptSource(Path, Source))
+				{
+					LogToHost(Host, EScriptLogType::Error, FString::Printf(TEXT("MagicScript: Failed to load import: %s"), *Path), Path);
+					return nullptr;
+				}
+				return Compile(Path, Source);
+			},
+			[this](const FString& Path)
+			{
+				const TSharedPtr<FInterpreter> Interpreter = CreateInterpreter(Path, Host);
+				Interpreter->SetDefaultExecutionBudget(ExecutionBudget);
+				return Interpreter;
+			})
+	{
+	}
+
+	TSharedPtr<FInterpreter> FScriptRunner::CreateInterpreter(const FString& ScriptName, IScriptHost* Host)
+	{
+		TSharedPtr<FInterpreter> Interpreter = MakeShared<FInterpreter>();
+		Interpreter->SetScriptName(ScriptName);
+		Interpreter->SetHost(Host);
+
+		const TSharedPtr<FEnvironment> Env = Interpreter->GetGlobalEnv();
+		MsMathBuiltins::Register(Env, Host);
+		MsConsoleBuiltins::Register(Env, Host);
+		MsArrayBuiltins::Register(Env, Host);
+		MsCollectionBuiltins::Register(Env, Host);
+		MsStringBuiltins::Register(Env, Host);
+		return Interpreter;
+	}
+
+	TSharedPtr<FProgram> FScriptRunner::Compile(const FString& ScriptName, const FString& Source) const
+	{
+		// 파서가 렉서에서 토큰을 당겨 오므로 렉싱과 파싱이 한 번에 진행됨 (렉스 에러는 파서가 남김)
+		MS_TRACE_SCOPE(TEXT("Parse"), ScriptName);
+		FLexer Lexer(Source);
+		FParser Parser(Lexer, Host, ScriptName);
+		TSharedPtr<FProgram> Program = Parser.ParseProgram();
+		if (Parser.HasLexError())
+		{
+			return nullptr;
+		}
+		if (!Program.IsValid() || Parser.HasError())
+		{
+			LogToHost(Host, EScriptLogType::Error, FString::Printf(TEXT("MagicScript: Failed to parse script: %s"), *ScriptName), ScriptName);
+			return nullptr;
+		}
+		return Program;
+	}
+
+	FScriptRunResult FScriptRunner::Run(const FString& ScriptName, const FString& Source, const FString& EntryName, double EventLoopTimeoutSeconds)
+	{
+		return RunProgram(ScriptName, Compile(ScriptName, Source), EntryName, EventLoopTimeoutSeconds);
+	}
+
+	FScriptRunResult FScriptRunner::RunProgram(const FString& ScriptName, const TSharedPtr<FProgram>& Program, const FString& EntryName, double EventLoopTimeoutSeconds)
+	{
+		FScriptRunResult Result;
+		if (!Program.IsValid())
+		{
+			return Result;
+		}
+
+		MS_TRACE_SCOPE(TEXT("Run"), ScriptName);
+
+		const TSharedPtr<FInterpreter> Interpreter = CreateInterpreter(ScriptName, Host);
+		Interpreter->SetDefaultExecutionBudget(ExecutionBudget);
+		FScriptExecutionContext Context;
+		Context.Interpreter = Interpreter;
+
+		if (!Modules.Resolve(Program, Context))
+		{
+			return Result;
+		}
+		Modules.Link(Program, Interpreter->GetGlobalEnv());
+		Result.bCompiled = true;
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		Interpreter->ExecuteProgram(Program, Context);
+		if (!EntryName.IsEmpty() && !Interpreter->IsExecutionAborted())
+		{
+			Result.ReturnValue = Interpreter->CallFunctionByName(EntryName, {}, Context);
+		}
+
+		// 남은 setTimeout 작업 처리 (실제 시간 기준, import된 모듈의 전역 코드가 건 작업 포함)
+		if (EventLoopTimeoutSeconds > 0.0)
+		{
+			const double Deadline = FPlatformTime::Seconds() + EventLoopTimeoutSeconds;
+			while (FPlatformTime::Seconds() < Deadline)
+			{
+				bool bHasPendingTasks = Interpreter->GetEventLoop().HasPendingTasks();
+				Interpreter->GetEventLoop().Tick(Interpreter.Get());
+				Modules.ForEachModuleInterpreter([&bHasPendingTasks](const TSharedPtr<FInterpreter>& ModuleInterpreter)
+				{
+					bHasPendingTasks |= ModuleInterpreter->GetEventLoop().HasPendingTasks();
+					ModuleInterpreter->GetEventLoop().Tick(ModuleInterpreter.Get());
+				});
+				if (!bHasPendingTasks)
+				{
+					break;
+				}
+				FPlatformProcess::Sleep(0.001f);
+			}
+		}
+
+		Result.ExecutionMilliseconds = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		Result.PeakSpaceBytes = Interpreter->GetPeakSpaceBytes();
+		Result.ExecutionCount = Interpreter->GetExecutionCount();
+		Result.bSucceeded = !Interpreter->IsExecutionAborted();
+		return Result;
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MagicScriptCore/Core/MsValue.h"
+#include "MagicScriptCore/Runtime/MsInterpreter.h"
+#include "MagicScriptCore/Runtime/MsModuleGraph.h"
+
+namespace MagicScript
+{
+	class IScriptHost;
+	class FInterpreter;
+	struct FProgram;
+
+	// 스크립트 1회 실행 결과
+	struct MAGICSCRIPTCORE_API FScriptRunResult
+	{
+		bool bCompiled = false;   // 렉싱/파싱/import 성공
+		bool bSucceeded = false;  // 컴파일 성공 + 런타임 에러 없음
+		FValue ReturnValue = FValue::Null();
+		int64 PeakSpaceBytes = 0;
+		int64 ExecutionCount = 0;
+		double ExecutionMilliseconds = 0.0;  // 전역 코드 + 진입 spell + 이벤트 루프
+	};
+
+	/**
+	 * 월드/서브시스템 없이 스크립트를 컴파일하고 실행하는 러너
+	 * - 로그와 import 소스 로딩은 호스트에 위임 (호스트가 null이면 기본 호스트)
+	 * - import한 스크립트는 모듈로 한 번만 평가하고 export를 바인딩 (서브시스템과 같은 규칙, FModuleGraph)
+	 * - 러너 하나를 한 스레드에서 사용 (스레드마다 러너/호스트를 따로 두면 병렬 실행 가능)
+	 */
+	class MAGICSCRIPTCORE_API FScriptRunner
+	{
+	public:
+		explicit FScriptRunner(IScriptHost* InHost);
+
+		// 모듈 그래프 콜백이 this를 붙잡으므로 복사 불가
+		FScriptRunner(const FScriptRunner&) = delete;
+		FScriptRunner& operator=(const FScriptRunner&) = delete;
+
+		// 모든 빌트인이 등록된 인터프리터 생성
+		static TSharedPtr<FInterpreter> CreateInterpreter(const FString& ScriptName, IScriptHost* Host);
+
+		// 렉싱 + 파싱 (실패 시 null, 에러는 호스트로 기록)
+		TSharedPtr<FProgram> Compile(const FString& ScriptName, const FString& Source) const;
+
+		// 컴파일 후 전역 코드 실행, EntryName이 비어 있지 않으면 해당 spell 호출
+		// EventLoopTimeoutSeconds > 0이면 그 시간 동안 남은 setTimeout 작업을 처리
+		FScriptRunResult Run(const FString& ScriptName, const FString& Source,
+			const FString& EntryName = TEXT("main"), double EventLoopTimeoutSeconds = 0.0);
+
+		FScriptRunResult RunProgram(const FString& ScriptName, const TSharedPtr<FProgram>& Program,
+			const FString& EntryName = TEXT("main"), double EventLoopTimeoutSeconds = 0.0);
+
+		// import한 모듈 인스턴스 비우기 (파일이 바뀐 경우, 다음 실행에서 다시 컴파일/평가)
+		void ClearImportCache() { Modules.Reset(); }
+
+		// 이후 실행하는 전역 코드/진입 spell/이벤트 루프 콜백 각각에 적용할 실행 예산
+		void SetExecutionBudget(const FScriptExecutionBudget& InBudget) { ExecutionBudget = InBudget; }
+
+	private:
+		IScriptHost* Host = nullptr;
+		FScriptExecutionBudget ExecutionBudget;
+		FModuleGraph Modules;
+	};
+}
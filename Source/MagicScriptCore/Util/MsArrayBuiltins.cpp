@@ -0,0 +1,524 @@
+#include "MagicScriptCore/Util/MsArrayBuiltins.h"
+#include "MagicScriptCore/Core/MsEnvironment.h"
+#include "MagicScriptCore/Core/MsValue.h"
+#include "MagicScriptCore/Runtime/MsInterpreter.h"
+#include "MagicScriptCore/Logging/MsLoggingEnum.h"
+#include "MagicScriptCore/Runtime/MsScriptHost.h"
+#include "MagicScriptCore/Runtime/MsScriptHeap.h"
+#include "Algo/Reverse.h"
+
+namespace MagicScript
+{
+	namespace MsArrayBuiltins
+	{
+		namespace
+		{
+			// 네이티브 함수 시간 복잡도 가산점 (인터프리터 루프 대비 대략적인 비용)
+			constexpr int32 LinearTimeScore = 10;       // O(n)
+			constexpr int32 LinearithmicTimeScore = 20; // O(n log n)
+
+			bool RequireArray(const TArray<FValue>& Args, const TCHAR* FuncName, IScriptHost* This)
+			{
+				if (!Args.IsValidIndex(0) || Args[0].Type != EValueType::Array || !Args[0].Array.IsValid())
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: %s requires array as first argument"), FuncName));
+					return false;
+				}
+				return true;
+			}
+
+			bool RequireCallback(const TArray<FValue>& Args, int32 Index, const TCHAR* FuncName, const FScriptExecutionContext& Context, IScriptHost* This)
+			{
+				if (!Args.IsValidIndex(Index) || Args[Index].Type != EValueType::Function || !Args[Index].Function.IsValid())
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: %s requires spell as callback argument"), FuncName));
+					return false;
+				}
+
+				if (!Context.Interpreter.IsValid())
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: %s cannot invoke callback without interpreter context"), FuncName));
+					return false;
+				}
+				return true;
+			}
+
+			bool IsTruthy(const FValue& V)
+			{
+				return V.Type == EValueType::Bool && V.Bool;
+			}
+
+			// 엄격 비교 (타입과 값이 모두 같아야 함, 배열/객체는 참조 비교)
+			bool StrictEquals(const FValue& A, const FValue& B)
+			{
+				if (A.Type != B.Type)
+				{
+					return false;
+				}
+
+				switch (A.Type)
+				{
+				case EValueType::Null:         return true;
+				case EValueType::Number:       return A.Number == B.Number;
+				case EValueType::Bool:         return A.Bool == B.Bool;
+				case EValueType::String:       return A.GetString().Equals(B.GetString(), ESearchCase::CaseSensitive);
+				case EValueType::Function:     return A.Function == B.Function;
+				case EValueType::Array:        return A.Array == B.Array;
+				case EValueType::Object:       return A.Object == B.Object;
+				case EValueType::NativeObject: return A.NativeObjectPtr == B.NativeObjectPtr;
+				case EValueType::Map:          return A.Map == B.Map;
+				case EValueType::Set:          return A.Set == B.Set;
+				default:                       return false;
+				}
+			}
+
+			// 기본 정렬 순서: 숫자 < 문자열 < 그 외 (타입 순서), 같은 타입은 값 비교
+			bool DefaultLess(const FValue& A, const FValue& B)
+			{
+				if (A.Type != B.Type)
+				{
+					return static_cast<uint8>(A.Type) < static_cast<uint8>(B.Type);
+				}
+
+				switch (A.Type)
+				{
+				case EValueType::Number: return A.Number < B.Number;
+				case EValueType::String: return A.GetString().Compare(B.GetString(), ESearchCase::CaseSensitive) < 0;
+				case EValueType::Bool:   return !A.Bool && B.Bool;
+				default:                 return false;
+				}
+			}
+
+			// 음수 인덱스는 뒤에서부터 계산하고 [0, Num] 범위로 보정
+			int32 ResolveIndex(const TArray<FValue>& Args, int32 ArgIndex, int32 Num, int32 DefaultValue)
+			{
+				if (!Args.IsValidIndex(ArgIndex) || Args[ArgIndex].Type != EValueType::Number)
+				{
+					return DefaultValue;
+				}
+
+				int32 Index = NumberToInt32(Args[ArgIndex].Number);
+				if (Index < 0)
+				{
+					Index += Num;
+				}
+				return FMath::Clamp(Index, 0, Num);
+			}
+		}
+
+		void Register(TSharedPtr<FEnvironment> Env, IScriptHost* Host)
+		{
+			if (!Env.IsValid())
+			{
+				return;
+			}
+
+			IScriptHost* This = Host;
+			auto RegisterNative = [&Env, This](const FString& Name, int32 SpaceBytes, TFunction<FValue(const TArray<FValue>&, const FScriptExecutionContext&)> Impl, int32 TimeScore = 0)
+			{
+				TSharedPtr<FFunctionValue> Func = MakeShared<FFunctionValue>();
+				Func->Name = Name;
+				Func->bIsNative = true;
+				Func->NativeImpl = Impl;
+				Func->SpaceCostBytes = SpaceBytes;
+				Func->TimeComplexityAdditionalScore = TimeScore;
+				Env->Define(Name, FValue::FromFunction(Func), true);
+			};
+
+			// Array.push_back(array, value)
+			RegisterNative(TEXT("Array.push_back"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!Args.IsValidIndex(0) || Args[0].Type != EValueType::Array || !Args[0].Array.IsValid())
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Array.push_back requires array as first argument"));
+					return FValue::Null();
+				}
+				
+				if (!Args.IsValidIndex(1))
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Array.push_back requires value argument"));
+					return FValue::Null();
+				}
+				
+				Args[0].Array->Add(Args[1]);
+				NotifyContainerChanged(Args[0].Array, GetValuePayloadBytes(Args[1]));
+				return FValue::Null();
+			});
+
+			// Array.push_front(array, value)
+			RegisterNative(TEXT("Array.push_front"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!Args.IsValidIndex(0) || Args[0].Type != EValueType::Array || !Args[0].Array.IsValid())
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Array.push_front requires array as first argument"));
+					return FValue::Null();
+				}
+				
+				if (!Args.IsValidIndex(1))
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Array.push_front requires value argument"));
+					return FValue::Null();
+				}
+				
+				Args[0].Array->Insert(Args[1], 0);
+				NotifyContainerChanged(Args[0].Array, GetValuePayloadBytes(Args[1]));
+				return FValue::Null();
+			});
+
+			// Array.pop_back(array)
+			RegisterNative(TEXT("Array.pop_back"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!Args.IsValidIndex(0) || Args[0].Type != EValueType::Array || !Args[0].Array.IsValid())
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Array.pop_back requires array as first argument"));
+					return FValue::Null();
+				}
+				
+				if (Args[0].Array->Num() == 0)
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Array.pop_back called on empty array"));
+					return FValue::Null();
+				}
+				
+				FValue Result = Args[0].Array->Last();
+				Args[0].Array->RemoveAt(Args[0].Array->Num() - 1);
+				NotifyContainerChanged(Args[0].Array, -GetValuePayloadBytes(Result));
+				return Result;
+			});
+
+			// Array.pop_front(array)
+			RegisterNative(TEXT("Array.pop_front"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!Args.IsValidIndex(0) || Args[0].Type != EValueType::Array || !Args[0].Array.IsValid())
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Array.pop_front requires array as first argument"));
+					return FValue::Null();
+				}
+				
+				if (Args[0].Array->Num() == 0)
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Array.pop_front called on empty array"));
+					return FValue::Null();
+				}
+				
+				FValue Result = Args[0].Array->operator[](0);
+				Args[0].Array->RemoveAt(0);
+				NotifyContainerChanged(Args[0].Array, -GetValuePayloadBytes(Result));
+				return Result;
+			});
+
+			// Array.length(array)
+			RegisterNative(TEXT("Array.length"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!Args.IsValidIndex(0) || Args[0].Type != EValueType::Array || !Args[0].Array.IsValid())
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Array.length requires array as first argument"));
+					return FValue::Null();
+				}
+				
+				if (Args[0].Array->Num() == 0)
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Array.length called on empty array"));
+					return FValue::Null();
+				}
+				
+				return FValue::FromNumber(Args[0].Array->Num());
+			});
+
+			// Array.slice(array, start, end) - [start, end) 구간을 새 배열로 복사
+			RegisterNative(TEXT("Array.slice"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireArray(Args, TEXT("Array.slice"), This))
+				{
+					return FValue::Null();
+				}
+
+				const TArray<FValue>& Source = *Args[0].Array;
+				const int32 Start = ResolveIndex(Args, 1, Source.Num(), 0);
+				const int32 End = ResolveIndex(Args, 2, Source.Num(), Source.Num());
+
+				TSharedPtr<TArray<FValue>> Result = MakeScriptArray();
+				if (End > Start)
+				{
+					Result->Append(Source.GetData() + Start, End - Start);
+				}
+				NotifyContainerRebuilt(Result);
+				return FValue::FromArray(Result);
+			}, LinearTimeScore);
+
+			// Array.concat(array, ...values) - 배열 인자는 펼쳐서, 그 외는 원소로 추가
+			RegisterNative(TEXT("Array.concat"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireArray(Args, TEXT("Array.concat"), This))
+				{
+					return FValue::Null();
+				}
+
+				int32 TotalNum = 0;
+				for (const FValue& Arg : Args)
+				{
+					TotalNum += (Arg.Type == EValueType::Array && Arg.Array.IsValid()) ? Arg.Array->Num() : 1;
+				}
+
+				TSharedPtr<TArray<FValue>> Result = MakeScriptArray();
+				Result->Reserve(TotalNum);
+				for (const FValue& Arg : Args)
+				{
+					if (Arg.Type == EValueType::Array && Arg.Array.IsValid())
+					{
+						Result->Append(*Arg.Array);
+					}
+					else
+					{
+						Result->Add(Arg);
+					}
+				}
+				NotifyContainerRebuilt(Result);
+				return FValue::FromArray(Result);
+			}, LinearTimeScore);
+
+			// Array.indexOf(array, value) - 없으면 -1
+			RegisterNative(TEXT("Array.indexOf"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireArray(Args, TEXT("Array.indexOf"), This))
+				{
+					return FValue::Null();
+				}
+
+				const FValue Target = Args.IsValidIndex(1) ? Args[1] : FValue::Null();
+				const int32 Found = Args[0].Array->IndexOfByPredicate([&Target](const FValue& Elem)
+				{
+					return StrictEquals(Elem, Target);
+				});
+				return FValue::FromNumber(Found);
+			}, LinearTimeScore);
+
+			// Array.includes(array, value)
+			RegisterNative(TEXT("Array.includes"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireArray(Args, TEXT("Array.includes"), This))
+				{
+					return FValue::Null();
+				}
+
+				const FValue Target = Args.IsValidIndex(1) ? Args[1] : FValue::Null();
+				return FValue::FromBool(Args[0].Array->ContainsByPredicate([&Target](const FValue& Elem)
+				{
+					return StrictEquals(Elem, Target);
+				}));
+			}, LinearTimeScore);
+
+			// Array.reverse(array) - 제자리 뒤집기 후 같은 배열 반환
+			RegisterNative(TEXT("Array.reverse"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireArray(Args, TEXT("Array.reverse"), This))
+				{
+					return FValue::Null();
+				}
+
+				Algo::Reverse(*Args[0].Array);
+				return Args[0];
+			}, LinearTimeScore);
+
+			// Array.sort(array, comparator?) - 제자리 안정 정렬, comparator(a, b)가 음수면 a가 앞
+			RegisterNative(TEXT("Array.sort"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireArray(Args, TEXT("Array.sort"), This))
+				{
+					return FValue::Null();
+				}
+
+				TArray<FValue>& Target = *Args[0].Array;
+				if (!Args.IsValidIndex(1) || Args[1].Type == EValueType::Null)
+				{
+					Target.StableSort(&DefaultLess);
+					return Args[0];
+				}
+
+				if (!RequireCallback(Args, 1, TEXT("Array.sort"), Context, This))
+				{
+					return FValue::Null();
+				}
+
+				FInterpreter* Interpreter = Context.Interpreter.Get();
+				const TSharedPtr<FFunctionValue>& Comparator = Args[1].Function;
+				TArray<FValue> CompareArgs;
+				CompareArgs.SetNum(2);
+
+				// comparator가 원본 배열을 바꿀 수 있으므로 복사본을 정렬한 뒤 되돌려 씀
+				TArray<FValue> Sorted = Target;
+				Sorted.StableSort([Interpreter, &Comparator, &CompareArgs, &Context](const FValue& A, const FValue& B)
+				{
+					// 에러로 중단된 경우 남은 비교는 순서를 유지하도록 false 반환
+					if (Interpreter->IsExecutionAborted())
+					{
+						return false;
+					}
+					CompareArgs[0] = A;
+					CompareArgs[1] = B;
+					const FValue Ret = Interpreter->CallFunction(Comparator, CompareArgs, Context);
+					return Ret.Type == EValueType::Number && Ret.Number < 0.0;
+				});
+
+				// 에러로 중단됐으면 원본을 그대로 둠
+				if (!Interpreter->IsExecutionAborted())
+				{
+					Target = MoveTemp(Sorted);
+					NotifyContainerRebuilt(Args[0].Array);
+				}
+				return Args[0];
+			}, LinearithmicTimeScore);
+
+			// Array.map(array, callback(value, index))
+			RegisterNative(TEXT("Array.map"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireArray(Args, TEXT("Array.map"), This) || !RequireCallback(Args, 1, TEXT("Array.map"), Context, This))
+				{
+					return FValue::Null();
+				}
+
+				// 콜백이 원본 배열을 바꿔도 안전하도록 호출 시점의 원소로 순회
+				const TArray<FValue> Source = *Args[0].Array;
+				TSharedPtr<TArray<FValue>> Result = MakeScriptArray();
+				Result->Reserve(Source.Num());
+
+				TArray<FValue> CallArgs;
+				CallArgs.SetNum(2);
+				for (int32 i = 0; i < Source.Num() && !Context.Interpreter->IsExecutionAborted(); ++i)
+				{
+					CallArgs[0] = Source[i];
+					CallArgs[1] = FValue::FromNumber(i);
+					Result->Add(Context.Interpreter->CallFunction(Args[1].Function, CallArgs, Context));
+				}
+				NotifyContainerRebuilt(Result);
+				return FValue::FromArray(Result);
+			}, LinearTimeScore);
+
+			// Array.filter(array, predicate(value, index))
+			RegisterNative(TEXT("Array.filter"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireArray(Args, TEXT("Array.filter"), This) || !RequireCallback(Args, 1, TEXT("Array.filter"), Context, This))
+				{
+					return FValue::Null();
+				}
+
+				// 콜백이 원본 배열을 바꿔도 안전하도록 호출 시점의 원소로 순회
+				const TArray<FValue> Source = *Args[0].Array;
+				TSharedPtr<TArray<FValue>> Result = MakeScriptArray();
+
+				TArray<FValue> CallArgs;
+				CallArgs.SetNum(2);
+				for (int32 i = 0; i < Source.Num() && !Context.Interpreter->IsExecutionAborted(); ++i)
+				{
+					CallArgs[0] = Source[i];
+					CallArgs[1] = FValue::FromNumber(i);
+					if (IsTruthy(Context.Interpreter->CallFunction(Args[1].Function, CallArgs, Context)))
+					{
+						Result->Add(Source[i]);
+					}
+				}
+				NotifyContainerRebuilt(Result);
+				return FValue::FromArray(Result);
+			}, LinearTimeScore);
+
+			// Array.reduce(array, reducer(acc, value, index), initial?)
+			RegisterNative(TEXT("Array.reduce"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireArray(Args, TEXT("Array.reduce"), This) || !RequireCallback(Args, 1, TEXT("Array.reduce"), Context, This))
+				{
+					return FValue::Null();
+				}
+
+				// 콜백이 원본 배열을 바꿔도 안전하도록 호출 시점의 원소로 순회
+				const TArray<FValue> Source = *Args[0].Array;
+				int32 StartIndex = 0;
+				FValue Accumulator;
+				if (Args.IsValidIndex(2))
+				{
+					Accumulator = Args[2];
+				}
+				else if (Source.Num() > 0)
+				{
+					Accumulator = Source[0];
+					StartIndex = 1;
+				}
+				else
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Array.reduce called on empty array without initial value"));
+					return FValue::Null();
+				}
+
+				TArray<FValue> CallArgs;
+				CallArgs.SetNum(3);
+				for (int32 i = StartIndex; i < Source.Num() && !Context.Interpreter->IsExecutionAborted(); ++i)
+				{
+					CallArgs[0] = MoveTemp(Accumulator);
+					CallArgs[1] = Source[i];
+					CallArgs[2] = FValue::FromNumber(i);
+					Accumulator = Context.Interpreter->CallFunction(Args[1].Function, CallArgs, Context);
+				}
+				return Accumulator;
+			}, LinearTimeScore);
+
+			// Array.find(array, predicate(value, index)) - 없으면 null
+			RegisterNative(TEXT("Array.find"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireArray(Args, TEXT("Array.find"), This) || !RequireCallback(Args, 1, TEXT("Array.find"), Context, This))
+				{
+					return FValue::Null();
+				}
+
+				// 콜백이 원본 배열을 바꿔도 안전하도록 호출 시점의 원소로 순회
+				const TArray<FValue> Source = *Args[0].Array;
+				TArray<FValue> CallArgs;
+				CallArgs.SetNum(2);
+				for (int32 i = 0; i < Source.Num() && !Context.Interpreter->IsExecutionAborted(); ++i)
+				{
+					CallArgs[0] = Source[i];
+					CallArgs[1] = FValue::FromNumber(i);
+					if (IsTruthy(Context.Interpreter->CallFunction(Args[1].Function, CallArgs, Context)))
+					{
+						return Source[i];
+					}
+				}
+				return FValue::Null();
+			}, LinearTimeScore);
+
+			// Array.join(array, separator?) - 기본 구분자는 ","
+			// 전체 길이를 먼저 계산해 버퍼를 한 번만 할당
+			RegisterNative(TEXT("Array.join"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireArray(Args, TEXT("Array.join"), This))
+				{
+					return FValue::Null();
+				}
+
+				const FString Separator = Args.IsValidIndex(1) && Args[1].Type != EValueType::Null ? Args[1].ToScriptString() : FString(TEXT(","));
+				// 원소 문자열 변환 중에도 원본이 바뀌지 않도록 호출 시점의 원소로 순회
+				const TArray<FValue> Source = *Args[0].Array;
+
+				TArray<FString> Parts;
+				Parts.Reserve(Source.Num());
+				int32 TotalLen = Source.Num() > 0 ? Separator.Len() * (Source.Num() - 1) : 0;
+				for (const FValue& Element : Source)
+				{
+					// null 원소는 빈 문자열로 취급
+					Parts.Add(Element.Type == EValueType::Null ? FString() : Element.ToScriptString());
+					TotalLen += Parts.Last().Len();
+				}
+
+				FString Result;
+				Result.Reserve(TotalLen);
+				for (int32 i = 0; i < Parts.Num(); ++i)
+				{
+					if (i > 0)
+					{
+						Result += Separator;
+					}
+					Result += Parts[i];
+				}
+				return FValue::FromString(Result);
+			}, LinearTimeScore);
+		}
+	}
+}
@@ -2,16 +2,15 @@
 
 #include "CoreMinimal.h"
 
-class UMagicScriptInterpreterSubsystem;
-
 namespace MagicScript
 {
+	class IScriptHost;
 	class FEnvironment;
 	
 	namespace MsArrayBuiltins
 	{
 		/** Array.* 메서드들을 등록 */
-		void Register(TSharedPtr<FEnvironment> Env, UMagicScriptInterpreterSubsystem* Subsystem);
+		MAGICSCRIPTCORE_API void Register(TSharedPtr<FEnvironment> Env, IScriptHost* Host);
 	}
 }
 
@@ -0,0 +1,318 @@
+#include "MagicScriptCore/Util/MsCollectionBuiltins.h"
+#include "MagicScriptCore/Core/MsEnvironment.h"
+#include "MagicScriptCore/Core/MsValue.h"
+#include "MagicScriptCore/Runtime/MsInterpreter.h"
+#include "MagicScriptCore/Logging/MsLoggingEnum.h"
+#include "MagicScriptCore/Runtime/MsScriptHost.h"
+#include "MagicScriptCore/Runtime/MsScriptHeap.h"
+
+namespace MagicScript
+{
+	namespace MsCollectionBuiltins
+	{
+		namespace
+		{
+			// 키/값 전체를 복사하는 함수의 시간 복잡도 가산점 (O(n))
+			constexpr int32 LinearTimeScore = 10;
+
+			bool RequireMap(const TArray<FValue>& Args, const TCHAR* FuncName, IScriptHost* This)
+			{
+				if (!Args.IsValidIndex(0) || Args[0].Type != EValueType::Map || !Args[0].Map.IsValid())
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: %s requires map as first argument"), FuncName));
+					return false;
+				}
+				return true;
+			}
+
+			bool RequireSet(const TArray<FValue>& Args, const TCHAR* FuncName, IScriptHost* This)
+			{
+				if (!Args.IsValidIndex(0) || Args[0].Type != EValueType::Set || !Args[0].Set.IsValid())
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: %s requires set as first argument"), FuncName));
+					return false;
+				}
+				return true;
+			}
+
+			bool RequireKey(const TArray<FValue>& Args, int32 Index, const TCHAR* FuncName, IScriptHost* This)
+			{
+				if (!Args.IsValidIndex(Index) || !Args[Index].IsHashableKey())
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: %s requires number, string or bool key"), FuncName));
+					return false;
+				}
+				return true;
+			}
+		}
+
+		void Register(TSharedPtr<FEnvironment> Env, IScriptHost* Host)
+		{
+			if (!Env.IsValid())
+			{
+				return;
+			}
+
+			IScriptHost* This = Host;
+			auto RegisterNative = [&Env, This](const FString& Name, int32 SpaceBytes, TFunction<FValue(const TArray<FValue>&, const FScriptExecutionContext&)> Impl, int32 TimeScore = 0)
+			{
+				TSharedPtr<FFunctionValue> Func = MakeShared<FFunctionValue>();
+				Func->Name = Name;
+				Func->bIsNative = true;
+				Func->NativeImpl = Impl;
+				Func->SpaceCostBytes = SpaceBytes;
+				Func->TimeComplexityAdditionalScore = TimeScore;
+				Env->Define(Name, FValue::FromFunction(Func), true);
+			};
+
+			// === Map ===
+
+			// Map.create() 또는 Map.create([[key, value], ...])
+			RegisterNative(TEXT("Map.create"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				TSharedPtr<FValueMap> Map = MakeScriptMap();
+				if (Args.IsValidIndex(0) && Args[0].Type == EValueType::Array && Args[0].Array.IsValid())
+				{
+					Map->Reserve(Args[0].Array->Num());
+					for (const FValue& Pair : *Args[0].Array)
+					{
+						if (Pair.Type != EValueType::Array || !Pair.Array.IsValid() || Pair.Array->Num() < 2 || !(*Pair.Array)[0].IsHashableKey())
+						{
+							if (This) This->AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Map.create requires [key, value] pairs with number, string or bool keys"));
+							return FValue::Null();
+						}
+						Map->Add((*Pair.Array)[0], (*Pair.Array)[1]);
+					}
+				}
+				NotifyContainerRebuilt(Map);
+				return FValue::FromMap(Map);
+			});
+
+			// Map.get(map, key) - 없으면 null
+			RegisterNative(TEXT("Map.get"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireMap(Args, TEXT("Map.get"), This) || !RequireKey(Args, 1, TEXT("Map.get"), This))
+				{
+					return FValue::Null();
+				}
+
+				const FValue* Found = Args[0].Map->Find(Args[1]);
+				return Found ? *Found : FValue::Null();
+			});
+
+			// Map.set(map, key, value) - map 반환 (체이닝 허용)
+			RegisterNative(TEXT("Map.set"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireMap(Args, TEXT("Map.set"), This) || !RequireKey(Args, 1, TEXT("Map.set"), This))
+				{
+					return FValue::Null();
+				}
+
+				const FValue Value = Args.IsValidIndex(2) ? Args[2] : FValue::Null();
+				const int64 PayloadDelta = GetAssignPayloadDelta(*Args[0].Map, Args[1], Value);
+				Args[0].Map->Add(Args[1], Value);
+				NotifyContainerChanged(Args[0].Map, PayloadDelta);
+				return Args[0];
+			});
+
+			// Map.has(map, key)
+			RegisterNative(TEXT("Map.has"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireMap(Args, TEXT("Map.has"), This) || !RequireKey(Args, 1, TEXT("Map.has"), This))
+				{
+					return FValue::Null();
+				}
+
+				return FValue::FromBool(Args[0].Map->Contains(Args[1]));
+			});
+
+			// Map.delete(map, key) - 삭제 여부 반환
+			RegisterNative(TEXT("Map.delete"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireMap(Args, TEXT("Map.delete"), This) || !RequireKey(Args, 1, TEXT("Map.delete"), This))
+				{
+					return FValue::Null();
+				}
+
+				const FValue* Existing = Args[0].Map->Find(Args[1]);
+				if (!Existing)
+				{
+					return FValue::FromBool(false);
+				}
+
+				const int64 PayloadDelta = -(GetKeyPayloadBytes(Args[1]) + GetValuePayloadBytes(*Existing));
+				Args[0].Map->Remove(Args[1]);
+				NotifyContainerChanged(Args[0].Map, PayloadDelta);
+				return FValue::FromBool(true);
+			});
+
+			// Map.size(map)
+			RegisterNative(TEXT("Map.size"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireMap(Args, TEXT("Map.size"), This))
+				{
+					return FValue::Null();
+				}
+
+				return FValue::FromNumber(Args[0].Map->Num());
+			});
+
+			// Map.keys(map) - 키 배열 반환 (내부 순회 순서, 삭제 후 추가하면 빈자리를 재사용하므로 삽입 순서는 보장되지 않음)
+			RegisterNative(TEXT("Map.keys"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireMap(Args, TEXT("Map.keys"), This))
+				{
+					return FValue::Null();
+				}
+
+				TSharedPtr<TArray<FValue>> Result = MakeScriptArray();
+				Result->Reserve(Args[0].Map->Num());
+				for (const auto& Pair : *Args[0].Map)
+				{
+					Result->Add(Pair.Key);
+				}
+				NotifyContainerRebuilt(Result);
+				return FValue::FromArray(Result);
+			}, LinearTimeScore);
+
+			// Map.values(map) - 값 배열 반환 (Map.keys와 같은 순서)
+			RegisterNative(TEXT("Map.values"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireMap(Args, TEXT("Map.values"), This))
+				{
+					return FValue::Null();
+				}
+
+				TSharedPtr<TArray<FValue>> Result = MakeScriptArray();
+				Result->Reserve(Args[0].Map->Num());
+				for (const auto& Pair : *Args[0].Map)
+				{
+					Result->Add(Pair.Value);
+				}
+				NotifyContainerRebuilt(Result);
+				return FValue::FromArray(Result);
+			}, LinearTimeScore);
+
+			// Map.clear(map)
+			RegisterNative(TEXT("Map.clear"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireMap(Args, TEXT("Map.clear"), This))
+				{
+					return FValue::Null();
+				}
+
+				Args[0].Map->Empty();
+				NotifyContainerRebuilt(Args[0].Map);
+				return FValue::Null();
+			});
+
+			// === Set ===
+
+			// Set.create() 또는 Set.create([values...])
+			RegisterNative(TEXT("Set.create"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				TSharedPtr<FValueSet> Set = MakeScriptSet();
+				if (Args.IsValidIndex(0) && Args[0].Type == EValueType::Array && Args[0].Array.IsValid())
+				{
+					Set->Reserve(Args[0].Array->Num());
+					for (const FValue& Elem : *Args[0].Array)
+					{
+						if (!Elem.IsHashableKey())
+						{
+							if (This) This->AddScriptLog(EScriptLogType::Error, TEXT("MagicScript Runtime Error: Set.create requires number, string or bool values"));
+							return FValue::Null();
+						}
+						Set->Add(Elem);
+					}
+				}
+				NotifyContainerRebuilt(Set);
+				return FValue::FromSet(Set);
+			});
+
+			// Set.add(set, value) - set 반환 (체이닝 허용)
+			RegisterNative(TEXT("Set.add"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireSet(Args, TEXT("Set.add"), This) || !RequireKey(Args, 1, TEXT("Set.add"), This))
+				{
+					return FValue::Null();
+				}
+
+				if (!Args[0].Set->Contains(Args[1]))
+				{
+					Args[0].Set->Add(Args[1]);
+					NotifyContainerChanged(Args[0].Set, GetValuePayloadBytes(Args[1]));
+				}
+				return Args[0];
+			});
+
+			// Set.has(set, value)
+			RegisterNative(TEXT("Set.has"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireSet(Args, TEXT("Set.has"), This) || !RequireKey(Args, 1, TEXT("Set.has"), This))
+				{
+					return FValue::Null();
+				}
+
+				return FValue::FromBool(Args[0].Set->Contains(Args[1]));
+			});
+
+			// Set.delete(set, value) - 삭제 여부 반환
+			RegisterNative(TEXT("Set.delete"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireSet(Args, TEXT("Set.delete"), This) || !RequireKey(Args, 1, TEXT("Set.delete"), This))
+				{
+					return FValue::Null();
+				}
+
+				const bool bRemoved = Args[0].Set->Remove(Args[1]) > 0;
+				if (bRemoved)
+				{
+					NotifyContainerChanged(Args[0].Set, -GetValuePayloadBytes(Args[1]));
+				}
+				return FValue::FromBool(bRemoved);
+			});
+
+			// Set.size(set)
+			RegisterNative(TEXT("Set.size"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireSet(Args, TEXT("Set.size"), This))
+				{
+					return FValue::Null();
+				}
+
+				return FValue::FromNumber(Args[0].Set->Num());
+			});
+
+			// Set.values(set) - 원소 배열 반환 (내부 순회 순서, 삭제 후에는 삽입 순서가 보장되지 않음)
+			RegisterNative(TEXT("Set.values"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireSet(Args, TEXT("Set.values"), This))
+				{
+					return FValue::Null();
+				}
+
+				TSharedPtr<TArray<FValue>> Result = MakeScriptArray();
+				Result->Reserve(Args[0].Set->Num());
+				for (const FValue& Elem : *Args[0].Set)
+				{
+					Result->Add(Elem);
+				}
+				NotifyContainerRebuilt(Result);
+				return FValue::FromArray(Result);
+			}, LinearTimeScore);
+
+			// Set.clear(set)
+			RegisterNative(TEXT("Set.clear"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireSet(Args, TEXT("Set.clear"), This))
+				{
+					return FValue::Null();
+				}
+
+				Args[0].Set->Empty();
+				NotifyContainerRebuilt(Args[0].Set);
+				return FValue::Null();
+			});
+		}
+	}
+}
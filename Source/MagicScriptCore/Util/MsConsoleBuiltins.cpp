@@ -0,0 +1,95 @@
+#include "MagicScriptCore/Util/MsConsoleBuiltins.h"
+#include "MagicScriptCore/Core/MsEnvironment.h"
+#include "MagicScriptCore/Core/MsValue.h"
+#include "MagicScriptCore/Runtime/MsInterpreter.h"
+#include "MagicScriptCore/Logging/MsLoggingEnum.h"
+#include "MagicScriptCore/Runtime/MsScriptHost.h"
+
+namespace MagicScript
+{
+	namespace MsConsoleBuiltins
+	{
+		namespace
+		{
+			// 인자들을 ", "로 이어 하나의 버퍼에 기록한 뒤 로그로 추가 (스크립트 이름과 console 호출 위치 포함)
+			// 로그가 버려지는 경우(레벨 필터, 리스너 없음)에는 포맷 자체를 생략
+			void LogArgs(const EScriptLogType LogType, const TArray<FValue>& Args, IScriptHost* This, const FScriptExecutionContext& Context)
+			{
+				if (!Args.IsValidIndex(0) || !This || !This->ShouldCaptureScriptLog(LogType))
+				{
+					return;
+				}
+
+				TStringBuilder<512> LogResult;
+				for (int32 i = 0; i < Args.Num(); i++)
+				{
+					const int32 Remaining = DebugStringLogMaxLength - LogResult.Len();
+					if (Remaining <= 0)
+					{
+						LogResult.Append(TEXT("..."));
+						break;
+					}
+
+					if (i > 0)
+					{
+						LogResult.Append(TEXT(", "));
+					}
+					Args[i].AppendDebugString(LogResult, DebugStringLogMaxDepth, Remaining);
+				}
+
+				const FInterpreter* Interpreter = Context.Interpreter.Get();
+				if (!Interpreter)
+				{
+					This->AddScriptLog(LogType, FString(LogResult.ToString()));
+					return;
+				}
+
+				const FString& ScriptName = Interpreter->GetScriptName();
+				const FSourceLocation& Location = Interpreter->GetCurrentCallLocation();
+				This->AddScriptLog(LogType, FString(LogResult.ToString()),
+					ScriptName.IsEmpty() ? NAME_None : FName(*ScriptName), Location.Line, Location.Column);
+			}
+		}
+
+		void Register(TSharedPtr<FEnvironment> Env, IScriptHost* Host)
+		{
+			if (!Env.IsValid())
+			{
+				return;
+			}
+
+			IScriptHost* This = Host;
+			auto RegisterNative = [&Env, This](const FString& Name, int32 SpaceBytes, TFunction<FValue(const TArray<FValue>&, const FScriptExecutionContext&)> Impl)
+			{
+				TSharedPtr<FFunctionValue> Func = MakeShared<FFunctionValue>();
+				Func->Name = Name;
+				Func->bIsNative = true;
+				Func->NativeImpl = Impl;
+				Func->SpaceCostBytes = SpaceBytes;
+				Env->Define(Name, FValue::FromFunction(Func), true);
+			};
+
+			// console.log(...args)
+			RegisterNative(TEXT("console.log"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				LogArgs(EScriptLogType::Default, Args, This, Context);
+				return FValue::Null();
+			});
+
+			// console.warn(...args)
+			RegisterNative(TEXT("console.warn"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				LogArgs(EScriptLogType::Warning, Args, This, Context);
+				return FValue::Null();
+			});
+
+			// console.error(...args)
+			RegisterNative(TEXT("console.error"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				LogArgs(EScriptLogType::Error, Args, This, Context);
+				return FValue::Null();
+			});
+		}
+	}
+}
+
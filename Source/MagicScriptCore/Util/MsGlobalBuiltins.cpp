@@ -1,5 +1,6 @@
-#include "MagicScript/Util/MsGlobalBuiltins.h"
-#include "MagicScript/Core/MsValue.h"
+#include "MagicScriptCore/Util/MsGlobalBuiltins.h"
+#include "MagicScriptCore/Core/MsValue.h"
+#include "MagicScriptCore/Runtime/MsScriptHeap.h"
 
 namespace MagicScript
 {
@@ -85,6 +86,7 @@ namespace MagicScript
 		Params.Get()->Add("x", FValue::FromNumber(Value.X));
 		Params.Get()->Add("y", FValue::FromNumber(Value.Y));
 		Params.Get()->Add("z", FValue::FromNumber(Value.Z));
+		NotifyContainerRebuilt(Params);
 	}
 }
 
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace MagicScript
+{
+	struct FValue;
+	class FEnvironment;
+	
+	MAGICSCRIPTCORE_API bool GetObjectParamBool(const TSharedPtr<TMap<FString, FValue>>& Params, const FString& Key);
+	MAGICSCRIPTCORE_API float GetObjectParamFloat(const TSharedPtr<TMap<FString, FValue>>& Params, const FString& Key);
+	MAGICSCRIPTCORE_API FVector2D GetObjectParamVector(const TSharedPtr<TMap<FString, FValue>>& Params, const FString& Key);
+	MAGICSCRIPTCORE_API UObject* GetObjectParamNativeObject(const TSharedPtr<TMap<FString, FValue>>& Params, const FString& Key);
+	MAGICSCRIPTCORE_API void SetObjectParamToVector(const TSharedPtr<TMap<FString, FValue>>& Params, const FVector& Value);
+}
+
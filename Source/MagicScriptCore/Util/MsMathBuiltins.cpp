@@ -1,14 +1,14 @@
-#include "MagicScript/Util/MsMathBuiltins.h"
-#include "MagicScript/Core/MsEnvironment.h"
-#include "MagicScript/Core/MsValue.h"
-#include "MagicScript/Runtime/MsInterpreter.h"
+#include "MagicScriptCore/Util/MsMathBuiltins.h"
+#include "MagicScriptCore/Core/MsEnvironment.h"
+#include "MagicScriptCore/Core/MsValue.h"
+#include "MagicScriptCore/Runtime/MsInterpreter.h"
 #include "Math/UnrealMathUtility.h"
 
 namespace MagicScript
 {
 	namespace MsMathBuiltins
 	{
-		void Register(TSharedPtr<FEnvironment> Env, UMagicScriptInterpreterSubsystem* Subsystem)
+		void Register(TSharedPtr<FEnvironment> Env, IScriptHost* Host)
 		{
 			if (!Env.IsValid())
 			{
@@ -0,0 +1,218 @@
+#include "MagicScriptCore/Util/MsStringBuiltins.h"
+#include "MagicScriptCore/Core/MsEnvironment.h"
+#include "MagicScriptCore/Core/MsValue.h"
+#include "MagicScriptCore/Runtime/MsInterpreter.h"
+#include "MagicScriptCore/Logging/MsLoggingEnum.h"
+#include "MagicScriptCore/Runtime/MsScriptHost.h"
+#include "MagicScriptCore/Runtime/MsScriptHeap.h"
+
+namespace MagicScript
+{
+	namespace MsStringBuiltins
+	{
+		namespace
+		{
+			// 문자열 전체를 훑는 함수의 시간 복잡도 가산점 (O(n))
+			constexpr int32 LinearTimeScore = 10;
+
+			bool RequireString(const TArray<FValue>& Args, int32 Index, const TCHAR* FuncName, IScriptHost* This)
+			{
+				if (!Args.IsValidIndex(Index) || Args[Index].Type != EValueType::String)
+				{
+					if (This) This->AddScriptLog(EScriptLogType::Error, FString::Printf(TEXT("MagicScript Runtime Error: %s requires string argument"), FuncName));
+					return false;
+				}
+				return true;
+			}
+
+			// 숫자 인자를 정수 인덱스로 변환, 없거나 숫자가 아니면 Default
+			int32 GetIntArg(const TArray<FValue>& Args, int32 Index, int32 Default)
+			{
+				if (!Args.IsValidIndex(Index) || Args[Index].Type != EValueType::Number)
+				{
+					return Default;
+				}
+				return NumberToInt32(Args[Index].Number);
+			}
+		}
+
+		void Register(TSharedPtr<FEnvironment> Env, IScriptHost* Host)
+		{
+			if (!Env.IsValid())
+			{
+				return;
+			}
+
+			IScriptHost* This = Host;
+			auto RegisterNative = [&Env, This](const FString& Name, int32 SpaceBytes, TFunction<FValue(const TArray<FValue>&, const FScriptExecutionContext&)> Impl, int32 TimeScore = 0)
+			{
+				TSharedPtr<FFunctionValue> Func = MakeShared<FFunctionValue>();
+				Func->Name = Name;
+				Func->bIsNative = true;
+				Func->NativeImpl = Impl;
+				Func->SpaceCostBytes = SpaceBytes;
+				Func->TimeComplexityAdditionalScore = TimeScore;
+				Env->Define(Name, FValue::FromFunction(Func), true);
+			};
+
+			// String.length(string) - 로프는 평탄화 없이 길이만 반환
+			RegisterNative(TEXT("String.length"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireString(Args, 0, TEXT("String.length"), This))
+				{
+					return FValue::Null();
+				}
+
+				return FValue::FromNumber(Args[0].GetStringLen());
+			});
+
+			// String.substring(string, start, end?) - [start, end) 구간, 범위는 문자열 길이로 보정
+			RegisterNative(TEXT("String.substring"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireString(Args, 0, TEXT("String.substring"), This))
+				{
+					return FValue::Null();
+				}
+
+				const FString& Source = Args[0].GetString();
+				int32 Start = FMath::Clamp(GetIntArg(Args, 1, 0), 0, Source.Len());
+				int32 End = FMath::Clamp(GetIntArg(Args, 2, Source.Len()), 0, Source.Len());
+				if (Start > End)
+				{
+					Swap(Start, End);
+				}
+				return FValue::FromString(Source.Mid(Start, End - Start));
+			}, LinearTimeScore);
+
+			// String.indexOf(string, search, fromIndex?) - 없으면 -1
+			RegisterNative(TEXT("String.indexOf"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireString(Args, 0, TEXT("String.indexOf"), This) || !RequireString(Args, 1, TEXT("String.indexOf"), This))
+				{
+					return FValue::Null();
+				}
+
+				const FString& Source = Args[0].GetString();
+				const int32 From = FMath::Clamp(GetIntArg(Args, 2, 0), 0, Source.Len());
+				return FValue::FromNumber(Source.Find(Args[1].GetString(), ESearchCase::CaseSensitive, ESearchDir::FromStart, From));
+			}, LinearTimeScore);
+
+			// String.split(string, separator) - 빈 구분자면 문자 단위로 분리
+			RegisterNative(TEXT("String.split"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireString(Args, 0, TEXT("String.split"), This) || !RequireString(Args, 1, TEXT("String.split"), This))
+				{
+					return FValue::Null();
+				}
+
+				const FString& Source = Args[0].GetString();
+				const FString& Separator = Args[1].GetString();
+				TSharedPtr<TArray<FValue>> Result = MakeScriptArray();
+
+				if (Separator.IsEmpty())
+				{
+					Result->Reserve(Source.Len());
+					for (int32 i = 0; i < Source.Len(); ++i)
+					{
+						Result->Add(FValue::FromString(Source.Mid(i, 1)));
+					}
+					NotifyContainerRebuilt(Result);
+					return FValue::FromArray(Result);
+				}
+
+				// 빈 조각도 유지 ("a,,b" → ["a", "", "b"])
+				int32 Start = 0;
+				while (true)
+				{
+					const int32 Found = Source.Find(Separator, ESearchCase::CaseSensitive, ESearchDir::FromStart, Start);
+					if (Found == INDEX_NONE)
+					{
+						Result->Add(FValue::FromString(Source.Mid(Start)));
+						break;
+					}
+					Result->Add(FValue::FromString(Source.Mid(Start, Found - Start)));
+					Start = Found + Separator.Len();
+				}
+				NotifyContainerRebuilt(Result);
+				return FValue::FromArray(Result);
+			}, LinearTimeScore);
+
+			// String.format(format, ...args) - "{0}", "{1}" 은 해당 인자, "{}" 는 다음 인자로 치환
+			// "{{" / "}}" 는 중괄호 자체로 출력
+			RegisterNative(TEXT("String.format"), 0, [This](const TArray<FValue>& Args, const FScriptExecutionContext& Context) -> FValue
+			{
+				if (!RequireString(Args, 0, TEXT("String.format"), This))
+				{
+					return FValue::Null();
+				}
+
+				const FString& Format = Args[0].GetString();
+				TStringBuilder<256> Builder;
+				int32 NextArg = 0;
+
+				for (int32 i = 0; i < Format.Len(); ++i)
+				{
+					const TCHAR Ch = Format[i];
+					if (Ch == TEXT('{') && i + 1 < Format.Len() && Format[i + 1] == TEXT('{'))
+					{
+						Builder.AppendChar(TEXT('{'));
+						++i;
+						continue;
+					}
+					if (Ch == TEXT('}') && i + 1 < Format.Len() && Format[i + 1] == TEXT('}'))
+					{
+						Builder.AppendChar(TEXT('}'));
+						++i;
+						continue;
+					}
+					if (Ch != TEXT('{'))
+					{
+						Builder.AppendChar(Ch);
+						continue;
+					}
+
+					// {숫자} 또는 {} 파싱
+					int32 Close = i + 1;
+					int32 ArgIndex = 0;
+					bool bHasDigits = false;
+					while (Close < Format.Len() && FChar::IsDigit(Format[Close]))
+					{
+						// 인자 개수를 넘으면 더 누적하지 않음 (긴 숫자도 넘치지 않고 누락된 인자로 처리)
+						if (ArgIndex <= Args.Num())
+						{
+							ArgIndex = ArgIndex * 10 + (Format[Close] - TEXT('0'));
+						}
+						bHasDigits = true;
+						++Close;
+					}
+					if (Close >= Format.Len() || Format[Close] != TEXT('}'))
+					{
+						// 자리표시자가 아니면 그대로 출력
+						Builder.AppendChar(Ch);
+						continue;
+					}
+
+					if (!bHasDigits)
+					{
+						ArgIndex = NextArg++;
+					}
+
+					// 포맷 인자는 Args[1]부터 시작
+					if (Args.IsValidIndex(ArgIndex + 1))
+					{
+						Builder.Append(Args[ArgIndex + 1].ToScriptString());
+					}
+					else
+					{
+						if (This) This->AddScriptLog(EScriptLogType::Warning, FString::Printf(TEXT("MagicScript Runtime Warning: String.format missing argument {%s}"),
+							bHasDigits ? *Format.Mid(i + 1, Close - i - 1) : *FString::FromInt(ArgIndex)));
+						Builder.Append(TEXT("null"));
+					}
+					i = Close;
+				}
+
+				return FValue::FromString(FString(Builder.ToString()));
+			}, LinearTimeScore);
+		}
+	}
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace MagicScript
+{
+	class IScriptHost;
+	class FEnvironment;
+	
+	namespace MsStringBuiltins
+	{
+		/** String.* 메서드들을 등록 */
+		MAGICSCRIPTCORE_API void Register(TSharedPtr<FEnvironment> Env, IScriptHost* Host);
+	}
+}